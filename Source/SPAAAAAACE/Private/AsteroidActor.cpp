@@ -6,19 +6,30 @@
  * subdivision and multi-layer noise deformation.
  * 
  * Key Systems:
- * - Icosphere mesh generation and subdivision
- * - Multi-layer noise deformation
+ * - Async generation request, cancellation and game thread hand-off
  * - Physics collision and simulation setup
- * - Statistics calculation (radius, volume, mass)
+ * - Cached convex collision, cooked on a worker behind a sphere proxy
+ * - Collision detail tiers (sphere / reduced hull / full hull)
  * - Blueprint event integration
+ * 
+ * The geometry itself (icosphere, noise, normals, stats) lives in
+ * FAsteroidGenerator so it can run on worker threads.
  */
 
 #include "AsteroidActor.h"
+#include "AsteroidCollisionCache.h"
+#include "AsteroidFractureSubsystem.h"
+#include "AsteroidPhysicsSubsystem.h"
+#include "AsteroidRandom.h"
+#include "AsteroidSpatialSubsystem.h"
 
 // Core engine includes
 #include "Kismet/KismetMathLibrary.h"  // Math utilities
 #include "Engine/World.h"              // World access
 #include "DrawDebugHelpers.h"          // Debug drawing
+#include "Tasks/Task.h"                // Worker tasks for geometry generation
+#include "Async/Async.h"               // Game thread hand-off
+#include "TimerManager.h"              // Deformation flush and collision throttle
 
 /**
  * AAsteroidActor Constructor
@@ -42,7 +53,7 @@ AAsteroidActor::AAsteroidActor()
      * Creates the procedural mesh component that will hold the generated
      * asteroid geometry. This component handles both rendering and physics.
      */
-    ProcMesh = CreateDefaultSubobject<UProceduralMeshComponent>(TEXT("ProcMesh"));
+    ProcMesh = CreateDefaultSubobject<UAsteroidMeshComponent>(TEXT("ProcMesh"));
     RootComponent = ProcMesh;
 
     // ============================================================================
@@ -64,6 +75,9 @@ AAsteroidActor::AAsteroidActor()
     ProcMesh->SetCollisionObjectType(ECC_WorldDynamic);
     ProcMesh->SetMobility(EComponentMobility::Movable);
 
+    // Impacts are only reported while bFracturable (see ApplyGeneratedMesh)
+    ProcMesh->OnComponentHit.AddDynamic(this, &AAsteroidActor::HandleProcMeshHit);
+
     // ============================================================================
     // DEFAULT NOISE LAYER SETUP
     // ============================================================================
@@ -88,302 +102,1004 @@ AAsteroidActor::AAsteroidActor()
 void AAsteroidActor::BeginPlay()
 {
     Super::BeginPlay();
-    GenerateAsteroid();
+
+    // Warm-up actors are parked before they ever generate
+    if (!bPooled)
+    {
+        GenerateAsteroid();
+    }
+}
+
+void AAsteroidActor::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    // Destroyed before the mesh arrived - let the worker bail out early
+    CancelPendingGeneration();
+    UnregisterFromSubsystems();
+
+    Super::EndPlay(EndPlayReason);
+}
+
+void AAsteroidActor::UnregisterFromSubsystems()
+{
+    if (UAsteroidPhysicsSubsystem* Physics = UAsteroidPhysicsSubsystem::Get(this))
+    {
+        Physics->UnregisterAsteroid(this);
+    }
+    if (UAsteroidSpatialSubsystem* Spatial = UAsteroidSpatialSubsystem::Get(this))
+    {
+        Spatial->UnregisterAsteroid(this);
+    }
 }
 
 void AAsteroidActor::GenerateAsteroid()
 {
+    // A new request supersedes anything still in flight
+    CancelPendingGeneration();
+    SharedMesh.Reset();
+    FractureSet.Reset();
+
+    // Seeds and radius are resolved up front so the worker gets a complete snapshot
+    FAsteroidGenerationParams Params = MakeGenerationParams();
+    ShapeKey = FAsteroidShapeKey::FromParams(Params);
+
+    if (bShareGeometry)
+    {
+        // A shape that is already in use needs no worker at all
+        if (FAsteroidSharedMeshPtr Existing = FAsteroidMeshRegistry::Find(ShapeKey))
+        {
+            ApplySharedMesh(Existing, Params);
+            return;
+        }
+    }
+
+    if (!bGenerateAsync)
+    {
+        if (bShareGeometry)
+        {
+            ApplySharedMesh(FAsteroidMeshRegistry::FindOrGenerate(Params), Params);
+            return;
+        }
+
+        FAsteroidMeshData MeshData;
+        FAsteroidGenerator::Generate(Params, MeshData);
+        ApplyGeneratedMesh(MeshData, MeshData.Stats);
+        return;
+    }
+
+    TSharedPtr<std::atomic<bool>, ESPMode::ThreadSafe> CancelFlag = MakeShared<std::atomic<bool>, ESPMode::ThreadSafe>(false);
+    GenerationCancelFlag = CancelFlag;
+    const uint32 Serial = ++GenerationSerial;
+
+    UE::Tasks::ETaskPriority TaskPriority = UE::Tasks::ETaskPriority::Normal;
+    switch (GenerationPriority)
+    {
+    case EAsteroidGenerationPriority::Low:  TaskPriority = UE::Tasks::ETaskPriority::BackgroundNormal; break;
+    case EAsteroidGenerationPriority::High: TaskPriority = UE::Tasks::ETaskPriority::High; break;
+    default: break;
+    }
+
+    TWeakObjectPtr<AAsteroidActor> WeakThis(this);
+
+    if (bShareGeometry)
+    {
+        UE::Tasks::Launch(UE_SOURCE_LOCATION, [WeakThis, Serial, CancelFlag, Params = MoveTemp(Params)]()
+        {
+            FAsteroidSharedMeshPtr Mesh = FAsteroidMeshRegistry::FindOrGenerate(Params, CancelFlag.Get());
+            if (!Mesh.IsValid())
+            {
+                return;
+            }
+
+            AsyncTask(ENamedThreads::GameThread, [WeakThis, Serial, CancelFlag, Mesh, Params]()
+            {
+                AAsteroidActor* Self = WeakThis.Get();
+                if (Self && Self->AcceptGenerationResult(Serial, *CancelFlag))
+                {
+                    Self->ApplySharedMesh(Mesh, Params);
+                }
+            });
+        }, TaskPriority);
+        return;
+    }
+
+    UE::Tasks::Launch(UE_SOURCE_LOCATION, [WeakThis, Serial, CancelFlag, Params = MoveTemp(Params)]()
+    {
+        TSharedPtr<FAsteroidMeshData, ESPMode::ThreadSafe> MeshData = MakeShared<FAsteroidMeshData, ESPMode::ThreadSafe>();
+        if (!FAsteroidGenerator::Generate(Params, *MeshData, CancelFlag.Get()))
+        {
+            return;
+        }
+
+        // Only the mesh-section and collision hand-off touches the game thread
+        AsyncTask(ENamedThreads::GameThread, [WeakThis, Serial, CancelFlag, MeshData]()
+        {
+            AAsteroidActor* Self = WeakThis.Get();
+            if (Self && Self->AcceptGenerationResult(Serial, *CancelFlag))
+            {
+                Self->ApplyGeneratedMesh(*MeshData, MeshData->Stats);
+            }
+        });
+    }, TaskPriority);
+}
+
+bool AAsteroidActor::AcceptGenerationResult(uint32 Serial, const std::atomic<bool>& CancelFlag)
+{
+    if (CancelFlag.load() || GenerationSerial != Serial)
+    {
+        return false;
+    }
+
+    GenerationCancelFlag.Reset();
+    return true;
+}
+
+FAsteroidGenerationParams AAsteroidActor::MakeGenerationParams() const
+{
+    FAsteroidGenerationParams Params;
+
     // Pick global seed
     int32 UsedGlobalSeed = GlobalSeed;
     if (UsedGlobalSeed < 0)
     {
-        UsedGlobalSeed = FMath::Rand();
+        UsedGlobalSeed = FAsteroidRandom::MakeGlobalSeed();
     }
+    Params.GlobalSeed = UsedGlobalSeed;
+    Params.AsteroidId = AsteroidId;
 
     // Prepare per-layer seeds
-    TArray<int32> LayerSeeds;
-    LayerSeeds.Reserve(NoiseLayers.Num());
-    FRandomStream GlobalRand(UsedGlobalSeed);
-    for (int32 i = 0; i < NoiseLayers.Num(); ++i)
+    FAsteroidGenerator::ResolveLayerSeeds(UsedGlobalSeed, NoiseLayers, Params.LayerSeeds);
+
+    // Choose radius
+    Params.Radius = FAsteroidRandom::Range(FAsteroidRandomKey(UsedGlobalSeed, AsteroidId, 0, EAsteroidRandomPurpose::Radius), MinRadius, MaxRadius);
+
+    Params.Frequency = GeodesicFrequency > 0 ? GeodesicFrequency : FAsteroidGenerator::GetFrequencyForSubdivisions(Subdivisions);
+    Params.NoiseLayers = NoiseLayers;
+    Params.MaxDisplacementFraction = MaxDisplacementFraction;
+    Params.NoiseMode = NoiseMode;
+    Params.NormalWeighting = NormalWeighting;
+    Params.Density = Density;
+    return Params;
+}
+
+bool AAsteroidActor::GetDeterministicGenerationParams(FAsteroidGenerationParams& OutParams) const
+{
+    if (GlobalSeed < 0)
     {
-        int32 seed = NoiseLayers[i].Seed;
-        if (seed < 0)
-        {
-            // create deterministic but distinct per-layer seed
-            seed = GlobalRand.RandRange(0, INT32_MAX);
-        }
-        LayerSeeds.Add(seed);
+        return false;
     }
 
-    // Build normalized base icosphere
-    TArray<FVector> Vertices;
-    TArray<int32> Triangles;
-    BuildBaseIcosphere(Vertices, Triangles, Subdivisions);
+    OutParams = MakeGenerationParams();
+    return true;
+}
 
-    // Apply noise layers with independent seeds and clamp
-    ApplyNoiseLayers(Vertices, LayerSeeds, MaxDisplacementFraction);
+void AAsteroidActor::CancelPendingGeneration()
+{
+    if (GenerationCancelFlag.IsValid())
+    {
+        GenerationCancelFlag->store(true);
+        GenerationCancelFlag.Reset();
+    }
+}
 
-    // Normalize base mesh again to ensure radius==1 before scaling -> ensures volume calc correctness
-    NormalizeVertices(Vertices);
+// ------------------------- Pooling -------------------------
+void AAsteroidActor::CopyGenerationSettings(const AAsteroidActor& Source)
+{
+    Subdivisions = Source.Subdivisions;
+    GeodesicFrequency = Source.GeodesicFrequency;
+    MinRadius = Source.MinRadius;
+    MaxRadius = Source.MaxRadius;
+    Density = Source.Density;
+    GlobalSeed = Source.GlobalSeed;
+    AsteroidId = Source.AsteroidId;
+    NoiseLayers = Source.NoiseLayers;
+    MaxDisplacementFraction = Source.MaxDisplacementFraction;
+    NoiseMode = Source.NoiseMode;
+    NormalWeighting = Source.NormalWeighting;
+    bSkipUnusedVertexBuffers = Source.bSkipUnusedVertexBuffers;
+    bEnablePhysics = Source.bEnablePhysics;
+    bGenerateAsync = Source.bGenerateAsync;
+    GenerationPriority = Source.GenerationPriority;
+    bShareGeometry = Source.bShareGeometry;
+    bCookCollisionAsync = Source.bCookCollisionAsync;
+    ReducedHullVertices = Source.ReducedHullVertices;
+    MaxHullVertices = Source.MaxHullVertices;
+    HullTolerance = Source.HullTolerance;
+    CollisionPieces = Source.CollisionPieces;
+    CollisionRebuildInterval = Source.CollisionRebuildInterval;
+    bFracturable = Source.bFracturable;
+    FragmentCount = Source.FragmentCount;
+    FractureImpactSpeed = Source.FractureImpactSpeed;
+    MinCoreFraction = Source.MinCoreFraction;
 
-    // Choose radius
-    float ChosenRadius = FMath::RandRange(MinRadius, MaxRadius);
+    // Spawners may override the material; a recycled actor must not keep it
+    ProcMesh->SetMaterial(0, Source.ProcMesh->GetMaterial(0));
+}
 
-    // Scale to radius
-    for (FVector& V : Vertices)
+void AAsteroidActor::DeactivateForPool()
+{
+    bPooled = true;
+    CancelPendingGeneration();
+    UnregisterFromSubsystems();
+
+    // Drop momentum so it does not leak into the next use
+    if (ProcMesh->IsSimulatingPhysics())
     {
-        V *= ChosenRadius;
+        ProcMesh->SetPhysicsLinearVelocity(FVector::ZeroVector);
+        ProcMesh->SetPhysicsAngularVelocityInRadians(FVector::ZeroVector);
+        ProcMesh->SetSimulatePhysics(false);
     }
 
-    // Create mesh section without generating tri-mesh collision
-    CreateMeshFromData(Vertices, Triangles, false);
+    SetActorHiddenInGame(true);
+    SetActorEnableCollision(false);
+    SharedMesh.Reset();
+    FractureSet.Reset();
+    ++FractureSerial;
+    ++CollisionSerial;
+    ResetTierCollision();
+    ResetMeshEdit();
+}
 
-    // Build convex collision from the generated vertices
-    ProcMesh->ClearCollisionConvexMeshes();
-    ProcMesh->AddCollisionConvexMesh(Vertices);
-    ProcMesh->SetCollisionEnabled(ECollisionEnabled::QueryAndPhysics);
+void AAsteroidActor::ReactivateFromPool(const FTransform& Transform)
+{
+    bPooled = false;
+    bFractured = false;
 
-    // Calculate stats and set mass on procedural mesh
-    CalculateStats(ChosenRadius);
-    AsteroidStats.NoiseLayerSeeds = LayerSeeds; // record seeds for reproducibility
+    // Stay hidden until the new shape is applied, otherwise the old rock
+    // flashes up at the new location for a frame or two
+    bRevealOnApply = true;
+    SetActorTransform(Transform, false, nullptr, ETeleportType::ResetPhysics);
 
-    // If physics enabled, configure mass; procedural mesh may need SetSimulatePhysics on attached primitive in some setups
-    if (bEnablePhysics)
+    GenerateAsteroid();
+}
+
+// ------------------------- Mesh deformation -------------------------
+void AAsteroidActor::ResetMeshEdit()
+{
+    EditVertices.Empty();
+    EditNormals.Empty();
+    DirtyFirst = INDEX_NONE;
+    DirtyEnd = 0;
+    bCollisionDirty = false;
+    bMassDirty = false;
+    VertexVisitStamps.Empty();
+    TriangleVisitStamps.Empty();
+
+    if (UWorld* World = GetWorld())
     {
-        ProcMesh->SetSimulatePhysics(true);
-        ProcMesh->SetMassOverrideInKg(NAME_None, AsteroidStats.Mass, true);
+        World->GetTimerManager().ClearTimer(MeshFlushTimer);
+        World->GetTimerManager().ClearTimer(CollisionRebuildTimer);
     }
+}
 
-    // Broadcast event
-    OnAsteroidGenerated.Broadcast(AsteroidStats);
+bool AAsteroidActor::BeginMeshEdit()
+{
+    if (EditVertices.Num() > 0)
+    {
+        return true;
+    }
 
-    // Log
-    UE_LOG(LogTemp, Log, TEXT("Asteroid Generated: Radius=%.2f, Volume=%.6g m^3, Mass=%.6g kg"),
-        AsteroidStats.Radius, AsteroidStats.Volume, AsteroidStats.Mass);
+    const FProcMeshSection* Section = ProcMesh->GetProcMeshSection(0);
+    if (!Section || Section->ProcVertexBuffer.Num() == 0)
+    {
+        return false;
+    }
+
+    // The section already holds exactly what is on screen, shared or not
+    const int32 Count = Section->ProcVertexBuffer.Num();
+    EditVertices.SetNumUninitialized(Count);
+    EditNormals.SetNumUninitialized(Count);
+    for (int32 Index = 0; Index < Count; ++Index)
+    {
+        EditVertices[Index] = Section->ProcVertexBuffer[Index].Position;
+        EditNormals[Index] = Section->ProcVertexBuffer[Index].Normal;
+    }
+
+    // From here on this asteroid's shape is its own
+    SharedMesh.Reset();
+    return true;
 }
 
-// ------------------------- Geometry generation -------------------------
-void AAsteroidActor::BuildBaseIcosphere(TArray<FVector>& Vertices, TArray<int32>& Triangles, int32 SubdivisionsLevel)
+void AAsteroidActor::MarkMeshDirty(int32 FirstVertex, int32 Count, bool bAffectsCollision)
 {
-    Vertices.Empty();
-    Triangles.Empty();
-
-    // create icosahedron
-    const float t = (1.0f + FMath::Sqrt(5.0f)) / 2.0f;
-
-    Vertices.Add(FVector(-1,  t,  0));
-    Vertices.Add(FVector( 1,  t,  0));
-    Vertices.Add(FVector(-1, -t,  0));
-    Vertices.Add(FVector( 1, -t,  0));
-    Vertices.Add(FVector( 0, -1,  t));
-    Vertices.Add(FVector( 0,  1,  t));
-    Vertices.Add(FVector( 0, -1, -t));
-    Vertices.Add(FVector( 0,  1, -t));
-    Vertices.Add(FVector( t,  0, -1));
-    Vertices.Add(FVector( t,  0,  1));
-    Vertices.Add(FVector(-t,  0, -1));
-    Vertices.Add(FVector(-t,  0,  1));
-
-    // faces
-    int32 faceIndices[] = {
-        0,11,5, 0,5,1, 0,1,7, 0,7,10, 0,10,11,
-        1,5,9, 5,11,4, 11,10,2, 10,7,6, 7,1,8,
-        3,9,4, 3,4,2, 3,2,6, 3,6,8, 3,8,9,
-        4,9,5, 2,4,11, 6,2,10, 8,6,7, 9,8,1
-    };
+    const int32 First = FMath::Max(FirstVertex, 0);
+    const int32 End = FMath::Min(FirstVertex + Count, EditVertices.Num());
+    if (First >= End)
+    {
+        return;
+    }
+
+    DirtyFirst = DirtyFirst == INDEX_NONE ? First : FMath::Min(DirtyFirst, First);
+    DirtyEnd = FMath::Max(DirtyEnd, End);
 
-    const int32 FaceCount = sizeof(faceIndices) / (3 * sizeof(int32));
-    for (int32 i = 0; i < sizeof(faceIndices) / sizeof(int32); ++i)
+    UWorld* World = GetWorld();
+    if (!World)
     {
-        Triangles.Add(faceIndices[i]);
+        FlushMeshUpdate();
+        return;
     }
 
-    // normalize
-    NormalizeVertices(Vertices);
+    // Many edits in one frame become one upload
+    FTimerManager& Timers = World->GetTimerManager();
+    if (!Timers.IsTimerActive(MeshFlushTimer))
+    {
+        MeshFlushTimer = Timers.SetTimerForNextTick(this, &AAsteroidActor::FlushMeshUpdate);
+    }
 
-    // Subdivide
-    for (int32 i = 0; i < SubdivisionsLevel; ++i)
+    if (!bAffectsCollision)
     {
-        SubdivideIcosphere(Vertices, Triangles);
+        return;
     }
+    bCollisionDirty = true;
 
-    // Final normalization
-    NormalizeVertices(Vertices);
+    if (CollisionRebuildInterval >= 0.0f && !Timers.IsTimerActive(CollisionRebuildTimer))
+    {
+        const double Delay = LastCollisionRebuildTime + CollisionRebuildInterval - World->GetTimeSeconds();
+        if (Delay > 0.0)
+        {
+            Timers.SetTimer(CollisionRebuildTimer, this, &AAsteroidActor::RebuildCollision, (float)Delay, false);
+        }
+        else
+        {
+            CollisionRebuildTimer = Timers.SetTimerForNextTick(this, &AAsteroidActor::RebuildCollision);
+        }
+    }
 }
 
-void AAsteroidActor::SubdivideIcosphere(TArray<FVector>& Vertices, TArray<int32>& Triangles)
+bool AAsteroidActor::UpdateMeshVertices(int32 FirstVertex, TConstArrayView<FVector> Positions, TConstArrayView<FVector> Normals)
 {
-    TMap<int64, int32> middlePointIndexCache;
-    TArray<int32> newTriangles;
-    newTriangles.Reserve(Triangles.Num() * 4);
-
-    auto MakeKey = [](int32 a, int32 b) -> int64 {
-        int32 small = FMath::Min(a, b);
-        int32 large = FMath::Max(a, b);
-        return ( (int64)small << 32 ) | (uint32)large;
-    };
+    if (!BeginMeshEdit() || FirstVertex < 0 || FirstVertex + Positions.Num() > EditVertices.Num()
+        || (Normals.Num() > 0 && Normals.Num() != Positions.Num()))
+    {
+        return false;
+    }
 
-    for (int32 i = 0; i + 2 < Triangles.Num(); i += 3)
+    FMemory::Memcpy(EditVertices.GetData() + FirstVertex, Positions.GetData(), Positions.Num() * sizeof(FVector));
+    if (Normals.Num() > 0)
     {
-        int32 v1 = Triangles[i];
-        int32 v2 = Triangles[i+1];
-        int32 v3 = Triangles[i+2];
+        FMemory::Memcpy(EditNormals.GetData() + FirstVertex, Normals.GetData(), Normals.Num() * sizeof(FVector));
+    }
+
+    MarkMeshDirty(FirstVertex, Positions.Num());
+    return true;
+}
 
-        int32 a = GetMiddlePoint(v1, v2, Vertices, middlePointIndexCache);
-        int32 b = GetMiddlePoint(v2, v3, Vertices, middlePointIndexCache);
-        int32 c = GetMiddlePoint(v3, v1, Vertices, middlePointIndexCache);
+bool AAsteroidActor::SetMeshVertexRange(int32 FirstVertex, const TArray<FVector>& Positions, const TArray<FVector>& Normals)
+{
+    return UpdateMeshVertices(FirstVertex, Positions, Normals);
+}
 
-        newTriangles.Add(v1); newTriangles.Add(a); newTriangles.Add(c);
-        newTriangles.Add(v2); newTriangles.Add(b); newTriangles.Add(a);
-        newTriangles.Add(v3); newTriangles.Add(c); newTriangles.Add(b);
-        newTriangles.Add(a);  newTriangles.Add(b); newTriangles.Add(c);
+void AAsteroidActor::FlushMeshUpdate()
+{
+    if (DirtyFirst == INDEX_NONE)
+    {
+        return;
     }
 
-    Triangles = MoveTemp(newTriangles);
+    // UpdateMeshSection takes whole arrays, but the editable copy is kept
+    // current so only the dirty range was ever touched on the CPU. Empty
+    // UV/colour/tangent arrays leave those channels alone.
+    if (ProcMesh->GetProcMeshSection(0))
+    {
+        ProcMesh->UpdateMeshSection(0, EditVertices, EditNormals, TArray<FVector2D>(), TArray<FColor>(), TArray<FProcMeshTangent>());
+    }
+
+    DirtyFirst = INDEX_NONE;
+    DirtyEnd = 0;
 }
 
-// Return index of middle point and create if needed
-int32 AAsteroidActor::GetMiddlePoint(int32 p1, int32 p2, TArray<FVector>& Vertices, TMap<int64, int32>& Cache)
+void AAsteroidActor::RebuildCollision()
 {
-    int32 small = FMath::Min(p1, p2);
-    int32 large = FMath::Max(p1, p2);
-    int64 key = ((int64)small << 32) | (uint32)large;
+    if (UWorld* World = GetWorld())
+    {
+        World->GetTimerManager().ClearTimer(CollisionRebuildTimer);
+        LastCollisionRebuildTime = World->GetTimeSeconds();
+    }
+
+    if (!bCollisionDirty || EditVertices.Num() == 0 || !MeshTopology.IsValid())
+    {
+        return;
+    }
+    bCollisionDirty = false;
+
+    // Mining changes the mass; the override applies to the live body
+    if (bMassDirty && bEnablePhysics)
+    {
+        ProcMesh->SetMassOverrideInKg(NAME_None, AsteroidStats.Mass, true);
+    }
+    bMassDirty = false;
+
+    // The deformed hull is unique to this asteroid, so it bypasses the
+    // cache; a cook still in flight for the undeformed shape or an older
+    // deformation must not replace it. The body keeps its current hull
+    // until the new one is ready.
+    const uint32 Serial = ++CollisionSerial;
+    bDeformedCollision = true;
+    DeformedCollision.Reset();
+    ResetTierCollision();
+
+    TSharedPtr<FAsteroidMeshData, ESPMode::ThreadSafe> Source = MakeShared<FAsteroidMeshData, ESPMode::ThreadSafe>();
+    Source->Topology = MeshTopology;
+    Source->Vertices = EditVertices;
+
+    const float Radius = MeshSpaceRadius;
+    const int32 HullVertices = MaxHullVertices;
+    const float Tolerance = HullTolerance;
+    const int32 Pieces = CollisionPieces;
 
-    int32* Found = Cache.Find(key);
-    if (Found)
+    if (!bCookCollisionAsync)
     {
-        return *Found;
+        DeformedCollision = FAsteroidCollisionCache::CookUncached(Source->Vertices, Source->GetTriangles(), Radius, HullVertices, Tolerance, Pieces);
+        if (DeformedCollision.IsValid() && CollisionLOD != EAsteroidCollisionLOD::Sphere)
+        {
+            ProcMesh->SetCookedCollision(DeformedCollision);
+        }
+        return;
     }
 
-    FVector point1 = Vertices[p1];
-    FVector point2 = Vertices[p2];
-    FVector middle = (point1 + point2) * 0.5f;
-    middle.Normalize();
+    TWeakObjectPtr<AAsteroidActor> WeakThis(this);
+    UE::Tasks::Launch(UE_SOURCE_LOCATION, [WeakThis, Serial, Source, Radius, HullVertices, Tolerance, Pieces]()
+    {
+        FAsteroidCollisionShapePtr Shape = FAsteroidCollisionCache::CookUncached(Source->Vertices, Source->GetTriangles(), Radius, HullVertices, Tolerance, Pieces);
+        if (!Shape.IsValid())
+        {
+            return;
+        }
 
-    int32 i = Vertices.Add(middle);
-    Cache.Add(key, i);
-    return i;
+        AsyncTask(ENamedThreads::GameThread, [WeakThis, Serial, Shape]()
+        {
+            // Further edits, a new mesh or the pool may have replaced the one this was cooked for
+            AAsteroidActor* Self = WeakThis.Get();
+            if (Self && Self->CollisionSerial == Serial)
+            {
+                Self->DeformedCollision = Shape;
+                if (Self->CollisionLOD != EAsteroidCollisionLOD::Sphere)
+                {
+                    Self->ProcMesh->SetCookedCollision(Shape);
+                }
+            }
+        });
+    }, UE::Tasks::ETaskPriority::BackgroundNormal);
 }
 
-void AAsteroidActor::NormalizeVertices(TArray<FVector>& Vertices)
+uint32 AAsteroidActor::NextVisitStamp()
 {
-    for (FVector& V : Vertices)
+    if (++VisitStamp == 0)
     {
-        V.Normalize();
+        FMemory::Memzero(VertexVisitStamps.GetData(), VertexVisitStamps.Num() * sizeof(uint32));
+        FMemory::Memzero(TriangleVisitStamps.GetData(), TriangleVisitStamps.Num() * sizeof(uint32));
+        VisitStamp = 1;
     }
+    return VisitStamp;
 }
 
-// ------------------------- Noise / Deformation -------------------------
-void AAsteroidActor::ApplyNoiseLayers(TArray<FVector>& Vertices, const TArray<int32>& LayerSeeds, float MaxDisplacementFrac)
+double AAsteroidActor::CarveCrater(FVector WorldCenter, float Radius, float Depth)
 {
-    if (Vertices.Num() == 0) return;
+    if (Radius <= 0.0f || Depth <= 0.0f || bFractured || !MeshTopology.IsValid() || !BeginMeshEdit())
+    {
+        return 0.0;
+    }
+
+    const FAsteroidIcosphereTopology& Topology = *MeshTopology;
+    const TArray<int32>& Triangles = Topology.Triangles;
+    if (Topology.UnitPositions.Num() != EditVertices.Num())
+    {
+        return 0.0;
+    }
+
+    // Work in mesh space; asteroid scale is uniform
+    const FTransform& Transform = GetActorTransform();
+    const double Scale = Transform.GetScale3D().GetAbsMax();
+    if (Scale <= SMALL_NUMBER)
+    {
+        return 0.0;
+    }
+    const FVector Center = Transform.InverseTransformPosition(WorldCenter);
+    const double LocalRadius = Radius / Scale;
+    const double LocalDepth = Depth / Scale;
+    const double CoreRadius = MinCoreFraction * AsteroidStats.Radius / Scale;
+
+    // Stamp arrays are sized once per edited mesh; every crater after that
+    // costs only what it touches
+    if (VertexVisitStamps.Num() != EditVertices.Num())
+    {
+        VertexVisitStamps.Init(0, EditVertices.Num());
+        TriangleVisitStamps.Init(0, Triangles.Num() / 3);
+        VisitStamp = 0;
+    }
+
+    auto IsInside = [this, &Center, LocalRadius](int32 Vertex)
+    {
+        return FVector::DistSquared(EditVertices[Vertex], Center) <= LocalRadius * LocalRadius;
+    };
+
+    // Flood fill from the vertex under the crater; if the crater is smaller
+    // than the vertex spacing the start may miss, so try its one-ring too
+    const uint32 VertexStamp = NextVisitStamp();
+    TArray<int32, TInlineAllocator<256>> Affected;
+    const int32 Start = FAsteroidGenerator::FindNearestVertex(Topology, FVector3f(Center.GetSafeNormal()));
+    if (Start == INDEX_NONE)
+    {
+        return 0.0;
+    }
+    VertexVisitStamps[Start] = VertexStamp;
+
+    auto VisitNeighbours = [&](int32 Vertex)
+    {
+        for (int32 Row = Topology.VertexCornerOffsets[Vertex]; Row < Topology.VertexCornerOffsets[Vertex + 1]; ++Row)
+        {
+            const int32 Base = Topology.VertexCorners[Row] / 3 * 3;
+            for (int32 Corner = 0; Corner < 3; ++Corner)
+            {
+                const int32 Neighbour = Triangles[Base + Corner];
+                if (VertexVisitStamps[Neighbour] != VertexStamp)
+                {
+                    VertexVisitStamps[Neighbour] = VertexStamp;
+                    if (IsInside(Neighbour))
+                    {
+                        Affected.Add(Neighbour);
+                    }
+                }
+            }
+        }
+    };
 
-    // For each layer, apply per-vertex displacement
-    for (int32 layerIndex = 0; layerIndex < NoiseLayers.Num(); ++layerIndex)
+    if (IsInside(Start))
     {
-        const FNoiseLayer& Layer = NoiseLayers[layerIndex];
-        int32 seed = LayerSeeds.IsValidIndex(layerIndex) ? LayerSeeds[layerIndex] : FMath::Rand();
-        FRandomStream layerRand(seed);
+        Affected.Add(Start);
+    }
+    else
+    {
+        VisitNeighbours(Start);
+    }
+    for (int32 Head = 0; Head < Affected.Num(); ++Head)
+    {
+        VisitNeighbours(Affected[Head]);
+    }
 
-        // Prepare offsets to vary noise per-vertex
-        float ox = layerRand.FRand() * 1000.0f;
-        float oy = layerRand.FRand() * 1000.0f;
-        float oz = layerRand.FRand() * 1000.0f;
+    if (Affected.Num() == 0)
+    {
+        return 0.0;
+    }
 
-        // Max absolute displacement in unit-sphere space
-        float maxDisplacement = MaxDisplacementFrac;
+    // Every triangle touching the crater, with its cone volume before the edit
+    const uint32 TriangleStamp = NextVisitStamp();
+    TArray<int32, TInlineAllocator<512>> AffectedTriangles;
+    for (const int32 Vertex : Affected)
+    {
+        for (int32 Row = Topology.VertexCornerOffsets[Vertex]; Row < Topology.VertexCornerOffsets[Vertex + 1]; ++Row)
+        {
+            const int32 Triangle = Topology.VertexCorners[Row] / 3;
+            if (TriangleVisitStamps[Triangle] != TriangleStamp)
+            {
+                TriangleVisitStamps[Triangle] = TriangleStamp;
+                AffectedTriangles.Add(Triangle);
+            }
+        }
+    }
 
-        for (int32 i = 0; i < Vertices.Num(); ++i)
+    auto SumConeVolumes = [this, &Triangles, &AffectedTriangles]()
+    {
+        double Sum = 0.0;
+        for (const int32 Triangle : AffectedTriangles)
         {
-            FVector& V = Vertices[i];
+            const FVector& A = EditVertices[Triangles[Triangle * 3]];
+            const FVector& B = EditVertices[Triangles[Triangle * 3 + 1]];
+            const FVector& C = EditVertices[Triangles[Triangle * 3 + 2]];
+            Sum += FVector::DotProduct(A, FVector::CrossProduct(B, C)) / 6.0;
+        }
+        return Sum;
+    };
+    const double OldVolume = SumConeVolumes();
 
-            // sample Perlin noise in 3D by sampling FMath::PerlinNoise3D which expects FVector
-            FVector samplePoint = V * Layer.Scale + FVector(ox, oy, oz);
-            float nx = FMath::PerlinNoise3D(samplePoint + FVector(0.0f, 0.0f, 0.0f));
-            float ny = FMath::PerlinNoise3D(samplePoint + FVector(13.13f, 37.37f, 7.73f)); // arbitrary offsets for axis variation
-            float nz = FMath::PerlinNoise3D(samplePoint + FVector(97.97f, 21.21f, 55.55f));
+    // Radial push keeps the mesh star-shaped around its centre
+    for (const int32 Vertex : Affected)
+    {
+        FVector& Position = EditVertices[Vertex];
+        const double Length = Position.Size();
+        if (Length <= SMALL_NUMBER)
+        {
+            continue;
+        }
 
-            FVector offset = FVector(nx, ny, nz) * Layer.Intensity * 0.5f; // scale it down a bit
+        const double Falloff = 1.0 - FVector::DistSquared(Position, Center) / (LocalRadius * LocalRadius);
+        const double NewLength = FMath::Max(Length - LocalDepth * Falloff * Falloff, FMath::Min(Length, CoreRadius));
+        Position *= NewLength / Length;
+    }
+
+    const double NewVolume = SumConeVolumes();
+
+    // Normals of everything on the affected triangles: the crater plus its rim ring
+    const uint32 RingStamp = NextVisitStamp();
+    int32 RangeFirst = MAX_int32;
+    int32 RangeLast = INDEX_NONE;
+    for (const int32 Triangle : AffectedTriangles)
+    {
+        for (int32 Corner = 0; Corner < 3; ++Corner)
+        {
+            const int32 Vertex = Triangles[Triangle * 3 + Corner];
+            if (VertexVisitStamps[Vertex] == RingStamp)
+            {
+                continue;
+            }
+            VertexVisitStamps[Vertex] = RingStamp;
+            EditNormals[Vertex] = FAsteroidGenerator::ComputeVertexNormal(EditVertices, Topology, NormalWeighting, Vertex);
+            RangeFirst = FMath::Min(RangeFirst, Vertex);
+            RangeLast = FMath::Max(RangeLast, Vertex);
+        }
+    }
+
+    // Cone volumes share the mesh winding's sign, so this is positive for material removed
+    const double LocalRemoved = OldVolume >= 0.0 ? OldVolume - NewVolume : NewVolume - OldVolume;
+    const double RemovedVolume = LocalRemoved * Scale * Scale * Scale;
+    const double MassPerVolume = AsteroidStats.Volume > 0.0 ? AsteroidStats.Mass / AsteroidStats.Volume : Density;
+    const double RemovedMass = RemovedVolume * MassPerVolume;
+
+    AsteroidStats.Volume = FMath::Max(AsteroidStats.Volume - RemovedVolume, 0.0);
+    AsteroidStats.Mass = FMath::Max(AsteroidStats.Mass - RemovedMass, 0.0);
+    bMassDirty = true;
+
+    MarkMeshDirty(RangeFirst, RangeLast - RangeFirst + 1);
+    return RemovedMass;
+}
 
-            // Apply displacement along normal direction to preserve sphere-like behavior
-            FVector normal = V;
-            normal.Normalize();
+// ------------------------- Fracture -------------------------
+void AAsteroidActor::RequestFractureSet(const FAsteroidMeshData& MeshData)
+{
+    const uint32 Serial = ++FractureSerial;
+    FractureSet = FAsteroidFracture::Find(ShapeKey, FragmentCount);
+    if (FractureSet.IsValid() || !MeshData.Topology.IsValid())
+    {
+        return;
+    }
 
-            float displacement = FVector::DotProduct(offset, normal); // scalar displacement along normal
-            displacement = FMath::Clamp(displacement, -maxDisplacement, maxDisplacement);
+    const float ToReference = 1.0f / FractureMeshScale;
+    if (!bGenerateAsync)
+    {
+        FractureSet = FAsteroidFracture::FindOrBuild(ShapeKey, FragmentCount, MeshData.Vertices, MeshData.Normals, *MeshData.Topology, ToReference);
+        return;
+    }
 
-            V = V + normal * displacement;
+    // The worker keeps the geometry alive: shared meshes by reference, private ones by copy
+    TSharedPtr<const FAsteroidMeshData, ESPMode::ThreadSafe> Source;
+    if (SharedMesh.IsValid())
+    {
+        Source = TSharedPtr<const FAsteroidMeshData, ESPMode::ThreadSafe>(SharedMesh, &SharedMesh->MeshData);
+    }
+    else
+    {
+        Source = MakeShared<FAsteroidMeshData, ESPMode::ThreadSafe>(MeshData);
+    }
+
+    TWeakObjectPtr<AAsteroidActor> WeakThis(this);
+    UE::Tasks::Launch(UE_SOURCE_LOCATION, [WeakThis, Serial, Source, Key = ShapeKey, Count = FragmentCount, ToReference]()
+    {
+        FAsteroidFractureSetPtr Set = FAsteroidFracture::FindOrBuild(Key, Count, Source->Vertices, Source->Normals, *Source->Topology, ToReference);
+        if (!Set.IsValid())
+        {
+            return;
         }
+
+        AsyncTask(ENamedThreads::GameThread, [WeakThis, Serial, Set]()
+        {
+            // A newer mesh or the pool may have replaced the one this was built for
+            AAsteroidActor* Self = WeakThis.Get();
+            if (Self && Self->FractureSerial == Serial)
+            {
+                Self->FractureSet = Set;
+            }
+        });
+    }, UE::Tasks::ETaskPriority::BackgroundNormal);
+}
+
+// ------------------------- Collision -------------------------
+void AAsteroidActor::SetCollisionLOD(EAsteroidCollisionLOD LOD)
+{
+    if (LOD == CollisionLOD)
+    {
+        return;
+    }
+    CollisionLOD = LOD;
+
+    // Before the first mesh, or once broken, there is no body to change
+    if (MeshTopology.IsValid() && !bFractured)
+    {
+        RequestCollision(nullptr);
     }
 }
 
-// ------------------------- Mesh creation -------------------------
-void AAsteroidActor::CreateMeshFromData(const TArray<FVector>& Vertices, const TArray<int32>& Triangles, bool bCreateCollision)
+TSharedPtr<const FAsteroidMeshData, ESPMode::ThreadSafe> AAsteroidActor::MakeCollisionSource(const FAsteroidMeshData* MeshData) const
+{
+    // Shared meshes by reference, private ones by copy
+    if (SharedMesh.IsValid())
+    {
+        return TSharedPtr<const FAsteroidMeshData, ESPMode::ThreadSafe>(SharedMesh, &SharedMesh->MeshData);
+    }
+    if (MeshData)
+    {
+        return MakeShared<FAsteroidMeshData, ESPMode::ThreadSafe>(*MeshData);
+    }
+
+    // A private mesh is not kept after it is applied; read it back from the section
+    const FProcMeshSection* Section = ProcMesh->GetProcMeshSection(0);
+    if (!Section || !MeshTopology.IsValid())
+    {
+        return nullptr;
+    }
+
+    TSharedPtr<FAsteroidMeshData, ESPMode::ThreadSafe> Source = MakeShared<FAsteroidMeshData, ESPMode::ThreadSafe>();
+    Source->Topology = MeshTopology;
+    Source->Vertices.Reserve(Section->ProcVertexBuffer.Num());
+    for (const FProcMeshVertex& Vertex : Section->ProcVertexBuffer)
+    {
+        Source->Vertices.Add(Vertex.Position);
+    }
+    return Source;
+}
+
+void AAsteroidActor::RequestCollision(const FAsteroidMeshData* MeshData)
 {
-    // Compute normals (simple approach)
-    TArray<FVector> Normals;
-    Normals.SetNumZeroed(Vertices.Num());
-
-    // Zeroed tangents/uvs/colors for simplicity
-    TArray<FVector2D> UVs;
-    UVs.SetNumZeroed(Vertices.Num());
-    TArray<FProcMeshTangent> Tangents;
-    Tangents.SetNumZeroed(Vertices.Num());
-    TArray<FColor> Colors;
-    Colors.SetNumZeroed(Vertices.Num());
-
-    // Compute face normals and accumulate
-    for (int32 i = 0; i + 2 < Triangles.Num(); i += 3)
-    {
-        int32 i0 = Triangles[i];
-        int32 i1 = Triangles[i+1];
-        int32 i2 = Triangles[i+2];
-
-        if (!Vertices.IsValidIndex(i0) || !Vertices.IsValidIndex(i1) || !Vertices.IsValidIndex(i2))
+    const uint32 Serial = ++CollisionSerial;
+
+    // Shared geometry, edited or not, is at the reference radius and maps to bucket 0
+    const float VertexRadius = MeshSpaceRadius;
+    if (CollisionLOD == EAsteroidCollisionLOD::Sphere)
+    {
+        ProcMesh->SetSphereCollision(VertexRadius);
+        return;
+    }
+
+    // A deformed asteroid's hull is its own; there is no cached reduced tier for it
+    if (bDeformedCollision)
+    {
+        if (DeformedCollision.IsValid())
         {
-            continue;
+            ProcMesh->SetCookedCollision(DeformedCollision);
+        }
+        else
+        {
+            // The cook this request just superseded; start it again
+            bCollisionDirty = true;
+            RebuildCollision();
+        }
+        return;
+    }
+
+    const bool bReduced = CollisionLOD == EAsteroidCollisionLOD::Reduced;
+    const FAsteroidCollisionKey Key(ShapeKey, FAsteroidCollisionCache::GetRadiusBucket(VertexRadius),
+        bReduced ? ReducedHullVertices : MaxHullVertices, HullTolerance, bReduced ? 1 : CollisionPieces);
+
+    // A tier this mesh already used is still held here, even if no other
+    // asteroid keeps the cache entry alive
+    const int32 Tier = bReduced ? 0 : 1;
+    if (TierCollision[Tier].IsValid() && TierCollision[Tier]->Key == Key)
+    {
+        ProcMesh->SetCookedCollision(TierCollision[Tier]);
+        return;
+    }
+    if (FAsteroidCollisionShapePtr Shape = FAsteroidCollisionCache::Find(Key))
+    {
+        TierCollision[Tier] = Shape;
+        ProcMesh->SetCookedCollision(Shape);
+        return;
+    }
+
+    TSharedPtr<const FAsteroidMeshData, ESPMode::ThreadSafe> Source = MakeCollisionSource(MeshData);
+    if (!Source.IsValid())
+    {
+        ProcMesh->SetSphereCollision(VertexRadius);
+        return;
+    }
+
+    if (!bCookCollisionAsync)
+    {
+        if (FAsteroidCollisionShapePtr Shape = FAsteroidCollisionCache::FindOrCook(Key, Source->Vertices, Source->GetTriangles(), VertexRadius))
+        {
+            TierCollision[Tier] = Shape;
+            ProcMesh->SetCookedCollision(Shape);
         }
+        else
+        {
+            ProcMesh->SetSphereCollision(VertexRadius);
+        }
+        return;
+    }
 
-        FVector v0 = Vertices[i0];
-        FVector v1 = Vertices[i1];
-        FVector v2 = Vertices[i2];
+    // A new mesh starts on the sphere proxy; a tier change keeps the
+    // current body until the new one is ready
+    if (MeshData)
+    {
+        ProcMesh->SetSphereCollision(VertexRadius);
+    }
+
+    TWeakObjectPtr<AAsteroidActor> WeakThis(this);
+    UE::Tasks::Launch(UE_SOURCE_LOCATION, [WeakThis, Serial, Source, Key, VertexRadius, Tier]()
+    {
+        FAsteroidCollisionShapePtr Shape = FAsteroidCollisionCache::FindOrCook(Key, Source->Vertices, Source->GetTriangles(), VertexRadius);
+        if (!Shape.IsValid())
+        {
+            return;
+        }
 
-        FVector faceNormal = FVector::CrossProduct(v1 - v0, v2 - v0).GetSafeNormal();
-        Normals[i0] += faceNormal;
-        Normals[i1] += faceNormal;
-        Normals[i2] += faceNormal;
+        AsyncTask(ENamedThreads::GameThread, [WeakThis, Serial, Shape, Tier]()
+        {
+            // A newer mesh, tier, deformation or the pool may have replaced the one this was cooked for
+            AAsteroidActor* Self = WeakThis.Get();
+            if (Self && Self->CollisionSerial == Serial)
+            {
+                Self->TierCollision[Tier] = Shape;
+                Self->ProcMesh->SetCookedCollision(Shape);
+            }
+        });
+    }, UE::Tasks::ETaskPriority::BackgroundNormal);
+}
+
+FTransform AAsteroidActor::GetFractureTransform() const
+{
+    FTransform Transform = GetActorTransform();
+    Transform.SetScale3D(Transform.GetScale3D() * FractureMeshScale);
+    return Transform;
+}
+
+void AAsteroidActor::MarkFractured(const FVector& ImpactPoint)
+{
+    if (bFractured)
+    {
+        return;
+    }
+    bFractured = true;
+
+    OnAsteroidFractured.Broadcast(ImpactPoint);
+
+    UnregisterFromSubsystems();
+    if (ProcMesh->IsSimulatingPhysics())
+    {
+        ProcMesh->SetSimulatePhysics(false);
     }
+    SetActorHiddenInGame(true);
+    SetActorEnableCollision(false);
+    ResetMeshEdit();
+}
 
-    for (FVector& N : Normals)
+void AAsteroidActor::HandleProcMeshHit(UPrimitiveComponent* HitComponent, AActor* OtherActor, UPrimitiveComponent* OtherComp, FVector NormalImpulse, const FHitResult& Hit)
+{
+    if (!bFracturable || bFractured || !FractureSet.IsValid() || AsteroidStats.Mass <= 0.0)
     {
-        N.Normalize();
+        return;
     }
 
-    // Create mesh section (section 0)
-    ProcMesh->CreateMeshSection(0, Vertices, Triangles, Normals, UVs, Colors, Tangents, bCreateCollision);
+    // Impulse over the reduced mass is the change in closing speed it caused
+    double InverseMass = 1.0 / AsteroidStats.Mass;
+    if (OtherComp && OtherComp->IsSimulatingPhysics() && OtherComp->GetMass() > 0.0f)
+    {
+        InverseMass += 1.0 / OtherComp->GetMass();
+    }
+    if (NormalImpulse.Size() * InverseMass < FractureImpactSpeed)
+    {
+        return;
+    }
 
-    if (bCreateCollision)
+    // Breaking inside the physics callback is not safe; the subsystem does it next tick
+    if (UAsteroidFractureSubsystem* Fracture = UAsteroidFractureSubsystem::Get(this))
     {
-        ProcMesh->SetCollisionEnabled(ECollisionEnabled::QueryAndPhysics);
-        ProcMesh->SetCollisionObjectType(ECC_WorldDynamic);
+        Fracture->RequestFracture(this, Hit.ImpactPoint);
     }
 }
 
-// ------------------------- Stats -------------------------
-void AAsteroidActor::CalculateStats(float ChosenRadius)
+// ------------------------- Mesh creation -------------------------
+void AAsteroidActor::ApplySharedMesh(const FAsteroidSharedMeshPtr& Mesh, const FAsteroidGenerationParams& Params)
 {
-    // radius in meters (user-provided units assumed m; adjust if your unit scale differs)
-    AsteroidStats.Radius = ChosenRadius;
+    if (!Mesh.IsValid())
+    {
+        return;
+    }
+
+    SharedMesh = Mesh;
 
-    AsteroidStats.Volume = CalculateVolumeFromRadius(ChosenRadius);
-    AsteroidStats.Mass = AsteroidStats.Volume * (double)Density;
+    // Shape is size-independent; the radius lives in the transform
+    SetActorScale3D(FVector(Params.Radius / FAsteroidMeshRegistry::ReferenceRadius));
 
-    // Seeds are filled by caller after generation
-    AsteroidStats.NoiseLayerSeeds.Empty();
+    FAsteroidStats Stats;
+    FAsteroidGenerator::CalculateStats(Params.Radius, Params.Density, Stats);
+    Stats.NoiseLayerSeeds = Params.LayerSeeds;
+    Stats.GlobalSeed = Params.GlobalSeed;
+    Stats.AsteroidId = Params.AsteroidId;
+
+    ApplyGeneratedMesh(Mesh->MeshData, Stats);
 }
 
-double AAsteroidActor::CalculateVolumeFromRadius(double Radius) const
+void AAsteroidActor::ApplyGeneratedMesh(const FAsteroidMeshData& MeshData, const FAsteroidStats& Stats)
 {
-    // Volume of a sphere
-    return (4.0 / 3.0) * PI * Radius * Radius * Radius;
+    // A fresh shape replaces any deformation in progress
+    ResetMeshEdit();
+    MeshTopology = MeshData.Topology;
+
+    // A recycled asteroid with the same topology keeps its section buffers;
+    // only positions and normals change (empty UV/colour/tangent arrays are left alone)
+    const FProcMeshSection* Section = ProcMesh->GetProcMeshSection(0);
+    if (Section && Section->ProcVertexBuffer.Num() == MeshData.Vertices.Num() && Section->ProcIndexBuffer.Num() == MeshData.GetTriangles().Num())
+    {
+        ProcMesh->UpdateMeshSection(0, MeshData.Vertices, MeshData.Normals, TArray<FVector2D>(), TArray<FColor>(), TArray<FProcMeshTangent>());
+    }
+    else if (bSkipUnusedVertexBuffers)
+    {
+        // The generator produces no UVs, colours or tangents; empty arrays
+        // let the component fill in its defaults without three extra copies
+        ProcMesh->CreateMeshSection(0, MeshData.Vertices, MeshData.GetTriangles(), MeshData.Normals, TArray<FVector2D>(), TArray<FColor>(), TArray<FProcMeshTangent>(), false);
+    }
+    else
+    {
+        // Zeroed tangents/uvs/colors for simplicity
+        TArray<FVector2D> UVs;
+        UVs.SetNumZeroed(MeshData.Vertices.Num());
+        TArray<FProcMeshTangent> Tangents;
+        Tangents.SetNumZeroed(MeshData.Vertices.Num());
+        TArray<FColor> Colors;
+        Colors.SetNumZeroed(MeshData.Vertices.Num());
+
+        // Create mesh section (section 0) without generating tri-mesh collision
+        ProcMesh->CreateMeshSection(0, MeshData.Vertices, MeshData.GetTriangles(), MeshData.Normals, UVs, Colors, Tangents, false);
+    }
+
+    ProcMesh->SetCollisionEnabled(ECollisionEnabled::QueryAndPhysics);
+    ProcMesh->SetNotifyRigidBodyCollision(bFracturable);
+
+    if (bRevealOnApply)
+    {
+        bRevealOnApply = false;
+        SetActorHiddenInGame(false);
+        SetActorEnableCollision(true);
+    }
+
+    AsteroidStats = Stats;
+
+    // Shared geometry is built at the reference radius and scaled by the
+    // actor; private geometry is built at full size whatever the actor scale.
+    // Edits keep the vertices in whichever space they started in.
+    MeshSpaceRadius = SharedMesh.IsValid() ? FAsteroidMeshRegistry::ReferenceRadius : AsteroidStats.Radius;
+
+    // Hulls held for the old shape, deformed or not, no longer fit
+    bDeformedCollision = false;
+    DeformedCollision.Reset();
+    ResetTierCollision();
+
+    // Start at the detail ship distance calls for, so a far asteroid never
+    // cooks a hull it will not use
+    UAsteroidPhysicsSubsystem* Physics = bEnablePhysics ? UAsteroidPhysicsSubsystem::Get(this) : nullptr;
+    CollisionLOD = Physics ? Physics->GetInitialCollisionLOD(this) : EAsteroidCollisionLOD::Full;
+
+    // Convex collision from the cache, or a sphere proxy while it cooks
+    RequestCollision(&MeshData);
+
+    // Fracture sets live at the reference radius, like shared geometry
+    FractureMeshScale = MeshSpaceRadius / FAsteroidMeshRegistry::ReferenceRadius;
+    FractureSet.Reset();
+    if (bFracturable)
+    {
+        RequestFractureSet(MeshData);
+    }
+
+    if (UAsteroidSpatialSubsystem* Spatial = UAsteroidSpatialSubsystem::Get(this))
+    {
+        Spatial->RegisterAsteroid(this);
+    }
+
+    // If physics enabled, configure mass; procedural mesh may need SetSimulatePhysics on attached primitive in some setups
+    if (bEnablePhysics)
+    {
+        ProcMesh->SetSimulatePhysics(true);
+        ProcMesh->SetMassOverrideInKg(NAME_None, AsteroidStats.Mass, true);
+
+        // Far from every ship this goes straight back to kinematic
+        if (Physics)
+        {
+            Physics->RegisterAsteroid(this);
+        }
+    }
+
+    // Broadcast event
+    OnAsteroidGenerated.Broadcast(AsteroidStats);
+
+    // Log
+    UE_LOG(LogTemp, Log, TEXT("Asteroid Generated: Radius=%.2f, Volume=%.6g m^3, Mass=%.6g kg"),
+        AsteroidStats.Radius, AsteroidStats.Volume, AsteroidStats.Mass);
 }
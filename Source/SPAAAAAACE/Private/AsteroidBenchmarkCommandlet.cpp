@@ -0,0 +1,475 @@
+/**
+ * AsteroidBenchmarkCommandlet Implementation
+ *
+ * Key Systems:
+ * - Scratch arena, LLM-tagged heap and physical memory deltas for
+ *   allocation statistics
+ * - Steady-state heap check of Generate (scratch blocks, and LLM-tracked
+ *   heap bytes when LLM is enabled)
+ * - Topology stages replayed from scratch, then FAsteroidGenerator::Generate
+ *   itself and the AAsteroidActor mesh / collision hand-off
+ * - Percentile summary and CSV / JSON writers
+ */
+
+#include "AsteroidBenchmarkCommandlet.h"
+#include "AsteroidCollisionCache.h"
+#include "AsteroidGenerator.h"
+#include "AsteroidMeshComponent.h"
+#include "AsteroidScratch.h"
+#include "HAL/LowLevelMemTracker.h"
+#include "HAL/PlatformMemory.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/DateTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "UObject/Package.h"
+#include "UObject/StrongObjectPtr.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogAsteroidBenchmark, Log, All);
+LLM_DEFINE_TAG(AsteroidBenchmark);
+
+namespace AsteroidBenchmarkPrivate
+{
+    enum class EStage : uint8
+    {
+        Icosphere,
+        Adjacency,
+        Generate,
+        MeshSection,
+        ConvexCooking,
+        Count
+    };
+
+    static const TCHAR* StageNames[] =
+    {
+        TEXT("Icosphere"),
+        TEXT("Adjacency"),
+        TEXT("Generate"),
+        TEXT("MeshSection"),
+        TEXT("ConvexCooking")
+    };
+    static_assert(UE_ARRAY_COUNT(StageNames) == (int32)EStage::Count, "One name per stage");
+
+    /** Samples of one stage within one matrix cell */
+    struct FStageSamples
+    {
+        TArray<double> Milliseconds;
+        TArray<int64> ScratchAllocations;
+        TArray<int64> ScratchBytes;
+        TArray<int64> ScratchBlocks;
+
+        /** Net LLM-tagged heap bytes the stage left allocated; empty when LLM is off */
+        TArray<int64> HeapBytes;
+    };
+
+    /** One cell of the matrix */
+    struct FCellResult
+    {
+        int32 Subdivisions = 0;
+        int32 Layers = 0;
+        int32 Vertices = 0;
+        bool bFixedKernel = false;
+        int64 PhysicalGrowthBytes = 0;
+
+        /** Heap blocks the scratch arena took during the steady-state Generate runs */
+        int64 SteadyScratchBlocks = 0;
+
+        /** Net LLM-tracked heap bytes of those runs, when LLM is enabled */
+        TOptional<int64> SteadyHeapBytes;
+
+        FStageSamples Stages[(int32)EStage::Count];
+    };
+
+    /** Summary of one stage within one cell */
+    struct FStageSummary
+    {
+        double MeanMs = 0.0;
+        double P50Ms = 0.0;
+        double P90Ms = 0.0;
+        double P99Ms = 0.0;
+        double MaxMs = 0.0;
+        double MeanScratchAllocations = 0.0;
+        double MeanScratchBytes = 0.0;
+        double MeanScratchBlocks = 0.0;
+        TOptional<double> MeanHeapBytes;
+    };
+
+    /** Nearest-rank percentile of sorted samples */
+    static double Percentile(const TArray<double>& Sorted, double Fraction)
+    {
+        if (Sorted.Num() == 0)
+        {
+            return 0.0;
+        }
+        const int32 Rank = FMath::Clamp(FMath::CeilToInt(Fraction * Sorted.Num()) - 1, 0, Sorted.Num() - 1);
+        return Sorted[Rank];
+    }
+
+    static FStageSummary Summarize(const FStageSamples& Samples)
+    {
+        FStageSummary Summary;
+        const int32 Count = Samples.Milliseconds.Num();
+        if (Count == 0)
+        {
+            return Summary;
+        }
+
+        TArray<double> Sorted = Samples.Milliseconds;
+        Sorted.Sort();
+        for (int32 Index = 0; Index < Count; ++Index)
+        {
+            Summary.MeanMs += Sorted[Index];
+            Summary.MeanScratchAllocations += Samples.ScratchAllocations[Index];
+            Summary.MeanScratchBytes += Samples.ScratchBytes[Index];
+            Summary.MeanScratchBlocks += Samples.ScratchBlocks[Index];
+        }
+        Summary.MeanMs /= Count;
+        Summary.MeanScratchAllocations /= Count;
+        Summary.MeanScratchBytes /= Count;
+        Summary.MeanScratchBlocks /= Count;
+        if (Samples.HeapBytes.Num() == Count)
+        {
+            double HeapBytes = 0.0;
+            for (const int64 Bytes : Samples.HeapBytes)
+            {
+                HeapBytes += Bytes;
+            }
+            Summary.MeanHeapBytes = HeapBytes / Count;
+        }
+        Summary.P50Ms = Percentile(Sorted, 0.50);
+        Summary.P90Ms = Percentile(Sorted, 0.90);
+        Summary.P99Ms = Percentile(Sorted, 0.99);
+        Summary.MaxMs = Sorted.Last();
+        return Summary;
+    }
+
+    /** Heap bytes LLM attributes to the benchmark tag, or nothing when LLM is off */
+    static TOptional<int64> GetTaggedHeapBytes()
+    {
+#if ENABLE_LOW_LEVEL_MEM_TRACKER
+        if (FLowLevelMemTracker::IsEnabled())
+        {
+            // Per-thread counts are only folded in by the per-frame update
+            FLowLevelMemTracker& Tracker = FLowLevelMemTracker::Get();
+            Tracker.UpdateStatsPerFrame();
+            return Tracker.GetTagAmountForTracker(ELLMTracker::Default, FName(TEXT("AsteroidBenchmark")), ELLMTagSet::None);
+        }
+#endif
+        return TOptional<int64>();
+    }
+
+    static FString FormatOptional(const TOptional<int64>& Value, const TCHAR* Missing)
+    {
+        return Value.IsSet() ? FString::Printf(TEXT("%lld"), Value.GetValue()) : FString(Missing);
+    }
+
+    static FString FormatOptional(const TOptional<double>& Value, const TCHAR* Missing)
+    {
+        return Value.IsSet() ? FString::Printf(TEXT("%.0f"), Value.GetValue()) : FString(Missing);
+    }
+
+    /** Parses "1+2+4" into integers, keeping Default if the switch is absent */
+    static TArray<int32> ParseIntList(const FString& Params, const TCHAR* Switch, TArray<int32> Default)
+    {
+        FString Value;
+        if (!FParse::Value(*Params, Switch, Value, false))
+        {
+            return Default;
+        }
+
+        TArray<FString> Parts;
+        Value.ParseIntoArray(Parts, TEXT("+"));
+        TArray<int32> Result;
+        for (const FString& Part : Parts)
+        {
+            Result.Add(FCString::Atoi(*Part));
+        }
+        return Result.Num() > 0 ? Result : Default;
+    }
+
+    /** Octave-style layer stack: each layer finer and weaker than the last */
+    static TArray<FNoiseLayer> MakeNoiseLayers(int32 Count)
+    {
+        TArray<FNoiseLayer> Layers;
+        for (int32 Index = 0; Index < Count; ++Index)
+        {
+            FNoiseLayer& Layer = Layers.AddDefaulted_GetRef();
+            Layer.Scale = 0.1f * (float)(1 << Index);
+            Layer.Intensity = 1.0f / (float)(1 << Index);
+            Layer.Seed = -1;
+        }
+        return Layers;
+    }
+
+    static FString WriteCsv(const FString& Label, const TArray<FCellResult>& Cells)
+    {
+        FString Out = TEXT("Label,Subdivisions,Layers,Vertices,Kernel,Stage,Samples,MeanMs,P50Ms,P90Ms,P99Ms,MaxMs,MeanScratchAllocs,MeanScratchBytes,MeanScratchBlocks,MeanHeapBytes,PhysicalGrowthBytes,SteadyScratchBlocks,SteadyHeapBytes\n");
+        for (const FCellResult& Cell : Cells)
+        {
+            for (int32 Stage = 0; Stage < (int32)EStage::Count; ++Stage)
+            {
+                const FStageSummary Summary = Summarize(Cell.Stages[Stage]);
+                Out += FString::Printf(TEXT("%s,%d,%d,%d,%s,%s,%d,%.4f,%.4f,%.4f,%.4f,%.4f,%.1f,%.0f,%.2f,%s,%lld,%lld,%s\n"),
+                    *Label, Cell.Subdivisions, Cell.Layers, Cell.Vertices, Cell.bFixedKernel ? TEXT("Fixed") : TEXT("Generic"), StageNames[Stage], Cell.Stages[Stage].Milliseconds.Num(),
+                    Summary.MeanMs, Summary.P50Ms, Summary.P90Ms, Summary.P99Ms, Summary.MaxMs,
+                    Summary.MeanScratchAllocations, Summary.MeanScratchBytes, Summary.MeanScratchBlocks, *FormatOptional(Summary.MeanHeapBytes, TEXT("untracked")), Cell.PhysicalGrowthBytes,
+                    Cell.SteadyScratchBlocks, *FormatOptional(Cell.SteadyHeapBytes, TEXT("untracked")));
+            }
+        }
+        return Out;
+    }
+
+    static FString WriteJson(const FString& Label, const TArray<FCellResult>& Cells, uint64 PeakPhysicalBytes)
+    {
+        FString Out = FString::Printf(TEXT("{\n  \"label\": \"%s\",\n  \"peakUsedPhysicalBytes\": %llu,\n  \"cells\": [\n"),
+            *Label.ReplaceCharWithEscapedChar(), PeakPhysicalBytes);
+        for (int32 CellIndex = 0; CellIndex < Cells.Num(); ++CellIndex)
+        {
+            const FCellResult& Cell = Cells[CellIndex];
+            Out += FString::Printf(TEXT("    {\n      \"subdivisions\": %d,\n      \"layers\": %d,\n      \"vertices\": %d,\n      \"fixedKernel\": %s,\n      \"physicalGrowthBytes\": %lld,\n      \"steadyScratchBlocks\": %lld,\n      \"steadyHeapBytes\": %s,\n      \"stages\": {\n"),
+                Cell.Subdivisions, Cell.Layers, Cell.Vertices, Cell.bFixedKernel ? TEXT("true") : TEXT("false"), Cell.PhysicalGrowthBytes,
+                Cell.SteadyScratchBlocks, *FormatOptional(Cell.SteadyHeapBytes, TEXT("\"untracked\"")));
+
+            for (int32 Stage = 0; Stage < (int32)EStage::Count; ++Stage)
+            {
+                const FStageSummary Summary = Summarize(Cell.Stages[Stage]);
+                Out += FString::Printf(TEXT("        \"%s\": { \"samples\": %d, \"meanMs\": %.4f, \"p50Ms\": %.4f, \"p90Ms\": %.4f, \"p99Ms\": %.4f, \"maxMs\": %.4f, \"meanScratchAllocs\": %.1f, \"meanScratchBytes\": %.0f, \"meanScratchBlocks\": %.2f, \"meanHeapBytes\": %s }%s\n"),
+                    StageNames[Stage], Cell.Stages[Stage].Milliseconds.Num(),
+                    Summary.MeanMs, Summary.P50Ms, Summary.P90Ms, Summary.P99Ms, Summary.MaxMs,
+                    Summary.MeanScratchAllocations, Summary.MeanScratchBytes, Summary.MeanScratchBlocks, *FormatOptional(Summary.MeanHeapBytes, TEXT("\"untracked\"")),
+                    Stage + 1 < (int32)EStage::Count ? TEXT(",") : TEXT(""));
+            }
+            Out += FString::Printf(TEXT("      }\n    }%s\n"), CellIndex + 1 < Cells.Num() ? TEXT(",") : TEXT(""));
+        }
+        Out += TEXT("  ]\n}\n");
+        return Out;
+    }
+}
+
+UAsteroidBenchmarkCommandlet::UAsteroidBenchmarkCommandlet()
+{
+    IsClient = false;
+    IsServer = false;
+    IsEditor = true;
+    LogToConsole = true;
+}
+
+int32 UAsteroidBenchmarkCommandlet::Main(const FString& Params)
+{
+    using namespace AsteroidBenchmarkPrivate;
+
+    const TArray<int32> SubdivisionLevels = ParseIntList(Params, TEXT("Subdivisions="), { 1, 2, 3, 4 });
+    const TArray<int32> LayerCounts = ParseIntList(Params, TEXT("Layers="), { 1, 2, 4 });
+
+    int32 Count = 50;
+    int32 FirstSeed = 1;
+    int32 Warmup = 3;
+    FParse::Value(*Params, TEXT("Count="), Count);
+    FParse::Value(*Params, TEXT("FirstSeed="), FirstSeed);
+    FParse::Value(*Params, TEXT("Warmup="), Warmup);
+    Count = FMath::Max(Count, 1);
+    Warmup = FMath::Max(Warmup, 0);
+
+    // Hull settings default to AAsteroidActor's
+    int32 HullVertices = 64;
+    float HullTolerance = 0.01f;
+    int32 Pieces = 1;
+    FParse::Value(*Params, TEXT("HullVertices="), HullVertices);
+    FParse::Value(*Params, TEXT("HullTolerance="), HullTolerance);
+    FParse::Value(*Params, TEXT("Pieces="), Pieces);
+
+    FString Format = TEXT("CSV");
+    FString Label = TEXT("local");
+    FParse::Value(*Params, TEXT("Format="), Format);
+    FParse::Value(*Params, TEXT("Label="), Label);
+    const bool bJson = Format.Equals(TEXT("JSON"), ESearchCase::IgnoreCase);
+
+    FString OutPath;
+    if (!FParse::Value(*Params, TEXT("Out="), OutPath))
+    {
+        OutPath = FPaths::ProjectSavedDir() / TEXT("Benchmarks") / FString::Printf(TEXT("AsteroidBenchmark-%s-%s.%s"),
+            *Label, *FDateTime::Now().ToString(), bJson ? TEXT("json") : TEXT("csv"));
+    }
+
+    // The mesh section goes to a component that is never registered, which
+    // is exactly the CPU work AAsteroidActor pays on the game thread
+    TStrongObjectPtr<UAsteroidMeshComponent> Component(NewObject<UAsteroidMeshComponent>(GetTransientPackage(), NAME_None, RF_Transient));
+    Component->bUseAsyncCooking = false;
+    Component->bUseComplexAsSimpleCollision = false;
+
+    UE_LOG(LogAsteroidBenchmark, Display, TEXT("Asteroid benchmark '%s': %d subdivision levels x %d layer counts x %d asteroids (+%d warm-up)"),
+        *Label, SubdivisionLevels.Num(), LayerCounts.Num(), Count, Warmup);
+
+    TArray<FCellResult> Cells;
+    bool bHeapCheckFailed = false;
+    for (const int32 Subdivisions : SubdivisionLevels)
+    {
+        for (const int32 Layers : LayerCounts)
+        {
+            FCellResult& Cell = Cells.AddDefaulted_GetRef();
+            Cell.Subdivisions = Subdivisions;
+            Cell.Layers = FMath::Max(Layers, 0);
+
+            FAsteroidGenerationParams GenParams;
+            GenParams.Frequency = FAsteroidGenerator::GetFrequencyForSubdivisions(Subdivisions);
+            GenParams.NoiseLayers = MakeNoiseLayers(Cell.Layers);
+            GenParams.Radius = 500.0f;
+            Cell.bFixedKernel = FAsteroidGenerator::HasFixedKernel(GenParams);
+
+            // Reused like a pooled asteroid's, so steady-state runs only refill it
+            FAsteroidMeshData MeshData;
+
+            const uint64 PhysicalAtStart = FPlatformMemory::GetStats().UsedPhysical;
+
+            for (int32 Run = 0; Run < Warmup + Count; ++Run)
+            {
+                FAsteroidGenerator::ResolveLayerSeeds(FirstSeed + FMath::Max(Run - Warmup, 0), GenParams.NoiseLayers, GenParams.LayerSeeds);
+                const bool bRecord = Run >= Warmup;
+
+                // Every stage's heap traffic lands on the benchmark tag; the
+                // stages are told apart by reading it around each one
+                LLM_SCOPE_BYTAG(AsteroidBenchmark);
+
+                uint64 StageStart = 0;
+                FAsteroidScratchStats ScratchAtStart;
+                TOptional<int64> HeapAtStart;
+                auto BeginStage = [&]()
+                {
+                    HeapAtStart = bRecord ? GetTaggedHeapBytes() : TOptional<int64>();
+                    ScratchAtStart = FAsteroidScratch::GetStats();
+                    StageStart = FPlatformTime::Cycles64();
+                };
+                auto EndStage = [&](EStage Stage)
+                {
+                    const double Milliseconds = FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - StageStart);
+                    if (!bRecord)
+                    {
+                        return;
+                    }
+                    const FAsteroidScratchStats ScratchAtEnd = FAsteroidScratch::GetStats();
+                    FStageSamples& Samples = Cell.Stages[(int32)Stage];
+                    Samples.Milliseconds.Add(Milliseconds);
+                    Samples.ScratchAllocations.Add(ScratchAtEnd.Allocations - ScratchAtStart.Allocations);
+                    Samples.ScratchBytes.Add(ScratchAtEnd.AllocatedBytes - ScratchAtStart.AllocatedBytes);
+                    Samples.ScratchBlocks.Add(ScratchAtEnd.BlockAllocations - ScratchAtStart.BlockAllocations);
+
+                    const TOptional<int64> HeapAtEnd = GetTaggedHeapBytes();
+                    if (HeapAtStart.IsSet() && HeapAtEnd.IsSet())
+                    {
+                        Samples.HeapBytes.Add(HeapAtEnd.GetValue() - HeapAtStart.GetValue());
+                    }
+                };
+
+                // Built from scratch every run; the runtime cache would hide this cost
+                FAsteroidIcosphereTopology Topology;
+                Topology.Frequency = GenParams.Frequency;
+                BeginStage();
+                {
+                    TArray<FVector> UnitVertices;
+                    FAsteroidGenerator::BuildGeodesicSphere(GenParams.Frequency, UnitVertices, Topology.Triangles);
+                    Topology.UnitPositions.SetNumUninitialized(UnitVertices.Num());
+                    for (int32 Index = 0; Index < UnitVertices.Num(); ++Index)
+                    {
+                        Topology.UnitPositions.Set(Index, FVector3f(UnitVertices[Index]));
+                    }
+                }
+                EndStage(EStage::Icosphere);
+
+                BeginStage();
+                FAsteroidGenerator::BuildVertexAdjacency(Topology);
+                FAsteroidGenerator::BuildDirectionIndex(Topology);
+                EndStage(EStage::Adjacency);
+
+                // Noise, normals, upload buffers and stats exactly as asteroids
+                // run them; the specialized kernels fuse these into one pass,
+                // so they are timed together
+                BeginStage();
+                FAsteroidGenerator::Generate(GenParams, MeshData);
+                EndStage(EStage::Generate);
+
+                BeginStage();
+                Component->CreateMeshSection(0, MeshData.Vertices, MeshData.GetTriangles(), MeshData.Normals, TArray<FVector2D>(), TArray<FColor>(), TArray<FProcMeshTangent>(), false);
+                EndStage(EStage::MeshSection);
+
+                // The cook an asteroid's worker task runs, plus wrapping the
+                // result in a body setup. Nothing else holds the entry, so
+                // every run misses the cache and cooks.
+                BeginStage();
+                {
+                    const FAsteroidCollisionKey CollisionKey(FAsteroidShapeKey::FromParams(GenParams), FAsteroidCollisionCache::GetRadiusBucket(GenParams.Radius), HullVertices, HullTolerance, Pieces);
+                    if (FAsteroidCollisionShapePtr Shape = FAsteroidCollisionCache::FindOrCook(CollisionKey, MeshData.Vertices, MeshData.GetTriangles(), GenParams.Radius))
+                    {
+                        Component->SetCookedCollision(Shape);
+                    }
+                    Component->ClearCollisionOverride();
+                }
+                EndStage(EStage::ConvexCooking);
+
+                Cell.Vertices = MeshData.Vertices.Num();
+            }
+
+            // Once MeshData is sized and the scratch arena is warm, Generate
+            // must not touch the general heap at all
+            {
+                const FAsteroidScratchStats ScratchBefore = FAsteroidScratch::GetStats();
+                const TOptional<int64> HeapBefore = GetTaggedHeapBytes();
+                for (int32 Run = 0; Run < Count; ++Run)
+                {
+                    FAsteroidGenerator::ResolveLayerSeeds(FirstSeed + Run, GenParams.NoiseLayers, GenParams.LayerSeeds);
+
+                    LLM_SCOPE_BYTAG(AsteroidBenchmark);
+                    FAsteroidGenerator::Generate(GenParams, MeshData);
+                }
+                const TOptional<int64> HeapAfter = GetTaggedHeapBytes();
+
+                Cell.SteadyScratchBlocks = FAsteroidScratch::GetStats().BlockAllocations - ScratchBefore.BlockAllocations;
+                if (HeapBefore.IsSet() && HeapAfter.IsSet())
+                {
+                    Cell.SteadyHeapBytes = HeapAfter.GetValue() - HeapBefore.GetValue();
+                }
+
+                if (Cell.SteadyScratchBlocks != 0 || Cell.SteadyHeapBytes.Get(0) != 0)
+                {
+                    UE_LOG(LogAsteroidBenchmark, Error, TEXT("  Subdivisions %d, %d layers: Generate allocated on the general heap in steady state (%lld scratch blocks, %s heap bytes)"),
+                        Cell.Subdivisions, Cell.Layers, Cell.SteadyScratchBlocks, *FormatOptional(Cell.SteadyHeapBytes, TEXT("untracked")));
+                    bHeapCheckFailed = true;
+                }
+            }
+
+            // Freed memory stays mapped in the allocator's pools, so this is
+            // how far the cell's high-water mark pushed the process
+            Cell.PhysicalGrowthBytes = (int64)FPlatformMemory::GetStats().UsedPhysical - (int64)PhysicalAtStart;
+            Component->ClearAllMeshSections();
+
+            double TotalMs = 0.0;
+            for (int32 Stage = 0; Stage < (int32)EStage::Count; ++Stage)
+            {
+                TotalMs += Summarize(Cell.Stages[Stage]).MeanMs;
+            }
+            UE_LOG(LogAsteroidBenchmark, Display, TEXT("  Subdivisions %d, %d layers, %d vertices (%s kernel): %.3f ms mean total, physical memory %+.2f MB"),
+                Cell.Subdivisions, Cell.Layers, Cell.Vertices, Cell.bFixedKernel ? TEXT("fixed") : TEXT("generic"), TotalMs, Cell.PhysicalGrowthBytes / (1024.0 * 1024.0));
+        }
+    }
+
+    const FPlatformMemoryStats MemoryStats = FPlatformMemory::GetStats();
+    const FString Report = bJson ? WriteJson(Label, Cells, MemoryStats.PeakUsedPhysical) : WriteCsv(Label, Cells);
+    if (!FFileHelper::SaveStringToFile(Report, *OutPath))
+    {
+        UE_LOG(LogAsteroidBenchmark, Error, TEXT("Could not write %s"), *OutPath);
+        return 1;
+    }
+
+#if ENABLE_LOW_LEVEL_MEM_TRACKER
+    if (!FLowLevelMemTracker::IsEnabled())
+#endif
+    {
+        UE_LOG(LogAsteroidBenchmark, Display, TEXT("LLM is off; per-stage heap bytes are untracked and the steady-state heap check only covered scratch blocks (run with -llm to track every heap allocation)"));
+    }
+
+    const FAsteroidScratchStats ScratchStats = FAsteroidScratch::GetStats();
+    UE_LOG(LogAsteroidBenchmark, Display, TEXT("Scratch arena: %lld allocations served by %lld heap blocks"),
+        ScratchStats.Allocations, ScratchStats.BlockAllocations);
+    UE_LOG(LogAsteroidBenchmark, Display, TEXT("Asteroid benchmark written to %s (process peak physical %.1f MB)"),
+        *OutPath, MemoryStats.PeakUsedPhysical / (1024.0 * 1024.0));
+    return bHeapCheckFailed ? 1 : 0;
+}
@@ -0,0 +1,155 @@
+/**
+ * AsteroidCacheCommandlet Implementation
+ *
+ * Key Systems:
+ * - Map loading and asteroid shape collection
+ * - Merge with the existing cache file
+ * - Parallel generation of missing shapes
+ */
+
+#include "AsteroidCacheCommandlet.h"
+#include "AsteroidActor.h"
+#include "AsteroidDiskCache.h"
+#include "AsteroidFieldActor.h"
+#include "AsteroidMeshRegistry.h"
+#include "Async/ParallelFor.h"
+#include "Engine/Level.h"
+#include "Engine/World.h"
+#include "HAL/PlatformTime.h"
+#include "UObject/Package.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogAsteroidCacheCommandlet, Log, All);
+
+UAsteroidCacheCommandlet::UAsteroidCacheCommandlet()
+{
+    IsClient = false;
+    IsServer = false;
+    IsEditor = true;
+    LogToConsole = true;
+}
+
+int32 UAsteroidCacheCommandlet::Main(const FString& Params)
+{
+    FString MapList;
+    if (!FParse::Value(*Params, TEXT("Map="), MapList, false))
+    {
+        UE_LOG(LogAsteroidCacheCommandlet, Error, TEXT("Usage: -run=AsteroidCache -Map=/Game/Maps/A+/Game/Maps/B [-Clean]"));
+        return 1;
+    }
+    const bool bClean = FParse::Param(*Params, TEXT("Clean"));
+
+    TArray<FString> Maps;
+    MapList.ParseIntoArray(Maps, TEXT("+"));
+
+    // ------------------------- Collect shapes -------------------------
+    TMap<uint64, FAsteroidGenerationParams> Shapes;
+    int32 SkippedRandom = 0;
+
+    auto AddShape = [&Shapes](const FAsteroidGenerationParams& ShapeParams)
+    {
+        Shapes.Add(FAsteroidShapeKey::FromParams(ShapeParams).GetStableHash(), ShapeParams);
+    };
+
+    for (const FString& Map : Maps)
+    {
+        UPackage* Package = LoadPackage(nullptr, *Map, LOAD_None);
+        UWorld* World = Package ? UWorld::FindWorldInPackage(Package) : nullptr;
+        if (!World || !World->PersistentLevel)
+        {
+            UE_LOG(LogAsteroidCacheCommandlet, Error, TEXT("Could not load map %s"), *Map);
+            return 1;
+        }
+
+        const int32 ShapesBefore = Shapes.Num();
+        for (AActor* Actor : World->PersistentLevel->Actors)
+        {
+            if (const AAsteroidActor* Asteroid = Cast<AAsteroidActor>(Actor))
+            {
+                FAsteroidGenerationParams ShapeParams;
+                if (Asteroid->GetDeterministicGenerationParams(ShapeParams))
+                {
+                    AddShape(ShapeParams);
+                }
+                else
+                {
+                    ++SkippedRandom;
+                }
+            }
+            else if (const AAsteroidFieldActor* Field = Cast<AAsteroidFieldActor>(Actor))
+            {
+                TArray<FAsteroidGenerationParams> VariantParams;
+                if (Field->GetVariantGenerationParams(VariantParams))
+                {
+                    for (const FAsteroidGenerationParams& ShapeParams : VariantParams)
+                    {
+                        AddShape(ShapeParams);
+                    }
+                }
+                else
+                {
+                    ++SkippedRandom;
+                }
+            }
+        }
+
+        UE_LOG(LogAsteroidCacheCommandlet, Display, TEXT("%s: %d new shapes"), *Map, Shapes.Num() - ShapesBefore);
+    }
+
+    if (SkippedRandom > 0)
+    {
+        UE_LOG(LogAsteroidCacheCommandlet, Warning, TEXT("Skipped %d asteroids/fields with random seeds"), SkippedRandom);
+    }
+
+    // ------------------------- Merge existing entries -------------------------
+    const FString CachePath = FAsteroidDiskCache::GetCacheFilePath();
+    TArray<FAsteroidDiskCacheRecord> Records;
+    int32 Reused = 0;
+    {
+        // Scoped so the mapping is released before the file is replaced
+        FAsteroidDiskCacheFile Existing(CachePath);
+        for (const FAsteroidDiskCacheEntry& Entry : Existing.GetEntries())
+        {
+            const bool bWanted = Shapes.Contains(Entry.KeyHash);
+            if (bClean && !bWanted)
+            {
+                continue;
+            }
+
+            FAsteroidDiskCacheRecord& Record = Records.AddDefaulted_GetRef();
+            Record.KeyHash = Entry.KeyHash;
+            Record.Frequency = Entry.Frequency;
+            Record.Positions.Append(reinterpret_cast<const FVector3f*>(Existing.GetPositions(Entry)), Entry.VertexCount);
+            Record.Normals.Append(reinterpret_cast<const FVector3f*>(Existing.GetNormals(Entry)), Entry.VertexCount);
+
+            if (bWanted)
+            {
+                Shapes.Remove(Entry.KeyHash);
+                ++Reused;
+            }
+        }
+    }
+
+    // ------------------------- Generate missing shapes -------------------------
+    TArray<TPair<uint64, FAsteroidGenerationParams>> Missing = Shapes.Array();
+    TArray<FAsteroidDiskCacheRecord> Generated;
+    Generated.SetNum(Missing.Num());
+
+    const double StartTime = FPlatformTime::Seconds();
+    ParallelFor(Missing.Num(), [&](int32 Index)
+    {
+        FAsteroidGenerationParams ShapeParams = Missing[Index].Value;
+        ShapeParams.Radius = FAsteroidMeshRegistry::ReferenceRadius;
+
+        FAsteroidMeshData MeshData;
+        FAsteroidGenerator::Generate(ShapeParams, MeshData);
+        Generated[Index] = FAsteroidDiskCache::MakeRecord(Missing[Index].Key, ShapeParams.Frequency, MeshData);
+    });
+    const double GenerateSeconds = FPlatformTime::Seconds() - StartTime;
+
+    Records.Append(MoveTemp(Generated));
+
+    UE_LOG(LogAsteroidCacheCommandlet, Display, TEXT("Asteroid cache: %d reused, %d generated in %.2fs, %d total"),
+        Reused, Missing.Num(), GenerateSeconds, Records.Num());
+
+    return FAsteroidDiskCache::Write(CachePath, Records) ? 0 : 1;
+}
@@ -0,0 +1,765 @@
+/**
+ * AsteroidCollisionCache Implementation
+ *
+ * Key Systems:
+ * - Logarithmic radius buckets around the reference radius
+ * - Bounded-vertex hull selection for star-shaped meshes
+ * - Cone decomposition of star-shaped meshes into convex pieces
+ * - Chaos convex cooking from mesh vertices, pieces in parallel
+ * - Weak-reference entry table guarded by a critical section
+ * - Hit/miss accounting and the Asteroid.CollisionCacheStats console command
+ */
+
+#include "AsteroidCollisionCache.h"
+#include "Chaos/Convex.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+#include "Async/ParallelFor.h"
+#include "Misc/ScopeLock.h"
+#include "PhysicsSettingsCore.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogAsteroidCollisionCache, Log, All);
+
+namespace AsteroidCollisionCachePrivate
+{
+    typedef TWeakPtr<const FAsteroidCollisionShape, ESPMode::ThreadSafe> FWeakCollisionShape;
+
+    struct FCacheState
+    {
+        FCriticalSection Lock;
+        TMap<FAsteroidCollisionKey, FWeakCollisionShape> Entries;
+        int64 Hits = 0;
+        int64 Misses = 0;
+        double CookSeconds = 0.0;
+
+        /** Entry count at which the next sweep of expired entries happens */
+        int32 SweepThreshold = 64;
+    };
+
+    static FCacheState& GetState()
+    {
+        static FCacheState State;
+        return State;
+    }
+
+    /** Drops entries whose last user has gone. Caller holds the lock. */
+    static void SweepExpired(FCacheState& State)
+    {
+        for (auto It = State.Entries.CreateIterator(); It; ++It)
+        {
+            if (!It.Value().IsValid())
+            {
+                It.RemoveCurrent();
+            }
+        }
+        State.SweepThreshold = FMath::Max(64, State.Entries.Num() * 2);
+    }
+
+    /** One triangle of the hull under construction, wound outward */
+    struct FHullFace
+    {
+        int32 Corners[3] = { 0, 0, 0 };
+        FVector Normal = FVector::ZeroVector;
+        double Offset = 0.0;
+
+        /** Points outside this face and not yet on the hull, and the farthest of them */
+        TArray<int32> Outside;
+        int32 Farthest = INDEX_NONE;
+        double FarthestDistance = 0.0;
+
+        bool bAlive = true;
+
+        double Distance(const FVector& Point) const
+        {
+            return FVector::DotProduct(Normal, Point) - Offset;
+        }
+    };
+
+    /**
+     * Incremental hull over a point set that is star-shaped around the
+     * origin. Once seeded the origin is inside the hull, so the smallest
+     * face offset is the radius of a sphere the hull contains: any point
+     * inside that radius can be dropped without testing a single plane.
+     */
+    class FBoundedHullBuilder
+    {
+    public:
+        FBoundedHullBuilder(TConstArrayView<FVector> InPoints, double InEpsilon)
+            : Points(InPoints), Epsilon(InEpsilon)
+        {
+            Radii.SetNumUninitialized(Points.Num());
+            for (int32 Index = 0; Index < Points.Num(); ++Index)
+            {
+                Radii[Index] = Points[Index].Size();
+            }
+            bAdded.Init(false, Points.Num());
+            CornerUses.SetNumZeroed(Points.Num());
+        }
+
+        /**
+         * Builds the starting hull from the extreme points along the 12
+         * icosahedron corner directions, all of which are hull vertices.
+         * Fails if they do not span a volume.
+         */
+        bool Seed(int32 MaxVertices)
+        {
+            const double Phi = (1.0 + FMath::Sqrt(5.0)) * 0.5;
+            TArray<int32, TInlineAllocator<12>> Seeds;
+            for (int32 Corner = 0; Corner < 12; ++Corner)
+            {
+                // Cyclic permutations of (0, +-1, +-Phi)
+                const double A = (Corner & 1) ? -1.0 : 1.0;
+                const double B = (Corner & 2) ? -Phi : Phi;
+                const FVector Direction = Corner < 4 ? FVector(0.0, A, B) : (Corner < 8 ? FVector(A, B, 0.0) : FVector(B, 0.0, A));
+
+                int32 Best = INDEX_NONE;
+                double BestDot = -MAX_dbl;
+                for (int32 Index = 0; Index < Points.Num(); ++Index)
+                {
+                    const double Dot = FVector::DotProduct(Points[Index], Direction);
+                    if (Dot > BestDot)
+                    {
+                        BestDot = Dot;
+                        Best = Index;
+                    }
+                }
+                Seeds.AddUnique(Best);
+            }
+            if (Seeds.Num() < 4)
+            {
+                return false;
+            }
+
+            // Tetrahedron from the seeds that span the most volume
+            const int32 A = Seeds[0];
+            int32 B = INDEX_NONE;
+            int32 C = INDEX_NONE;
+            int32 D = INDEX_NONE;
+            double Best = 0.0;
+            for (int32 Seed : Seeds)
+            {
+                const double Length = FVector::DistSquared(Points[Seed], Points[A]);
+                if (Length > Best)
+                {
+                    Best = Length;
+                    B = Seed;
+                }
+            }
+            Best = 0.0;
+            for (int32 Seed : Seeds)
+            {
+                const double Area = FVector::CrossProduct(Points[B] - Points[A], Points[Seed] - Points[A]).SizeSquared();
+                if (Area > Best)
+                {
+                    Best = Area;
+                    C = Seed;
+                }
+            }
+            if (C == INDEX_NONE)
+            {
+                return false;
+            }
+            const FVector BaseNormal = FVector::CrossProduct(Points[B] - Points[A], Points[C] - Points[A]).GetSafeNormal();
+            Best = Epsilon;
+            for (int32 Seed : Seeds)
+            {
+                const double Height = FMath::Abs(FVector::DotProduct(BaseNormal, Points[Seed] - Points[A]));
+                if (Height > Best)
+                {
+                    Best = Height;
+                    D = Seed;
+                }
+            }
+            if (D == INDEX_NONE)
+            {
+                return false;
+            }
+
+            const FVector Centroid = (Points[A] + Points[B] + Points[C] + Points[D]) * 0.25;
+            AddFace(A, B, C, &Centroid);
+            AddFace(A, B, D, &Centroid);
+            AddFace(A, C, D, &Centroid);
+            AddFace(B, C, D, &Centroid);
+            bAdded[A] = bAdded[B] = bAdded[C] = bAdded[D] = true;
+
+            for (int32 Seed : Seeds)
+            {
+                if (!bAdded[Seed] && HullVertexCount < MaxVertices)
+                {
+                    AddPoint(Seed);
+                }
+            }
+            UpdateInnerRadius();
+            return true;
+        }
+
+        /** Files every point outside the seeded hull under the face it is farthest outside */
+        void AssignOutsidePoints()
+        {
+            for (int32 Index = 0; Index < Points.Num(); ++Index)
+            {
+                AssignPoint(Index);
+            }
+        }
+
+        /**
+         * Adds the point farthest outside the hull.
+         * @return False if every point is within Tolerance of the hull
+         */
+        bool AddFarthest(double Tolerance)
+        {
+            int32 BestFace = INDEX_NONE;
+            double BestDistance = Tolerance;
+            for (int32 FaceIndex = 0; FaceIndex < Faces.Num(); ++FaceIndex)
+            {
+                const FHullFace& Face = Faces[FaceIndex];
+                if (Face.bAlive && Face.Farthest != INDEX_NONE && Face.FarthestDistance > BestDistance)
+                {
+                    BestDistance = Face.FarthestDistance;
+                    BestFace = FaceIndex;
+                }
+            }
+            if (BestFace == INDEX_NONE)
+            {
+                return false;
+            }
+            AddPoint(Faces[BestFace].Farthest);
+            return true;
+        }
+
+        /** @return Vertices of the current hull; points swallowed by later additions are not counted */
+        int32 GetNumHullVertices() const
+        {
+            return HullVertexCount;
+        }
+
+        /** Appends the current hull's vertices */
+        void GetHullVertices(TArray<FVector>& OutPoints) const
+        {
+            OutPoints.Reserve(OutPoints.Num() + HullVertexCount);
+            for (int32 Index = 0; Index < Points.Num(); ++Index)
+            {
+                if (CornerUses[Index] > 0)
+                {
+                    OutPoints.Add(Points[Index]);
+                }
+            }
+        }
+
+    private:
+        TConstArrayView<FVector> Points;
+        TArray<double> Radii;
+        TBitArray<> bAdded;
+        TArray<FHullFace> Faces;
+        double Epsilon = 0.0;
+
+        /** Live faces each point is a corner of; the hull vertices are the points above zero */
+        TArray<int32> CornerUses;
+        int32 HullVertexCount = 0;
+
+        /** Radius of a sphere around the origin the hull contains */
+        double InnerRadius = 0.0;
+
+        /** Adds a face; with an interior point given, winds it away from that point */
+        void AddFace(int32 A, int32 B, int32 C, const FVector* Interior = nullptr)
+        {
+            FVector Normal = FVector::CrossProduct(Points[B] - Points[A], Points[C] - Points[A]).GetSafeNormal();
+            if (Interior && FVector::DotProduct(Normal, *Interior - Points[A]) > 0.0)
+            {
+                Swap(B, C);
+                Normal = -Normal;
+            }
+
+            FHullFace& Face = Faces.AddDefaulted_GetRef();
+            Face.Corners[0] = A;
+            Face.Corners[1] = B;
+            Face.Corners[2] = C;
+            Face.Normal = Normal;
+            Face.Offset = FVector::DotProduct(Normal, Points[A]);
+
+            for (int32 Corner : Face.Corners)
+            {
+                if (CornerUses[Corner]++ == 0)
+                {
+                    ++HullVertexCount;
+                }
+            }
+        }
+
+        /** Kills a face and drops the corners no live face uses any more */
+        void RemoveFace(FHullFace& Face)
+        {
+            Face.bAlive = false;
+            for (int32 Corner : Face.Corners)
+            {
+                if (--CornerUses[Corner] == 0)
+                {
+                    --HullVertexCount;
+                }
+            }
+        }
+
+        void UpdateInnerRadius()
+        {
+            // Negative if the origin is outside, which disables the radius test
+            double Smallest = MAX_dbl;
+            for (const FHullFace& Face : Faces)
+            {
+                if (Face.bAlive)
+                {
+                    Smallest = FMath::Min(Smallest, Face.Offset);
+                }
+            }
+            InnerRadius = FMath::Max(Smallest, 0.0);
+        }
+
+        /** Files a point under the face it is farthest outside, if any */
+        void AssignPoint(int32 PointIndex)
+        {
+            if (bAdded[PointIndex] || Radii[PointIndex] <= InnerRadius)
+            {
+                return;
+            }
+
+            const FVector& Point = Points[PointIndex];
+            int32 BestFace = INDEX_NONE;
+            double BestDistance = Epsilon;
+            for (int32 FaceIndex = 0; FaceIndex < Faces.Num(); ++FaceIndex)
+            {
+                const FHullFace& Face = Faces[FaceIndex];
+                const double Distance = Face.bAlive ? Face.Distance(Point) : 0.0;
+                if (Distance > BestDistance)
+                {
+                    BestDistance = Distance;
+                    BestFace = FaceIndex;
+                }
+            }
+            if (BestFace == INDEX_NONE)
+            {
+                return;
+            }
+
+            FHullFace& Face = Faces[BestFace];
+            Face.Outside.Add(PointIndex);
+            if (BestDistance > Face.FarthestDistance)
+            {
+                Face.FarthestDistance = BestDistance;
+                Face.Farthest = PointIndex;
+            }
+        }
+
+        /** Replaces every face the point can see with a fan from the horizon to the point */
+        void AddPoint(int32 PointIndex)
+        {
+            const FVector& Point = Points[PointIndex];
+            bAdded[PointIndex] = true;
+
+            // Directed edges of the visible faces; an edge whose reverse is
+            // not among them is on the horizon
+            TArray<TPair<int32, int32>, TInlineAllocator<64>> Edges;
+            TArray<int32> Orphans;
+            for (FHullFace& Face : Faces)
+            {
+                if (!Face.bAlive || Face.Distance(Point) <= Epsilon)
+                {
+                    continue;
+                }
+                for (int32 Corner = 0; Corner < 3; ++Corner)
+                {
+                    Edges.Emplace(Face.Corners[Corner], Face.Corners[(Corner + 1) % 3]);
+                }
+                Orphans.Append(Face.Outside);
+                Face.Outside.Empty();
+                RemoveFace(Face);
+            }
+
+            for (const TPair<int32, int32>& Edge : Edges)
+            {
+                if (!Edges.Contains(TPair<int32, int32>(Edge.Value, Edge.Key)))
+                {
+                    AddFace(Edge.Key, Edge.Value, PointIndex);
+                }
+            }
+
+            // The hull only grows, so orphans are inside it or outside one of its live faces
+            UpdateInnerRadius();
+            for (int32 Orphan : Orphans)
+            {
+                AssignPoint(Orphan);
+            }
+        }
+    };
+
+    /**
+     * Cooks one convex the same way the engine's convex cooker does,
+     * including its collision margin, without going through a body setup.
+     * The hull is built around the points' centroid, which keeps a piece
+     * that touches the origin star-shaped for BuildBoundedHull.
+     */
+    static bool CookPiece(int32 MaxHullVertices, double Tolerance, TConstArrayView<FVector> Points, FAsteroidCollisionPiece& OutPiece)
+    {
+        if (Points.Num() < 4)
+        {
+            return false;
+        }
+
+        TArray<FVector> HullPoints;
+        if (MaxHullVertices > 0 || Tolerance > 0.0)
+        {
+            FVector Centroid = FVector::ZeroVector;
+            for (const FVector& Point : Points)
+            {
+                Centroid += Point;
+            }
+            Centroid /= Points.Num();
+
+            TArray<FVector> Centered;
+            Centered.SetNumUninitialized(Points.Num());
+            for (int32 Index = 0; Index < Points.Num(); ++Index)
+            {
+                Centered[Index] = Points[Index] - Centroid;
+            }
+
+            FAsteroidCollisionCache::BuildBoundedHull(Centered, MaxHullVertices, Tolerance, HullPoints);
+            for (FVector& Point : HullPoints)
+            {
+                Point += Centroid;
+            }
+        }
+        else
+        {
+            HullPoints.Append(Points.GetData(), Points.Num());
+        }
+        if (HullPoints.Num() < 4)
+        {
+            return false;
+        }
+
+        TArray<Chaos::FConvex::FVec3Type> ConvexPoints;
+        ConvexPoints.SetNumUninitialized(HullPoints.Num());
+        FBox Bounds(ForceInit);
+        for (int32 Index = 0; Index < HullPoints.Num(); ++Index)
+        {
+            ConvexPoints[Index] = Chaos::FConvex::FVec3Type(HullPoints[Index]);
+            Bounds += HullPoints[Index];
+        }
+
+        const FChaosSolverConfiguration& Solver = UPhysicsSettingsCore::Get()->SolverOptions;
+        const Chaos::FReal Margin = FMath::Min<Chaos::FReal>(FMath::Max(0.0f, Solver.CollisionMarginMax),
+            FMath::Max(0.0f, Solver.CollisionMarginFraction) * Bounds.GetExtent().GetMin());
+
+        TSharedPtr<Chaos::FConvex, ESPMode::ThreadSafe> Convex = MakeShared<Chaos::FConvex, ESPMode::ThreadSafe>(ConvexPoints, Margin);
+        if (Convex->GetVertices().Num() < 4)
+        {
+            return false;
+        }
+
+        OutPiece.HullVertices.Reset(Convex->GetVertices().Num());
+        for (const Chaos::FConvex::FVec3Type& Vertex : Convex->GetVertices())
+        {
+            OutPiece.HullVertices.Add(FVector(Vertex));
+        }
+        OutPiece.Convex = MoveTemp(Convex);
+        return true;
+    }
+
+    /** Scales the mesh, splits it if asked, and cooks every piece */
+    static TSharedPtr<FAsteroidCollisionShape, ESPMode::ThreadSafe> Cook(TConstArrayView<FVector> Vertices, TConstArrayView<int32> Triangles, float Scale, int32 MaxHullVertices, double Tolerance, int32 PieceCount)
+    {
+        TArray<FVector> Scaled;
+        Scaled.SetNumUninitialized(Vertices.Num());
+        for (int32 Index = 0; Index < Vertices.Num(); ++Index)
+        {
+            Scaled[Index] = Vertices[Index] * Scale;
+        }
+
+        TArray<TArray<FVector>> PiecePoints;
+        if (PieceCount > 1 && Triangles.Num() > 0)
+        {
+            FAsteroidCollisionCache::DecomposeStarShaped(Scaled, Triangles, PieceCount, PiecePoints);
+        }
+        else
+        {
+            PiecePoints.Add(MoveTemp(Scaled));
+        }
+
+        TArray<FAsteroidCollisionPiece> Pieces;
+        Pieces.SetNum(PiecePoints.Num());
+        TArray<bool> bCooked;
+        bCooked.Init(false, PiecePoints.Num());
+        ParallelFor(PiecePoints.Num(), [&](int32 PieceIndex)
+        {
+            bCooked[PieceIndex] = CookPiece(MaxHullVertices, Tolerance, PiecePoints[PieceIndex], Pieces[PieceIndex]);
+        });
+
+        // A piece that failed is covered by its overlapping neighbours
+        TSharedPtr<FAsteroidCollisionShape, ESPMode::ThreadSafe> Shape = MakeShared<FAsteroidCollisionShape, ESPMode::ThreadSafe>();
+        for (int32 PieceIndex = 0; PieceIndex < Pieces.Num(); ++PieceIndex)
+        {
+            if (bCooked[PieceIndex])
+            {
+                Shape->Pieces.Add(MoveTemp(Pieces[PieceIndex]));
+            }
+        }
+        if (Shape->Pieces.Num() == 0)
+        {
+            return nullptr;
+        }
+        return Shape;
+    }
+}
+
+// ------------------------- Buckets -------------------------
+int32 FAsteroidCollisionCache::GetRadiusBucket(float Radius)
+{
+    const float Ratio = FMath::Max(Radius, KINDA_SMALL_NUMBER) / FAsteroidMeshRegistry::ReferenceRadius;
+    return FMath::RoundToInt(FMath::Loge(Ratio) / FMath::Loge(1.0f + RadiusBucketStep));
+}
+
+float FAsteroidCollisionCache::GetBucketRadius(int32 Bucket)
+{
+    return FAsteroidMeshRegistry::ReferenceRadius * FMath::Pow(1.0f + RadiusBucketStep, (float)Bucket);
+}
+
+// ------------------------- Cache -------------------------
+FAsteroidCollisionShapePtr FAsteroidCollisionCache::Find(const FAsteroidCollisionKey& Key)
+{
+    using namespace AsteroidCollisionCachePrivate;
+    FCacheState& State = GetState();
+
+    FScopeLock ScopeLock(&State.Lock);
+    if (const FWeakCollisionShape* Entry = State.Entries.Find(Key))
+    {
+        FAsteroidCollisionShapePtr Shape = Entry->Pin();
+        if (Shape.IsValid())
+        {
+            ++State.Hits;
+            return Shape;
+        }
+    }
+    return nullptr;
+}
+
+FAsteroidCollisionShapePtr FAsteroidCollisionCache::FindOrCook(const FAsteroidCollisionKey& Key, TConstArrayView<FVector> Vertices, TConstArrayView<int32> Triangles, float VertexRadius)
+{
+    using namespace AsteroidCollisionCachePrivate;
+    FCacheState& State = GetState();
+
+    if (FAsteroidCollisionShapePtr Existing = Find(Key))
+    {
+        return Existing;
+    }
+
+    // Cook outside the lock; duplicates racing here are resolved on insert
+    const double StartTime = FPlatformTime::Seconds();
+    const float BucketRadius = GetBucketRadius(Key.RadiusBucket);
+    const float Scale = VertexRadius > 0.0f ? BucketRadius / VertexRadius : 1.0f;
+    TSharedPtr<FAsteroidCollisionShape, ESPMode::ThreadSafe> Shape = Cook(Vertices, Triangles, Scale, Key.MaxHullVertices, Key.HullTolerance * BucketRadius, Key.PieceCount);
+    const double CookSeconds = FPlatformTime::Seconds() - StartTime;
+    if (!Shape.IsValid())
+    {
+        UE_LOG(LogAsteroidCollisionCache, Warning, TEXT("Degenerate asteroid hull (%d vertices); keeping proxy collision"), Vertices.Num());
+        return nullptr;
+    }
+    Shape->Key = Key;
+
+    FScopeLock ScopeLock(&State.Lock);
+    State.CookSeconds += CookSeconds;
+
+    FWeakCollisionShape& Entry = State.Entries.FindOrAdd(Key);
+    if (FAsteroidCollisionShapePtr Winner = Entry.Pin())
+    {
+        ++State.Hits;
+        return Winner;
+    }
+
+    ++State.Misses;
+    Entry = Shape;
+
+    if (State.Entries.Num() >= State.SweepThreshold)
+    {
+        SweepExpired(State);
+    }
+
+    return Shape;
+}
+
+FAsteroidCollisionShapePtr FAsteroidCollisionCache::CookUncached(TConstArrayView<FVector> Vertices, TConstArrayView<int32> Triangles, float Radius, int32 MaxHullVertices, float HullTolerance, int32 PieceCount)
+{
+    using namespace AsteroidCollisionCachePrivate;
+
+    TSharedPtr<FAsteroidCollisionShape, ESPMode::ThreadSafe> Shape = Cook(Vertices, Triangles, 1.0f, MaxHullVertices, HullTolerance * Radius, PieceCount);
+    if (!Shape.IsValid())
+    {
+        UE_LOG(LogAsteroidCollisionCache, Warning, TEXT("Degenerate asteroid hull (%d vertices); keeping previous collision"), Vertices.Num());
+    }
+    return Shape;
+}
+
+void FAsteroidCollisionCache::BuildBoundedHull(TConstArrayView<FVector> Vertices, int32 MaxVertices, double Tolerance, TArray<FVector>& OutPoints)
+{
+    using namespace AsteroidCollisionCachePrivate;
+    OutPoints.Reset();
+
+    double MaxRadius = 0.0;
+    for (const FVector& Vertex : Vertices)
+    {
+        MaxRadius = FMath::Max(MaxRadius, Vertex.Size());
+    }
+
+    const int32 Budget = MaxVertices > 0 ? FMath::Max(MaxVertices, 4) : MAX_int32;
+    FBoundedHullBuilder Builder(Vertices, MaxRadius * 1.0e-6);
+    if (!Builder.Seed(Budget))
+    {
+        // Too flat to seed a hull from; let the cooker see everything
+        OutPoints.Append(Vertices.GetData(), Vertices.Num());
+        return;
+    }
+
+    Builder.AssignOutsidePoints();
+    while (Builder.GetNumHullVertices() < Budget && Builder.AddFarthest(FMath::Max(Tolerance, 0.0)))
+    {
+    }
+    Builder.GetHullVertices(OutPoints);
+}
+
+void FAsteroidCollisionCache::DecomposeStarShaped(TConstArrayView<FVector> Vertices, TConstArrayView<int32> Triangles, int32 PieceCount, TArray<TArray<FVector>>& OutPieces)
+{
+    OutPieces.Reset();
+    if (Vertices.Num() == 0 || Triangles.Num() == 0)
+    {
+        return;
+    }
+    PieceCount = FMath::Clamp(PieceCount, 1, Vertices.Num());
+
+    TArray<FVector> Directions;
+    Directions.SetNumUninitialized(Vertices.Num());
+    for (int32 Index = 0; Index < Vertices.Num(); ++Index)
+    {
+        Directions[Index] = Vertices[Index].GetSafeNormal();
+    }
+
+    // Evenly spread starting cones (Fibonacci sphere)
+    TArray<FVector> Centers;
+    Centers.SetNumUninitialized(PieceCount);
+    const double GoldenAngle = PI * (3.0 - FMath::Sqrt(5.0));
+    for (int32 Piece = 0; Piece < PieceCount; ++Piece)
+    {
+        const double Y = 1.0 - 2.0 * (Piece + 0.5) / PieceCount;
+        const double Ring = FMath::Sqrt(FMath::Max(0.0, 1.0 - Y * Y));
+        Centers[Piece] = FVector(Ring * FMath::Cos(GoldenAngle * Piece), Y, Ring * FMath::Sin(GoldenAngle * Piece));
+    }
+
+    // A few Lloyd steps settle the cones onto the vertex distribution
+    static constexpr int32 ClusterIterations = 4;
+    TArray<int32> Region;
+    Region.SetNumUninitialized(Vertices.Num());
+    TArray<FVector> Sums;
+    for (int32 Iteration = 0; Iteration <= ClusterIterations; ++Iteration)
+    {
+        Sums.Init(FVector::ZeroVector, PieceCount);
+        for (int32 Index = 0; Index < Directions.Num(); ++Index)
+        {
+            int32 Best = 0;
+            double BestDot = -MAX_dbl;
+            for (int32 Piece = 0; Piece < PieceCount; ++Piece)
+            {
+                const double Dot = FVector::DotProduct(Directions[Index], Centers[Piece]);
+                if (Dot > BestDot)
+                {
+                    BestDot = Dot;
+                    Best = Piece;
+                }
+            }
+            Region[Index] = Best;
+            Sums[Best] += Directions[Index];
+        }
+
+        if (Iteration < ClusterIterations)
+        {
+            for (int32 Piece = 0; Piece < PieceCount; ++Piece)
+            {
+                if (!Sums[Piece].IsNearlyZero())
+                {
+                    Centers[Piece] = Sums[Piece].GetSafeNormal();
+                }
+            }
+        }
+    }
+
+    // Whole triangles go to every cone they touch, so seams are covered twice
+    TArray<int32> Stamp;
+    Stamp.Init(INDEX_NONE, Vertices.Num());
+    for (int32 Piece = 0; Piece < PieceCount; ++Piece)
+    {
+        TArray<FVector> Points;
+        Points.Add(FVector::ZeroVector);
+        for (int32 Corner = 0; Corner + 2 < Triangles.Num(); Corner += 3)
+        {
+            const int32 A = Triangles[Corner];
+            const int32 B = Triangles[Corner + 1];
+            const int32 C = Triangles[Corner + 2];
+            if (Region[A] != Piece && Region[B] != Piece && Region[C] != Piece)
+            {
+                continue;
+            }
+            for (int32 Vertex : { A, B, C })
+            {
+                if (Stamp[Vertex] != Piece)
+                {
+                    Stamp[Vertex] = Piece;
+                    Points.Add(Vertices[Vertex]);
+                }
+            }
+        }
+
+        // The center plus fewer than three surface points has no volume
+        if (Points.Num() >= 4)
+        {
+            OutPieces.Add(MoveTemp(Points));
+        }
+    }
+}
+
+FAsteroidCollisionCacheStats FAsteroidCollisionCache::GetStats()
+{
+    using namespace AsteroidCollisionCachePrivate;
+    FCacheState& State = GetState();
+
+    FAsteroidCollisionCacheStats Stats;
+
+    FScopeLock ScopeLock(&State.Lock);
+    Stats.Hits = State.Hits;
+    Stats.Misses = State.Misses;
+    Stats.CookSeconds = State.CookSeconds;
+    for (const TPair<FAsteroidCollisionKey, FWeakCollisionShape>& Pair : State.Entries)
+    {
+        if (FAsteroidCollisionShapePtr Shape = Pair.Value.Pin())
+        {
+            ++Stats.LiveEntries;
+            for (const FAsteroidCollisionPiece& Piece : Shape->Pieces)
+            {
+                Stats.LiveHullVertices += Piece.HullVertices.Num();
+            }
+        }
+    }
+    return Stats;
+}
+
+#if !UE_BUILD_SHIPPING
+namespace AsteroidCollisionCachePrivate
+{
+    static void PrintCacheStats()
+    {
+        const FAsteroidCollisionCacheStats Stats = FAsteroidCollisionCache::GetStats();
+        const int64 Lookups = Stats.Hits + Stats.Misses;
+        UE_LOG(LogAsteroidCollisionCache, Display, TEXT("Asteroid collision cache: %d live hulls (%.1f vertices each), %lld hits / %lld cooks (%.1f%% hit rate), %.1f ms spent cooking"),
+            Stats.LiveEntries, Stats.LiveEntries > 0 ? (double)Stats.LiveHullVertices / Stats.LiveEntries : 0.0, Stats.Hits, Stats.Misses, Lookups > 0 ? 100.0 * Stats.Hits / Lookups : 0.0, Stats.CookSeconds * 1000.0);
+    }
+
+    static FAutoConsoleCommand CollisionCacheStatsCommand(
+        TEXT("Asteroid.CollisionCacheStats"),
+        TEXT("Print cooked asteroid collision cache counters."),
+        FConsoleCommandDelegate::CreateStatic(&PrintCacheStats));
+}
+#endif // !UE_BUILD_SHIPPING
@@ -0,0 +1,266 @@
+/**
+ * AsteroidDiskCache Implementation
+ *
+ * Key Systems:
+ * - Mapping and validating the cache file
+ * - Binary search lookup over the mapped entry table
+ * - Atomic (temp file + move) cache writing
+ */
+
+#include "AsteroidDiskCache.h"
+#include "AsteroidMeshRegistry.h"
+#include "Algo/BinarySearch.h"
+#include "Async/MappedFileHandle.h"
+#include "HAL/FileManager.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformFileManager.h"
+#include "Misc/Paths.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogAsteroidDiskCache, Log, All);
+
+namespace AsteroidDiskCachePrivate
+{
+    static TAutoConsoleVariable<bool> CVarDiskCacheEnabled(
+        TEXT("Asteroid.DiskCache"),
+        true,
+        TEXT("Load pre-generated asteroid geometry from Content/AsteroidCache when available."));
+
+    static constexpr uint64 DataAlignment = 16;
+
+    static FAsteroidDiskCacheFile& GetRuntimeFile()
+    {
+        // Mapped on first use; function-local static construction is thread-safe
+        static FAsteroidDiskCacheFile File(FAsteroidDiskCache::GetCacheFilePath());
+        return File;
+    }
+}
+
+// ------------------------- Mapped file -------------------------
+FAsteroidDiskCacheFile::FAsteroidDiskCacheFile(const FString& Path)
+{
+    IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+    if (!PlatformFile.FileExists(*Path))
+    {
+        return;
+    }
+
+    Handle.Reset(PlatformFile.OpenMapped(*Path));
+    if (!Handle.IsValid())
+    {
+        UE_LOG(LogAsteroidDiskCache, Warning, TEXT("Could not map asteroid cache %s"), *Path);
+        return;
+    }
+
+    const int64 FileSize = Handle->GetFileSize();
+    if (FileSize < (int64)sizeof(FAsteroidDiskCacheHeader))
+    {
+        return;
+    }
+
+    Region.Reset(Handle->MapRegion(0, FileSize));
+    if (!Region.IsValid())
+    {
+        return;
+    }
+    Data = Region->GetMappedPtr();
+
+    const FAsteroidDiskCacheHeader& Header = *reinterpret_cast<const FAsteroidDiskCacheHeader*>(Data);
+    if (Header.Magic != FAsteroidDiskCache::Magic
+        || Header.FormatVersion != FAsteroidDiskCache::FormatVersion
+        || Header.GeneratorVersion != FAsteroidGenerator::AlgorithmVersion
+        || Header.ReferenceRadius != FAsteroidMeshRegistry::ReferenceRadius)
+    {
+        UE_LOG(LogAsteroidDiskCache, Log, TEXT("Asteroid cache %s is stale (format %u, generator %u); ignoring it"),
+            *Path, Header.FormatVersion, Header.GeneratorVersion);
+        return;
+    }
+
+    const int64 TableEnd = sizeof(FAsteroidDiskCacheHeader) + (int64)Header.EntryCount * sizeof(FAsteroidDiskCacheEntry);
+    if (TableEnd > FileSize)
+    {
+        UE_LOG(LogAsteroidDiskCache, Warning, TEXT("Asteroid cache %s is truncated; ignoring it"), *Path);
+        return;
+    }
+
+    const FAsteroidDiskCacheEntry* Table = reinterpret_cast<const FAsteroidDiskCacheEntry*>(Data + sizeof(FAsteroidDiskCacheHeader));
+    for (uint32 Index = 0; Index < Header.EntryCount; ++Index)
+    {
+        const FAsteroidDiskCacheEntry& Entry = Table[Index];
+        const int64 BlockBytes = (int64)Entry.VertexCount * sizeof(FVector3f) * 2;
+        const bool bSorted = Index == 0 || Table[Index - 1].KeyHash < Entry.KeyHash;
+        if (!bSorted || Entry.VertexCount <= 0 || Entry.DataOffset % AsteroidDiskCachePrivate::DataAlignment != 0
+            || (int64)Entry.DataOffset < TableEnd || (int64)Entry.DataOffset + BlockBytes > FileSize)
+        {
+            UE_LOG(LogAsteroidDiskCache, Warning, TEXT("Asteroid cache %s has a corrupt entry table; ignoring it"), *Path);
+            return;
+        }
+    }
+
+    Entries = Table;
+    EntryCount = (int32)Header.EntryCount;
+
+    UE_LOG(LogAsteroidDiskCache, Log, TEXT("Mapped asteroid cache %s: %d shapes, %.2f MB"),
+        *Path, EntryCount, FileSize / (1024.0 * 1024.0));
+}
+
+FAsteroidDiskCacheFile::~FAsteroidDiskCacheFile()
+{
+    // The region must be released before the handle it was mapped from
+    Region.Reset();
+    Handle.Reset();
+}
+
+const FAsteroidDiskCacheEntry* FAsteroidDiskCacheFile::Find(uint64 KeyHash) const
+{
+    const int32 Index = Algo::BinarySearchBy(GetEntries(), KeyHash, &FAsteroidDiskCacheEntry::KeyHash);
+    return Index != INDEX_NONE ? &Entries[Index] : nullptr;
+}
+
+const float* FAsteroidDiskCacheFile::GetPositions(const FAsteroidDiskCacheEntry& Entry) const
+{
+    return reinterpret_cast<const float*>(Data + Entry.DataOffset);
+}
+
+const float* FAsteroidDiskCacheFile::GetNormals(const FAsteroidDiskCacheEntry& Entry) const
+{
+    return GetPositions(Entry) + (int64)Entry.VertexCount * 3;
+}
+
+// ------------------------- Runtime access -------------------------
+FString FAsteroidDiskCache::GetCacheFilePath()
+{
+    return FPaths::ConvertRelativePathToFull(FPaths::ProjectContentDir() / TEXT("AsteroidCache") / TEXT("AsteroidGeometry.bin"));
+}
+
+bool FAsteroidDiskCache::Load(const FAsteroidShapeKey& Key, FAsteroidMeshData& OutData)
+{
+    using namespace AsteroidDiskCachePrivate;
+
+    if (!CVarDiskCacheEnabled.GetValueOnAnyThread())
+    {
+        return false;
+    }
+
+    const FAsteroidDiskCacheFile& File = GetRuntimeFile();
+    if (!File.IsValid())
+    {
+        return false;
+    }
+
+    const FAsteroidDiskCacheEntry* Entry = File.Find(Key.GetStableHash());
+    if (!Entry || Entry->Frequency != Key.Frequency)
+    {
+        return false;
+    }
+
+    FAsteroidIcosphereTopologyRef Topology = FAsteroidGenerator::GetIcosphereTopology(Entry->Frequency);
+    if (Topology->UnitPositions.Num() != Entry->VertexCount)
+    {
+        return false;
+    }
+
+    const int32 Count = Entry->VertexCount;
+    const float* Positions = File.GetPositions(*Entry);
+    const float* Normals = File.GetNormals(*Entry);
+
+    OutData.Vertices.SetNumUninitialized(Count);
+    OutData.Normals.SetNumUninitialized(Count);
+    for (int32 Index = 0; Index < Count; ++Index)
+    {
+        OutData.Vertices[Index] = FVector(Positions[Index * 3 + 0], Positions[Index * 3 + 1], Positions[Index * 3 + 2]);
+        OutData.Normals[Index] = FVector(Normals[Index * 3 + 0], Normals[Index * 3 + 1], Normals[Index * 3 + 2]);
+    }
+    OutData.Topology = Topology;
+
+    return true;
+}
+
+FAsteroidDiskCacheRecord FAsteroidDiskCache::MakeRecord(uint64 KeyHash, int32 Frequency, const FAsteroidMeshData& MeshData)
+{
+    FAsteroidDiskCacheRecord Record;
+    Record.KeyHash = KeyHash;
+    Record.Frequency = Frequency;
+    Record.Positions.SetNumUninitialized(MeshData.Vertices.Num());
+    Record.Normals.SetNumUninitialized(MeshData.Normals.Num());
+    for (int32 Index = 0; Index < MeshData.Vertices.Num(); ++Index)
+    {
+        Record.Positions[Index] = FVector3f(MeshData.Vertices[Index]);
+        Record.Normals[Index] = FVector3f(MeshData.Normals[Index]);
+    }
+    return Record;
+}
+
+bool FAsteroidDiskCache::Write(const FString& Path, TArray<FAsteroidDiskCacheRecord>& Records)
+{
+    using namespace AsteroidDiskCachePrivate;
+
+    Records.Sort([](const FAsteroidDiskCacheRecord& A, const FAsteroidDiskCacheRecord& B) { return A.KeyHash < B.KeyHash; });
+
+    // Lay out the table first so every data offset is known before writing
+    TArray<FAsteroidDiskCacheEntry> Table;
+    Table.SetNum(Records.Num());
+    uint64 Offset = Align(sizeof(FAsteroidDiskCacheHeader) + Records.Num() * sizeof(FAsteroidDiskCacheEntry), DataAlignment);
+    for (int32 Index = 0; Index < Records.Num(); ++Index)
+    {
+        const FAsteroidDiskCacheRecord& Record = Records[Index];
+        check(Record.Positions.Num() == Record.Normals.Num());
+        if (Index > 0 && Records[Index - 1].KeyHash == Record.KeyHash)
+        {
+            UE_LOG(LogAsteroidDiskCache, Error, TEXT("Duplicate asteroid cache key %llx"), Record.KeyHash);
+            return false;
+        }
+
+        Table[Index].KeyHash = Record.KeyHash;
+        Table[Index].DataOffset = Offset;
+        Table[Index].Frequency = Record.Frequency;
+        Table[Index].VertexCount = Record.Positions.Num();
+        Offset = Align(Offset + Record.Positions.Num() * sizeof(FVector3f) * 2, DataAlignment);
+    }
+
+    FAsteroidDiskCacheHeader Header;
+    Header.Magic = Magic;
+    Header.FormatVersion = FormatVersion;
+    Header.GeneratorVersion = FAsteroidGenerator::AlgorithmVersion;
+    Header.EntryCount = Records.Num();
+    Header.ReferenceRadius = FAsteroidMeshRegistry::ReferenceRadius;
+
+    const FString TempPath = Path + TEXT(".tmp");
+    TUniquePtr<FArchive> Writer(IFileManager::Get().CreateFileWriter(*TempPath));
+    if (!Writer.IsValid())
+    {
+        UE_LOG(LogAsteroidDiskCache, Error, TEXT("Could not open %s for writing"), *TempPath);
+        return false;
+    }
+
+    auto PadTo = [&Writer](uint64 Target)
+    {
+        static const uint8 Zeros[DataAlignment] = {};
+        const int64 Padding = (int64)Target - Writer->Tell();
+        check(Padding >= 0 && Padding < (int64)DataAlignment);
+        Writer->Serialize(const_cast<uint8*>(Zeros), Padding);
+    };
+
+    Writer->Serialize(&Header, sizeof(Header));
+    Writer->Serialize(Table.GetData(), Table.Num() * sizeof(FAsteroidDiskCacheEntry));
+    for (int32 Index = 0; Index < Records.Num(); ++Index)
+    {
+        FAsteroidDiskCacheRecord& Record = Records[Index];
+        PadTo(Table[Index].DataOffset);
+        Writer->Serialize(Record.Positions.GetData(), Record.Positions.Num() * sizeof(FVector3f));
+        Writer->Serialize(Record.Normals.GetData(), Record.Normals.Num() * sizeof(FVector3f));
+    }
+
+    const bool bWriteOk = !Writer->IsError() && Writer->Close();
+    Writer.Reset();
+
+    if (!bWriteOk || !IFileManager::Get().Move(*Path, *TempPath, true, true))
+    {
+        UE_LOG(LogAsteroidDiskCache, Error, TEXT("Failed to write asteroid cache %s"), *Path);
+        IFileManager::Get().Delete(*TempPath);
+        return false;
+    }
+
+    UE_LOG(LogAsteroidDiskCache, Display, TEXT("Wrote asteroid cache %s: %d shapes, %.2f MB"),
+        *Path, Records.Num(), Offset / (1024.0 * 1024.0));
+    return true;
+}
@@ -0,0 +1,535 @@
+/**
+ * AsteroidFieldActor Implementation
+ *
+ * This file contains the implementation of the instanced asteroid field.
+ *
+ * Key Systems:
+ * - Deterministic instance layout from the field seed
+ * - Background variant generation and static mesh conversion
+ * - HISM component setup
+ * - Proximity promotion / demotion between instances and AAsteroidActors
+ *
+ * Instances are never removed from their HISM component. Hiding one sets
+ * its scale to zero, which keeps every instance index stable for the
+ * lifetime of the field.
+ */
+
+#include "AsteroidFieldActor.h"
+
+#include "AsteroidActor.h"
+#include "AsteroidMeshRegistry.h"
+#include "AsteroidPoolSubsystem.h"
+#include "AsteroidRandom.h"
+#include "ShipPawn.h"
+#include "Components/HierarchicalInstancedStaticMeshComponent.h"
+#include "Engine/StaticMesh.h"
+#include "Engine/World.h"
+#include "EngineUtils.h"               // TActorIterator
+#include "Materials/MaterialInterface.h"
+#include "MeshDescription.h"
+#include "StaticMeshAttributes.h"
+#include "Async/Async.h"               // Game thread hand-off
+#include "Async/ParallelFor.h"
+#include "Tasks/Task.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogAsteroidField, Log, All);
+
+namespace AsteroidFieldPrivate
+{
+    static const FName MaterialSlotName(TEXT("Asteroid"));
+}
+
+AAsteroidFieldActor::AAsteroidFieldActor()
+{
+    PrimaryActorTick.bCanEverTick = true;
+
+    FieldRoot = CreateDefaultSubobject<USceneComponent>(TEXT("FieldRoot"));
+    RootComponent = FieldRoot;
+
+    AsteroidClass = AAsteroidActor::StaticClass();
+    TriggerClass = AShipPawn::StaticClass();
+
+    // Same default surface as a standalone asteroid
+    FNoiseLayer Layer;
+    Layer.Scale = 0.1f;
+    Layer.Intensity = 1.0f;
+    Layer.Seed = -1;
+    NoiseLayers.Add(Layer);
+}
+
+void AAsteroidFieldActor::BeginPlay()
+{
+    Super::BeginPlay();
+
+    UsedFieldSeed = FieldSeed >= 0 ? FieldSeed : FAsteroidRandom::MakeGlobalSeed();
+
+    LayoutInstances();
+    GenerateVariants();
+}
+
+void AAsteroidFieldActor::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    if (GenerationCancelFlag.IsValid())
+    {
+        GenerationCancelFlag->store(true);
+        GenerationCancelFlag.Reset();
+    }
+
+    for (FAsteroidFieldInstance& Instance : Instances)
+    {
+        ReleasePromotedActor(Instance.PromotedActor.Get());
+    }
+    Instances.Reset();
+    VariantGeometry.Reset();
+    NumPromoted = 0;
+
+    Super::EndPlay(EndPlayReason);
+}
+
+void AAsteroidFieldActor::Tick(float DeltaSeconds)
+{
+    Super::Tick(DeltaSeconds);
+
+    if (!bVariantsReady)
+    {
+        return;
+    }
+
+    // Hand over from instance to actor as soon as the actor's mesh exists,
+    // otherwise the asteroid blinks out for a frame or two
+    if (NumPromoted > 0)
+    {
+        for (FAsteroidFieldInstance& Instance : Instances)
+        {
+            if (Instance.State != EAsteroidFieldInstanceState::Promoting)
+            {
+                continue;
+            }
+
+            AAsteroidActor* Actor = Instance.PromotedActor.Get();
+            if (!Actor || !Actor->IsGenerationPending())
+            {
+                SetInstanceHidden(Instance, true);
+                Instance.State = EAsteroidFieldInstanceState::Promoted;
+            }
+        }
+    }
+
+    TimeSinceCheck += DeltaSeconds;
+    if (TimeSinceCheck >= PromotionCheckInterval)
+    {
+        TimeSinceCheck = 0.0f;
+        UpdatePromotion();
+    }
+}
+
+// ------------------------- Layout -------------------------
+void AAsteroidFieldActor::LayoutInstances()
+{
+    FRandomStream Rand(UsedFieldSeed);
+    DrawVariantSeeds(Rand, VariantSeeds);
+    const int32 NumVariants = VariantSeeds.Num();
+
+    const FBox Bounds(-FieldExtent, FieldExtent);
+    const float MinR = FMath::Min(MinRadius, MaxRadius);
+    const float MaxR = FMath::Max(MinRadius, MaxRadius);
+
+    Instances.SetNum(FMath::Max(0, InstanceCount));
+    for (FAsteroidFieldInstance& Instance : Instances)
+    {
+        Instance.Variant = Rand.RandRange(0, NumVariants - 1);
+        Instance.Radius = Rand.FRandRange(MinR, MaxR);
+
+        const FVector Location = Rand.RandPointInBox(Bounds);
+        const FRotator Rotation(Rand.FRandRange(-180.0f, 180.0f), Rand.FRandRange(-180.0f, 180.0f), Rand.FRandRange(-180.0f, 180.0f));
+        Instance.LocalTransform = FTransform(Rotation, Location, FVector(Instance.Radius / FAsteroidMeshRegistry::ReferenceRadius));
+    }
+}
+
+void AAsteroidFieldActor::DrawVariantSeeds(FRandomStream& Rand, TArray<int32>& OutSeeds) const
+{
+    OutSeeds.SetNum(FMath::Max(1, VariantCount));
+    for (int32& Seed : OutSeeds)
+    {
+        Seed = Rand.RandRange(0, MAX_int32);
+    }
+}
+
+FAsteroidGenerationParams AAsteroidFieldActor::MakeVariantParams(int32 VariantSeed, float Radius) const
+{
+    FAsteroidGenerationParams Params;
+    FAsteroidGenerator::ResolveLayerSeeds(VariantSeed, NoiseLayers, Params.LayerSeeds);
+    Params.Radius = Radius;
+    Params.Frequency = GeodesicFrequency > 0 ? GeodesicFrequency : FAsteroidGenerator::GetFrequencyForSubdivisions(Subdivisions);
+    Params.NoiseLayers = NoiseLayers;
+    Params.MaxDisplacementFraction = MaxDisplacementFraction;
+    Params.NoiseMode = NoiseMode;
+    Params.NormalWeighting = NormalWeighting;
+    Params.Density = Density;
+    return Params;
+}
+
+bool AAsteroidFieldActor::GetVariantGenerationParams(TArray<FAsteroidGenerationParams>& OutParams) const
+{
+    if (FieldSeed < 0)
+    {
+        return false;
+    }
+
+    // Same stream order as LayoutInstances, so the seeds match at runtime
+    FRandomStream Rand(FieldSeed);
+    TArray<int32> Seeds;
+    DrawVariantSeeds(Rand, Seeds);
+
+    OutParams.Reset(Seeds.Num());
+    for (int32 VariantSeed : Seeds)
+    {
+        OutParams.Add(MakeVariantParams(VariantSeed, FAsteroidMeshRegistry::ReferenceRadius));
+    }
+    return true;
+}
+
+// ------------------------- Variant generation -------------------------
+void AAsteroidFieldActor::GenerateVariants()
+{
+    // Params are built here so the worker never reads UPROPERTYs
+    TArray<FAsteroidGenerationParams> VariantParams;
+    VariantParams.Reserve(VariantSeeds.Num());
+    for (int32 VariantSeed : VariantSeeds)
+    {
+        VariantParams.Add(MakeVariantParams(VariantSeed, FAsteroidMeshRegistry::ReferenceRadius));
+    }
+
+    TSharedPtr<std::atomic<bool>, ESPMode::ThreadSafe> CancelFlag = MakeShared<std::atomic<bool>, ESPMode::ThreadSafe>(false);
+    GenerationCancelFlag = CancelFlag;
+
+    TWeakObjectPtr<AAsteroidFieldActor> WeakThis(this);
+    UE::Tasks::Launch(UE_SOURCE_LOCATION, [WeakThis, CancelFlag, VariantParams = MoveTemp(VariantParams)]()
+    {
+        // Going through the registry means promoted actors find their shape already built
+        TSharedPtr<TArray<FAsteroidSharedMeshPtr>, ESPMode::ThreadSafe> VariantData = MakeShared<TArray<FAsteroidSharedMeshPtr>, ESPMode::ThreadSafe>();
+        VariantData->SetNum(VariantParams.Num());
+
+        ParallelFor(VariantParams.Num(), [&](int32 Variant)
+        {
+            (*VariantData)[Variant] = FAsteroidMeshRegistry::FindOrGenerate(VariantParams[Variant], CancelFlag.Get());
+        });
+
+        if (CancelFlag->load())
+        {
+            return;
+        }
+
+        AsyncTask(ENamedThreads::GameThread, [WeakThis, CancelFlag, VariantData]()
+        {
+            AAsteroidFieldActor* Self = WeakThis.Get();
+            if (!Self || CancelFlag->load())
+            {
+                return;
+            }
+
+            Self->GenerationCancelFlag.Reset();
+            Self->OnVariantsGenerated(*VariantData);
+        });
+    }, UE::Tasks::ETaskPriority::BackgroundHigh);
+}
+
+UStaticMesh* AAsteroidFieldActor::BuildVariantMesh(const FAsteroidMeshData& MeshData)
+{
+    FMeshDescription MeshDescription;
+    FStaticMeshAttributes Attributes(MeshDescription);
+    Attributes.Register();
+
+    TVertexAttributesRef<FVector3f> Positions = Attributes.GetVertexPositions();
+    TVertexInstanceAttributesRef<FVector3f> Normals = Attributes.GetVertexInstanceNormals();
+    TVertexInstanceAttributesRef<FVector2f> UVs = Attributes.GetVertexInstanceUVs();
+
+    const TArray<int32>& Triangles = MeshData.GetTriangles();
+    const int32 NumVertices = MeshData.Vertices.Num();
+    const int32 NumTriangles = Triangles.Num() / 3;
+
+    MeshDescription.ReserveNewVertices(NumVertices);
+    MeshDescription.ReserveNewVertexInstances(NumVertices);
+    MeshDescription.ReserveNewTriangles(NumTriangles);
+    MeshDescription.ReserveNewPolygons(NumTriangles);
+    MeshDescription.ReserveNewEdges(NumTriangles * 3 / 2);
+
+    const FPolygonGroupID Group = MeshDescription.CreatePolygonGroup();
+    Attributes.GetPolygonGroupMaterialSlotNames()[Group] = AsteroidFieldPrivate::MaterialSlotName;
+
+    // One smooth vertex instance per position, matching the procedural mesh layout
+    TArray<FVertexInstanceID> VertexInstances;
+    VertexInstances.SetNumUninitialized(NumVertices);
+    for (int32 Index = 0; Index < NumVertices; ++Index)
+    {
+        const FVertexID Vertex = MeshDescription.CreateVertex();
+        Positions[Vertex] = FVector3f(MeshData.Vertices[Index]);
+
+        const FVertexInstanceID Instance = MeshDescription.CreateVertexInstance(Vertex);
+        Normals[Instance] = FVector3f(MeshData.Normals[Index]);
+        UVs[Instance] = FVector2f::ZeroVector;
+        VertexInstances[Index] = Instance;
+    }
+
+    for (int32 Tri = 0; Tri < NumTriangles; ++Tri)
+    {
+        const FVertexInstanceID Corners[3] = {
+            VertexInstances[Triangles[Tri * 3 + 0]],
+            VertexInstances[Triangles[Tri * 3 + 1]],
+            VertexInstances[Triangles[Tri * 3 + 2]]
+        };
+        MeshDescription.CreateTriangle(Group, Corners);
+    }
+
+    UStaticMesh* Mesh = NewObject<UStaticMesh>(this, NAME_None, RF_Transient);
+    Mesh->GetStaticMaterials().Add(FStaticMaterial(Material, AsteroidFieldPrivate::MaterialSlotName));
+
+    // Instances never collide; promoted actors bring their own convex hull
+    UStaticMesh::FBuildMeshDescriptionsParams BuildParams;
+    BuildParams.bFastBuild = true;
+    BuildParams.bBuildSimpleCollision = false;
+    BuildParams.bAllowCpuAccess = false;
+    Mesh->BuildFromMeshDescriptions({ &MeshDescription }, BuildParams);
+
+    return Mesh;
+}
+
+void AAsteroidFieldActor::OnVariantsGenerated(TArray<FAsteroidSharedMeshPtr>& VariantData)
+{
+    VariantGeometry = MoveTemp(VariantData);
+
+    const int32 NumVariants = VariantGeometry.Num();
+    VariantMeshes.SetNum(NumVariants);
+    VariantComponents.SetNum(NumVariants);
+
+    for (int32 Variant = 0; Variant < NumVariants; ++Variant)
+    {
+        VariantMeshes[Variant] = BuildVariantMesh(VariantGeometry[Variant]->MeshData);
+
+        UHierarchicalInstancedStaticMeshComponent* HISM = NewObject<UHierarchicalInstancedStaticMeshComponent>(this);
+        HISM->SetupAttachment(FieldRoot);
+        HISM->SetMobility(EComponentMobility::Movable);
+        HISM->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+        HISM->SetStaticMesh(VariantMeshes[Variant]);
+        HISM->RegisterComponent();
+        AddInstanceComponent(HISM);
+        VariantComponents[Variant] = HISM;
+    }
+
+    // Gather per-variant transforms in field order so instance indices are known up front
+    TArray<TArray<FTransform>> VariantTransforms;
+    VariantTransforms.SetNum(NumVariants);
+    for (FAsteroidFieldInstance& Instance : Instances)
+    {
+        TArray<FTransform>& Transforms = VariantTransforms[Instance.Variant];
+        Instance.InstanceIndex = Transforms.Num();
+        Transforms.Add(Instance.State == EAsteroidFieldInstanceState::Instanced ? Instance.LocalTransform : FTransform(Instance.LocalTransform.GetRotation(), Instance.LocalTransform.GetLocation(), FVector::ZeroVector));
+    }
+
+    for (int32 Variant = 0; Variant < NumVariants; ++Variant)
+    {
+        VariantComponents[Variant]->AddInstances(VariantTransforms[Variant], false);
+    }
+
+    bVariantsReady = true;
+
+    UE_LOG(LogAsteroidField, Log, TEXT("Asteroid field ready: %d instances, %d variants (seed %d)"),
+        Instances.Num(), NumVariants, UsedFieldSeed);
+}
+
+// ------------------------- Promotion -------------------------
+void AAsteroidFieldActor::SetInstanceHidden(const FAsteroidFieldInstance& Instance, bool bHidden)
+{
+    if (!VariantComponents.IsValidIndex(Instance.Variant) || Instance.InstanceIndex == INDEX_NONE)
+    {
+        return;
+    }
+
+    FTransform Transform = Instance.LocalTransform;
+    if (bHidden)
+    {
+        Transform.SetScale3D(FVector::ZeroVector);
+    }
+    VariantComponents[Instance.Variant]->UpdateInstanceTransform(Instance.InstanceIndex, Transform, false, true, true);
+}
+
+AAsteroidActor* AAsteroidFieldActor::PromoteInstance(int32 Index)
+{
+    UWorld* World = GetWorld();
+    if (!World || !Instances.IsValidIndex(Index) || !VariantSeeds.IsValidIndex(Instances[Index].Variant))
+    {
+        return nullptr;
+    }
+
+    FAsteroidFieldInstance& Instance = Instances[Index];
+    if (Instance.State != EAsteroidFieldInstanceState::Instanced)
+    {
+        return nullptr;
+    }
+
+    FTransform SpawnTransform = Instance.LocalTransform;
+    SpawnTransform.SetScale3D(FVector::OneVector);
+    SpawnTransform = SpawnTransform * GetActorTransform();
+
+    UClass* Class = AsteroidClass ? AsteroidClass.Get() : AAsteroidActor::StaticClass();
+    const int32 VariantSeed = VariantSeeds[Instance.Variant];
+
+    // Same seed and shape settings as the variant, at the instance's own radius
+    auto Configure = [this, VariantSeed, &Instance](AAsteroidActor& Asteroid)
+    {
+        Asteroid.GlobalSeed = VariantSeed;
+        Asteroid.MinRadius = Instance.Radius;
+        Asteroid.MaxRadius = Instance.Radius;
+        Asteroid.Subdivisions = Subdivisions;
+        Asteroid.GeodesicFrequency = GeodesicFrequency;
+        Asteroid.NoiseLayers = NoiseLayers;
+        Asteroid.MaxDisplacementFraction = MaxDisplacementFraction;
+        Asteroid.NoiseMode = NoiseMode;
+        Asteroid.NormalWeighting = NormalWeighting;
+        Asteroid.Density = Density;
+        Asteroid.GenerationPriority = EAsteroidGenerationPriority::High;
+        if (Material)
+        {
+            Asteroid.ProcMesh->SetMaterial(0, Material);
+        }
+    };
+
+    AAsteroidActor* Actor = nullptr;
+    if (UAsteroidPoolSubsystem* Pool = UAsteroidPoolSubsystem::Get(this))
+    {
+        Actor = Pool->AcquireAsteroid(Class, SpawnTransform, Configure, this);
+    }
+    else if (AAsteroidActor* Spawned = World->SpawnActorDeferred<AAsteroidActor>(Class, SpawnTransform, this, nullptr, ESpawnActorCollisionHandlingMethod::AlwaysSpawn))
+    {
+        Configure(*Spawned);
+        Spawned->FinishSpawning(SpawnTransform);
+        Actor = Spawned;
+    }
+
+    if (!Actor)
+    {
+        return nullptr;
+    }
+
+    Instance.PromotedActor = Actor;
+    Instance.State = EAsteroidFieldInstanceState::Promoting;
+    ++NumPromoted;
+
+    return Actor;
+}
+
+void AAsteroidFieldActor::DemoteInstance(int32 Index)
+{
+    if (!Instances.IsValidIndex(Index))
+    {
+        return;
+    }
+
+    FAsteroidFieldInstance& Instance = Instances[Index];
+    AAsteroidActor* Actor = Instance.PromotedActor.Get();
+    if (Instance.State == EAsteroidFieldInstanceState::Instanced || !Actor)
+    {
+        return;
+    }
+
+    // Keep the asteroid where physics left it
+    FTransform Transform = Actor->GetActorTransform().GetRelativeTransform(GetActorTransform());
+    Transform.SetScale3D(FVector(Instance.Radius / FAsteroidMeshRegistry::ReferenceRadius));
+    Instance.LocalTransform = Transform;
+
+    Instance.State = EAsteroidFieldInstanceState::Instanced;
+    Instance.PromotedActor.Reset();
+    --NumPromoted;
+
+    SetInstanceHidden(Instance, false);
+    ReleasePromotedActor(Actor);
+}
+
+void AAsteroidFieldActor::ReleasePromotedActor(AAsteroidActor* Actor)
+{
+    if (!Actor)
+    {
+        return;
+    }
+
+    if (UAsteroidPoolSubsystem* Pool = UAsteroidPoolSubsystem::Get(this))
+    {
+        Pool->ReleaseAsteroid(Actor);
+    }
+    else
+    {
+        Actor->Destroy();
+    }
+}
+
+void AAsteroidFieldActor::UpdatePromotion()
+{
+    UWorld* World = GetWorld();
+    if (!World)
+    {
+        return;
+    }
+
+    TArray<FVector, TInlineAllocator<4>> TriggerLocations;
+    for (TActorIterator<AActor> It(World, TriggerClass ? TriggerClass.Get() : AShipPawn::StaticClass()); It; ++It)
+    {
+        TriggerLocations.Add(It->GetActorLocation());
+    }
+
+    if (TriggerLocations.Num() == 0 && NumPromoted == 0)
+    {
+        return;
+    }
+
+    const FTransform& FieldTransform = GetActorTransform();
+    const float EffectiveDemotionRadius = FMath::Max(DemotionRadius, PromotionRadius);
+
+    for (int32 Index = 0; Index < Instances.Num(); ++Index)
+    {
+        FAsteroidFieldInstance& Instance = Instances[Index];
+        if (Instance.State == EAsteroidFieldInstanceState::Gone)
+        {
+            continue;
+        }
+
+        FVector Location;
+        AAsteroidActor* Actor = Instance.PromotedActor.Get();
+        if (Instance.State == EAsteroidFieldInstanceState::Instanced)
+        {
+            Location = FieldTransform.TransformPosition(Instance.LocalTransform.GetLocation());
+        }
+        else if (Actor && !Actor->IsFractured())
+        {
+            Location = Actor->GetActorLocation();
+        }
+        else
+        {
+            // Broken up, or destroyed elsewhere - the asteroid is gone for good
+            // and its instance stays hidden
+            Instance.State = EAsteroidFieldInstanceState::Gone;
+            Instance.PromotedActor.Reset();
+            --NumPromoted;
+            SetInstanceHidden(Instance, true);
+            ReleasePromotedActor(Actor);
+            continue;
+        }
+
+        float ClosestSurfaceDistance = TNumericLimits<float>::Max();
+        for (const FVector& Trigger : TriggerLocations)
+        {
+            ClosestSurfaceDistance = FMath::Min(ClosestSurfaceDistance, (float)FVector::Dist(Trigger, Location) - Instance.Radius);
+        }
+
+        if (Instance.State == EAsteroidFieldInstanceState::Instanced)
+        {
+            if (ClosestSurfaceDistance <= PromotionRadius)
+            {
+                PromoteInstance(Index);
+            }
+        }
+        else if (bAllowDemotion && Instance.State == EAsteroidFieldInstanceState::Promoted && ClosestSurfaceDistance > EffectiveDemotionRadius)
+        {
+            DemoteInstance(Index);
+        }
+    }
+}
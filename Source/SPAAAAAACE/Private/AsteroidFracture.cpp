@@ -0,0 +1,371 @@
+/**
+ * AsteroidFracture Implementation
+ *
+ * Key Systems:
+ * - Voronoi assignment of triangles to fragment sites
+ * - Patch extraction, boundary walls and exact cone volumes
+ * - Bounded collision hull per fragment
+ * - Weak-reference fracture set cache guarded by a critical section
+ */
+
+#include "AsteroidFracture.h"
+#include "AsteroidScratch.h"
+#include "Math/RandomStream.h"
+#include "Misc/ScopeLock.h"
+
+namespace AsteroidFracturePrivate
+{
+    typedef TWeakPtr<const FAsteroidFractureSet, ESPMode::ThreadSafe> FWeakFractureSet;
+
+    struct FCacheKey
+    {
+        FAsteroidShapeKey Shape;
+        int32 FragmentCount = 0;
+
+        bool operator==(const FCacheKey& Other) const { return FragmentCount == Other.FragmentCount && Shape == Other.Shape; }
+        friend uint32 GetTypeHash(const FCacheKey& Key) { return HashCombineFast(GetTypeHash(Key.Shape), GetTypeHash(Key.FragmentCount)); }
+    };
+
+    struct FCacheState
+    {
+        FCriticalSection Lock;
+        TMap<FCacheKey, FWeakFractureSet> Entries;
+
+        /** Entry count at which the next sweep of expired entries happens */
+        int32 SweepThreshold = 64;
+    };
+
+    static FCacheState& GetState()
+    {
+        static FCacheState State;
+        return State;
+    }
+
+    /** Drops entries whose last user has gone. Caller holds the lock. */
+    static void SweepExpired(FCacheState& State)
+    {
+        for (auto It = State.Entries.CreateIterator(); It; ++It)
+        {
+            if (!It.Value().IsValid())
+            {
+                It.RemoveCurrent();
+            }
+        }
+        State.SweepThreshold = FMath::Max(64, State.Entries.Num() * 2);
+    }
+
+    static bool IsCancelled(const std::atomic<bool>* CancelFlag)
+    {
+        return CancelFlag && CancelFlag->load(std::memory_order_relaxed);
+    }
+
+    /** Triangle across edge A-B from Triangle, found through B's corners; INDEX_NONE if open */
+    static int32 FindNeighbour(const FAsteroidIcosphereTopology& Topology, int32 Triangle, int32 A, int32 B)
+    {
+        const TArray<int32>& Triangles = Topology.Triangles;
+        for (int32 Slot = Topology.VertexCornerOffsets[B]; Slot < Topology.VertexCornerOffsets[B + 1]; ++Slot)
+        {
+            const int32 Other = Topology.VertexCorners[Slot] / 3;
+            if (Other != Triangle && (Triangles[Other * 3] == A || Triangles[Other * 3 + 1] == A || Triangles[Other * 3 + 2] == A))
+            {
+                return Other;
+            }
+        }
+        return INDEX_NONE;
+    }
+}
+
+SIZE_T FAsteroidFractureSet::GetAllocatedSize() const
+{
+    SIZE_T Bytes = Fragments.GetAllocatedSize();
+    for (const FAsteroidFragment& Fragment : Fragments)
+    {
+        Bytes += Fragment.Vertices.GetAllocatedSize() + Fragment.Normals.GetAllocatedSize() + Fragment.Triangles.GetAllocatedSize();
+        if (Fragment.Collision.IsValid())
+        {
+            for (const FAsteroidCollisionPiece& Piece : Fragment.Collision->Pieces)
+            {
+                Bytes += Piece.HullVertices.GetAllocatedSize();
+            }
+        }
+    }
+    return Bytes;
+}
+
+// ------------------------- Builder -------------------------
+bool FAsteroidFracture::BuildFractureSet(TConstArrayView<FVector> Vertices, TConstArrayView<FVector> Normals, const FAsteroidIcosphereTopology& Topology, float ToReference, int32 FragmentCount, int32 Seed, FAsteroidFractureSet& OutSet, const std::atomic<bool>* CancelFlag)
+{
+    using namespace AsteroidFracturePrivate;
+
+    const TArray<int32>& Triangles = Topology.Triangles;
+    const int32 NumTriangles = Triangles.Num() / 3;
+    const int32 NumVertices = Topology.UnitPositions.Num();
+    if (NumTriangles == 0 || Vertices.Num() != NumVertices || Normals.Num() != NumVertices)
+    {
+        return false;
+    }
+
+    const int32 NumSites = FMath::Clamp(FragmentCount, 2, MaxFragments);
+    OutSet.FragmentCount = NumSites;
+    OutSet.Fragments.Reset();
+
+    FRandomStream Rand(Seed);
+    TArray<FVector3f, TInlineAllocator<MaxFragments>> Sites;
+    for (int32 Site = 0; Site < NumSites; ++Site)
+    {
+        Sites.Add(FVector3f(Rand.GetUnitVector()));
+    }
+
+    // Bucketing and remap tables are per-call scratch
+    FAsteroidScratchMark ScratchMark;
+    FAsteroidScratch& Scratch = FAsteroidScratch::Get();
+
+    // Cells follow the undisplaced sphere, so cuts do not wander with the noise.
+    // Triangles are bucketed per site with a counting sort.
+    TArrayView<uint8> TriangleSite = Scratch.AllocArray<uint8>(NumTriangles);
+    TArray<int32, TInlineAllocator<MaxFragments + 1>> SiteOffsets;
+    SiteOffsets.SetNumZeroed(NumSites + 1);
+
+    const FAsteroidVertexWorkspace& Unit = Topology.UnitPositions;
+    for (int32 Triangle = 0; Triangle < NumTriangles; ++Triangle)
+    {
+        const int32 A = Triangles[Triangle * 3];
+        const int32 B = Triangles[Triangle * 3 + 1];
+        const int32 C = Triangles[Triangle * 3 + 2];
+        const FVector3f Centroid = Unit.Get(A) + Unit.Get(B) + Unit.Get(C);
+
+        int32 Best = 0;
+        float BestDot = -TNumericLimits<float>::Max();
+        for (int32 Site = 0; Site < NumSites; ++Site)
+        {
+            const float Dot = FVector3f::DotProduct(Centroid, Sites[Site]);
+            if (Dot > BestDot)
+            {
+                BestDot = Dot;
+                Best = Site;
+            }
+        }
+        TriangleSite[Triangle] = (uint8)Best;
+        ++SiteOffsets[Best + 1];
+    }
+
+    for (int32 Site = 0; Site < NumSites; ++Site)
+    {
+        SiteOffsets[Site + 1] += SiteOffsets[Site];
+    }
+
+    TArrayView<int32> SiteTriangles = Scratch.AllocArray<int32>(NumTriangles);
+    {
+        TArray<int32, TInlineAllocator<MaxFragments>> Cursor(SiteOffsets.GetData(), NumSites);
+        for (int32 Triangle = 0; Triangle < NumTriangles; ++Triangle)
+        {
+            SiteTriangles[Cursor[TriangleSite[Triangle]]++] = Triangle;
+        }
+    }
+
+    if (IsCancelled(CancelFlag))
+    {
+        return false;
+    }
+
+    auto GetPosition = [&Vertices, ToReference](int32 Vertex) { return Vertices[Vertex] * ToReference; };
+
+    // Signed volume against the origin; its sign also tells the winding
+    double TotalVolume = 0.0;
+    for (int32 Triangle = 0; Triangle < NumTriangles; ++Triangle)
+    {
+        const FVector A = GetPosition(Triangles[Triangle * 3]);
+        const FVector B = GetPosition(Triangles[Triangle * 3 + 1]);
+        const FVector C = GetPosition(Triangles[Triangle * 3 + 2]);
+        TotalVolume += FVector::DotProduct(A, FVector::CrossProduct(B, C)) / 6.0;
+    }
+    if (FMath::IsNearlyZero(TotalVolume))
+    {
+        return false;
+    }
+    const double Winding = TotalVolume > 0.0 ? 1.0 : -1.0;
+
+    // Mesh vertex -> fragment vertex, reset after each fragment
+    TArrayView<int32> Remap = Scratch.AllocArray<int32>(NumVertices, INDEX_NONE);
+    TArrayView<int32> Touched = Scratch.AllocArray<int32>(NumVertices);
+    int32 NumTouched = 0;
+
+    for (int32 Site = 0; Site < NumSites; ++Site)
+    {
+        if (IsCancelled(CancelFlag))
+        {
+            return false;
+        }
+
+        const int32 First = SiteOffsets[Site];
+        const int32 End = SiteOffsets[Site + 1];
+        if (First == End)
+        {
+            continue;
+        }
+
+        FAsteroidFragment Fragment;
+        Fragment.Triangles.Reserve((End - First) * 3);
+        double Volume = 0.0;
+        FVector Moment = FVector::ZeroVector;
+
+        for (int32 Slot = First; Slot < End; ++Slot)
+        {
+            const int32 Triangle = SiteTriangles[Slot];
+            int32 Corners[3];
+            FVector Points[3];
+            for (int32 Corner = 0; Corner < 3; ++Corner)
+            {
+                const int32 Vertex = Triangles[Triangle * 3 + Corner];
+                if (Remap[Vertex] == INDEX_NONE)
+                {
+                    Remap[Vertex] = Fragment.Vertices.Add(GetPosition(Vertex));
+                    Fragment.Normals.Add(Normals[Vertex]);
+                    Touched[NumTouched++] = Vertex;
+                }
+                Corners[Corner] = Vertex;
+                Points[Corner] = GetPosition(Vertex);
+                Fragment.Triangles.Add(Remap[Vertex]);
+            }
+
+            // Cone from the origin: the walls add no volume
+            const double TetraVolume = FVector::DotProduct(Points[0], FVector::CrossProduct(Points[1], Points[2])) / 6.0;
+            Volume += TetraVolume;
+            Moment += (Points[0] + Points[1] + Points[2]) * (TetraVolume * 0.25);
+
+            // Close every edge whose neighbour belongs to another fragment
+            for (int32 Edge = 0; Edge < 3; ++Edge)
+            {
+                const int32 A = Corners[Edge];
+                const int32 B = Corners[(Edge + 1) % 3];
+                const int32 Neighbour = FindNeighbour(Topology, Triangle, A, B);
+                if (Neighbour != INDEX_NONE && TriangleSite[Neighbour] == Site)
+                {
+                    continue;
+                }
+
+                // Stands in for the neighbour's B -> A edge, so the winding matches
+                const FVector& PointA = Points[Edge];
+                const FVector& PointB = Points[(Edge + 1) % 3];
+                const FVector WallNormal = (FVector::CrossProduct(PointA - PointB, -PointB) * Winding).GetSafeNormal();
+
+                const int32 Base = Fragment.Vertices.Num();
+                Fragment.Vertices.Add(PointB);
+                Fragment.Vertices.Add(PointA);
+                Fragment.Vertices.Add(FVector::ZeroVector);
+                Fragment.Normals.Add(WallNormal);
+                Fragment.Normals.Add(WallNormal);
+                Fragment.Normals.Add(WallNormal);
+                Fragment.Triangles.Add(Base);
+                Fragment.Triangles.Add(Base + 1);
+                Fragment.Triangles.Add(Base + 2);
+            }
+        }
+
+        for (int32 Index = 0; Index < NumTouched; ++Index)
+        {
+            Remap[Touched[Index]] = INDEX_NONE;
+        }
+        NumTouched = 0;
+
+        if (Volume * Winding <= 0.0)
+        {
+            continue;
+        }
+
+        // Pivot on the centre of mass
+        Fragment.Center = Moment / Volume;
+        Fragment.MassFraction = Volume / TotalVolume;
+        float MaxDistanceSquared = 0.0f;
+        for (FVector& Vertex : Fragment.Vertices)
+        {
+            Vertex -= Fragment.Center;
+            MaxDistanceSquared = FMath::Max(MaxDistanceSquared, (float)Vertex.SizeSquared());
+        }
+        Fragment.BoundingRadius = FMath::Sqrt(MaxDistanceSquared);
+
+        // Cooked here, on the builder's thread, so breaking never cooks
+        Fragment.Collision = FAsteroidCollisionCache::CookUncached(Fragment.Vertices, TConstArrayView<int32>(), Fragment.BoundingRadius, FragmentHullVertices, FragmentHullTolerance);
+
+        OutSet.Fragments.Add(MoveTemp(Fragment));
+    }
+
+    return OutSet.Fragments.Num() > 0;
+}
+
+// ------------------------- Cache -------------------------
+FAsteroidFractureSetPtr FAsteroidFracture::Find(const FAsteroidShapeKey& Key, int32 FragmentCount)
+{
+    using namespace AsteroidFracturePrivate;
+    FCacheState& State = GetState();
+
+    FCacheKey CacheKey;
+    CacheKey.Shape = Key;
+    CacheKey.FragmentCount = FMath::Clamp(FragmentCount, 2, MaxFragments);
+
+    FScopeLock ScopeLock(&State.Lock);
+    if (const FWeakFractureSet* Entry = State.Entries.Find(CacheKey))
+    {
+        return Entry->Pin();
+    }
+    return nullptr;
+}
+
+FAsteroidFractureSetPtr FAsteroidFracture::FindOrBuild(const FAsteroidShapeKey& Key, int32 FragmentCount, TConstArrayView<FVector> Vertices, TConstArrayView<FVector> Normals, const FAsteroidIcosphereTopology& Topology, float ToReference, const std::atomic<bool>* CancelFlag)
+{
+    using namespace AsteroidFracturePrivate;
+    FCacheState& State = GetState();
+
+    FragmentCount = FMath::Clamp(FragmentCount, 2, MaxFragments);
+    if (FAsteroidFractureSetPtr Existing = Find(Key, FragmentCount))
+    {
+        return Existing;
+    }
+
+    // Build outside the lock; duplicates racing here are resolved on insert
+    TSharedPtr<FAsteroidFractureSet, ESPMode::ThreadSafe> Set = MakeShared<FAsteroidFractureSet, ESPMode::ThreadSafe>();
+    const int32 Seed = (int32)HashCombineFast(GetTypeHash(Key), GetTypeHash(FragmentCount));
+    if (!BuildFractureSet(Vertices, Normals, Topology, ToReference, FragmentCount, Seed, *Set, CancelFlag))
+    {
+        return nullptr;
+    }
+    Set->Key = Key;
+
+    FCacheKey CacheKey;
+    CacheKey.Shape = Key;
+    CacheKey.FragmentCount = Set->FragmentCount;
+
+    FScopeLock ScopeLock(&State.Lock);
+    FWeakFractureSet& Entry = State.Entries.FindOrAdd(CacheKey);
+    if (FAsteroidFractureSetPtr Winner = Entry.Pin())
+    {
+        return Winner;
+    }
+    Entry = Set;
+
+    if (State.Entries.Num() >= State.SweepThreshold)
+    {
+        SweepExpired(State);
+    }
+
+    return Set;
+}
+
+void FAsteroidFracture::GetCacheStats(int32& OutLiveSets, SIZE_T& OutLiveBytes)
+{
+    using namespace AsteroidFracturePrivate;
+    FCacheState& State = GetState();
+
+    OutLiveSets = 0;
+    OutLiveBytes = 0;
+
+    FScopeLock ScopeLock(&State.Lock);
+    for (const TPair<FCacheKey, FWeakFractureSet>& Pair : State.Entries)
+    {
+        if (FAsteroidFractureSetPtr Set = Pair.Value.Pin())
+        {
+            ++OutLiveSets;
+            OutLiveBytes += Set->GetAllocatedSize();
+        }
+    }
+}
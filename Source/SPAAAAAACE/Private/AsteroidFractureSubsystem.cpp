@@ -0,0 +1,259 @@
+/**
+ * AsteroidFractureSubsystem Implementation
+ *
+ * Key Systems:
+ * - Break queue with a per-frame cap
+ * - Fragment budget (oldest fragments recycled first) and expiry
+ * - Fragment actor pool
+ * - Velocity hand-over from the parent asteroid
+ */
+
+#include "AsteroidFractureSubsystem.h"
+#include "AsteroidActor.h"
+#include "AsteroidFracture.h"
+#include "AsteroidFragmentActor.h"
+#include "AsteroidPhysicsSubsystem.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogAsteroidFracture, Log, All);
+
+// ------------------------- Lifecycle -------------------------
+bool UAsteroidFractureSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+    return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UAsteroidFractureSubsystem::Deinitialize()
+{
+    PendingFractures.Reset();
+    ActiveFragments.Reset();
+    PooledFragments.Reset();
+
+    Super::Deinitialize();
+}
+
+TStatId UAsteroidFractureSubsystem::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(UAsteroidFractureSubsystem, STATGROUP_Tickables);
+}
+
+UAsteroidFractureSubsystem* UAsteroidFractureSubsystem::Get(const UObject* WorldContext)
+{
+    UWorld* World = WorldContext ? WorldContext->GetWorld() : nullptr;
+    return World ? World->GetSubsystem<UAsteroidFractureSubsystem>() : nullptr;
+}
+
+void UAsteroidFractureSubsystem::Tick(float DeltaTime)
+{
+    Super::Tick(DeltaTime);
+
+    // Breaks past the cap are dropped rather than carried over, so a chain
+    // reaction cannot build up a backlog; the next hit can ask again
+    int32 Handled = 0;
+    TArray<FPendingFracture> Pending = MoveTemp(PendingFractures);
+    PendingFractures.Reset();
+    for (const FPendingFracture& Request : Pending)
+    {
+        AAsteroidActor* Asteroid = Request.Asteroid.Get();
+        if (!Asteroid)
+        {
+            continue;
+        }
+
+        if (Handled >= MaxFracturesPerFrame)
+        {
+            ++NumRefused;
+            continue;
+        }
+
+        if (FractureAsteroid(Asteroid, Request.ImpactPoint))
+        {
+            ++Handled;
+        }
+    }
+
+    // Lifetime is the same for every fragment, so the list is in expiry order
+    const UWorld* World = GetWorld();
+    const double Now = World ? World->GetTimeSeconds() : 0.0;
+    int32 Expired = 0;
+    while (Expired < ActiveFragments.Num() && ActiveFragments[Expired].ExpireTime <= Now)
+    {
+        ++Expired;
+    }
+    ReleaseOldestFragments(Expired);
+}
+
+// ------------------------- Fracture -------------------------
+void UAsteroidFractureSubsystem::RequestFracture(AAsteroidActor* Asteroid, const FVector& ImpactPoint)
+{
+    if (!bEnabled || !IsValid(Asteroid) || Asteroid->IsFractured())
+    {
+        return;
+    }
+
+    // One hit usually reports several contacts
+    for (const FPendingFracture& Request : PendingFractures)
+    {
+        if (Request.Asteroid == Asteroid)
+        {
+            return;
+        }
+    }
+
+    FPendingFracture& Request = PendingFractures.AddDefaulted_GetRef();
+    Request.Asteroid = Asteroid;
+    Request.ImpactPoint = ImpactPoint;
+}
+
+bool UAsteroidFractureSubsystem::FractureAsteroid(AAsteroidActor* Asteroid, FVector ImpactPoint)
+{
+    UWorld* World = GetWorld();
+    if (!bEnabled || !World || !IsValid(Asteroid) || Asteroid->IsFractured() || Asteroid->IsPooled())
+    {
+        return false;
+    }
+
+    const FAsteroidFractureSetPtr Set = Asteroid->GetFractureSet();
+    if (!Set.IsValid() || Set->Fragments.Num() == 0)
+    {
+        return false;
+    }
+
+    const int32 Count = Set->Fragments.Num();
+    if (Count > MaxActiveFragments)
+    {
+        ++NumRefused;
+        return false;
+    }
+
+    // Old debris makes room for new
+    ReleaseOldestFragments(ActiveFragments.Num() + Count - MaxActiveFragments);
+
+    // Dormant asteroids carry their motion in the physics subsystem
+    FVector LinearVelocity = FVector::ZeroVector;
+    FVector AngularVelocity = FVector::ZeroVector;
+    const UAsteroidPhysicsSubsystem* Physics = UAsteroidPhysicsSubsystem::Get(this);
+    if (!Physics || !Physics->GetAsteroidVelocity(Asteroid, LinearVelocity, AngularVelocity))
+    {
+        if (Asteroid->ProcMesh->IsSimulatingPhysics())
+        {
+            LinearVelocity = Asteroid->ProcMesh->GetPhysicsLinearVelocity();
+            AngularVelocity = Asteroid->ProcMesh->GetPhysicsAngularVelocityInRadians();
+        }
+    }
+
+    const FTransform ToWorld = Asteroid->GetFractureTransform();
+    const FVector Origin = Asteroid->GetActorLocation();
+    const double Mass = Asteroid->GetMass();
+    UMaterialInterface* Material = Asteroid->ProcMesh->GetMaterial(0);
+    const double ExpireTime = FragmentLifetime > 0.0f ? World->GetTimeSeconds() + FragmentLifetime : TNumericLimits<double>::Max();
+
+    // Parent collision goes first, or the fragments spawn inside it
+    Asteroid->MarkFractured(ImpactPoint);
+
+    for (const FAsteroidFragment& Fragment : Set->Fragments)
+    {
+        AAsteroidFragmentActor* Actor = AcquireFragment();
+        if (!Actor)
+        {
+            continue;
+        }
+
+        const FVector Center = ToWorld.TransformPosition(Fragment.Center);
+        const FVector Offset = Center - Origin;
+        const FVector Velocity = LinearVelocity + FVector::CrossProduct(AngularVelocity, Offset) + Offset.GetSafeNormal() * SeparationSpeed;
+
+        Actor->ActivateFragment(Fragment, FTransform(ToWorld.GetRotation(), Center, ToWorld.GetScale3D()),
+            Mass * Fragment.MassFraction, Velocity, AngularVelocity, Material);
+
+        FActiveFragment& Active = ActiveFragments.AddDefaulted_GetRef();
+        Active.Actor = Actor;
+        Active.ExpireTime = ExpireTime;
+    }
+
+    UE_LOG(LogAsteroidFracture, Verbose, TEXT("Asteroid %s broke into %d fragments (%d active)"),
+        *Asteroid->GetName(), Count, ActiveFragments.Num());
+    return true;
+}
+
+// ------------------------- Fragment pool -------------------------
+AAsteroidFragmentActor* UAsteroidFractureSubsystem::AcquireFragment()
+{
+    while (PooledFragments.Num() > 0)
+    {
+        if (AAsteroidFragmentActor* Fragment = PooledFragments.Pop(false).Get())
+        {
+            return Fragment;
+        }
+    }
+
+    UWorld* World = GetWorld();
+    if (!World)
+    {
+        return nullptr;
+    }
+
+    FActorSpawnParameters SpawnParams;
+    SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+    return World->SpawnActor<AAsteroidFragmentActor>(AAsteroidFragmentActor::StaticClass(), FTransform::Identity, SpawnParams);
+}
+
+void UAsteroidFractureSubsystem::ReleaseFragment(AAsteroidFragmentActor* Fragment)
+{
+    if (!IsValid(Fragment))
+    {
+        return;
+    }
+
+    if (PooledFragments.Num() < MaxPooledFragments)
+    {
+        Fragment->DeactivateFragment();
+        PooledFragments.Add(Fragment);
+    }
+    else
+    {
+        Fragment->Destroy();
+    }
+}
+
+void UAsteroidFractureSubsystem::ReleaseOldestFragments(int32 Count)
+{
+    Count = FMath::Min(Count, ActiveFragments.Num());
+    if (Count <= 0)
+    {
+        return;
+    }
+
+    for (int32 Index = 0; Index < Count; ++Index)
+    {
+        ReleaseFragment(ActiveFragments[Index].Actor.Get());
+    }
+    ActiveFragments.RemoveAt(0, Count, false);
+}
+
+// ------------------------- Console -------------------------
+#if !UE_BUILD_SHIPPING
+namespace AsteroidFractureSubsystemPrivate
+{
+    static void PrintFractureStats(UWorld* World)
+    {
+        int32 LiveSets = 0;
+        SIZE_T LiveBytes = 0;
+        FAsteroidFracture::GetCacheStats(LiveSets, LiveBytes);
+
+        if (const UAsteroidFractureSubsystem* Fracture = UAsteroidFractureSubsystem::Get(World))
+        {
+            UE_LOG(LogAsteroidFracture, Display, TEXT("Asteroid fracture: %d / %d fragments active, %d parked, %d breaks refused"),
+                Fracture->GetNumActiveFragments(), Fracture->MaxActiveFragments, Fracture->GetNumPooledFragments(), Fracture->GetNumRefused());
+        }
+        UE_LOG(LogAsteroidFracture, Display, TEXT("Asteroid fracture sets: %d live, %.2f MB"),
+            LiveSets, LiveBytes / (1024.0 * 1024.0));
+    }
+
+    static FAutoConsoleCommandWithWorld FractureStatsCommand(
+        TEXT("Asteroid.FractureStats"),
+        TEXT("Print active and parked fragment counts and fracture set cache usage."),
+        FConsoleCommandWithWorldDelegate::CreateStatic(&PrintFractureStats));
+}
+#endif // !UE_BUILD_SHIPPING
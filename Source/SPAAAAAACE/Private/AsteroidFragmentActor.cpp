@@ -0,0 +1,75 @@
+/**
+ * AsteroidFragmentActor Implementation
+ *
+ * Key Systems:
+ * - Fragment mesh upload (in place when the vertex count matches)
+ * - Precooked convex collision, mass override and inherited velocity
+ * - Parking for reuse by UAsteroidFractureSubsystem
+ */
+
+#include "AsteroidFragmentActor.h"
+#include "AsteroidFracture.h"
+
+AAsteroidFragmentActor::AAsteroidFragmentActor()
+{
+    PrimaryActorTick.bCanEverTick = false;
+
+    ProcMesh = CreateDefaultSubobject<UAsteroidMeshComponent>(TEXT("ProcMesh"));
+    RootComponent = ProcMesh;
+
+    // Same setup as AAsteroidActor: Chaos only simulates convex collision
+    ProcMesh->bUseComplexAsSimpleCollision = false;
+    ProcMesh->SetCollisionEnabled(ECollisionEnabled::QueryAndPhysics);
+    ProcMesh->SetCollisionObjectType(ECC_WorldDynamic);
+    ProcMesh->SetMobility(EComponentMobility::Movable);
+}
+
+void AAsteroidFragmentActor::ActivateFragment(const FAsteroidFragment& Fragment, const FTransform& Transform, double Mass, const FVector& LinearVelocity, const FVector& AngularVelocity, UMaterialInterface* Material)
+{
+    bActive = true;
+    SetActorTransform(Transform, false, nullptr, ETeleportType::ResetPhysics);
+
+    const FProcMeshSection* Section = ProcMesh->GetProcMeshSection(0);
+    if (Section && Section->ProcVertexBuffer.Num() == Fragment.Vertices.Num() && Section->ProcIndexBuffer.Num() == Fragment.Triangles.Num())
+    {
+        ProcMesh->UpdateMeshSection(0, Fragment.Vertices, Fragment.Normals, TArray<FVector2D>(), TArray<FColor>(), TArray<FProcMeshTangent>());
+    }
+    else
+    {
+        ProcMesh->CreateMeshSection(0, Fragment.Vertices, Fragment.Triangles, Fragment.Normals, TArray<FVector2D>(), TArray<FColor>(), TArray<FProcMeshTangent>(), false);
+    }
+    ProcMesh->SetMaterial(0, Material);
+
+    if (Fragment.Collision.IsValid())
+    {
+        ProcMesh->SetCookedCollision(Fragment.Collision);
+    }
+    else
+    {
+        // Degenerate hull; a sphere keeps the debris solid
+        ProcMesh->SetSphereCollision(Fragment.BoundingRadius);
+    }
+
+    SetActorHiddenInGame(false);
+    SetActorEnableCollision(true);
+
+    ProcMesh->SetSimulatePhysics(true);
+    ProcMesh->SetMassOverrideInKg(NAME_None, (float)Mass, true);
+    ProcMesh->SetPhysicsLinearVelocity(LinearVelocity);
+    ProcMesh->SetPhysicsAngularVelocityInRadians(AngularVelocity);
+}
+
+void AAsteroidFragmentActor::DeactivateFragment()
+{
+    bActive = false;
+
+    if (ProcMesh->IsSimulatingPhysics())
+    {
+        ProcMesh->SetPhysicsLinearVelocity(FVector::ZeroVector);
+        ProcMesh->SetPhysicsAngularVelocityInRadians(FVector::ZeroVector);
+        ProcMesh->SetSimulatePhysics(false);
+    }
+
+    SetActorHiddenInGame(true);
+    SetActorEnableCollision(false);
+}
@@ -0,0 +1,880 @@
+/**
+ * AsteroidGenerator Implementation
+ *
+ * This file contains the thread-safe geometry pipeline used by AAsteroidActor.
+ * All functions here operate purely on the data passed in and can run on
+ * worker threads.
+ *
+ * Key Systems:
+ * - Single-pass geodesic sphere construction from constexpr icosahedron tables
+ * - Compile-time specialized kernels for common (frequency, layer count) pairs
+ * - Generic-path temporaries drawn from the per-thread FAsteroidScratch arena
+ * - Multi-layer noise deformation
+ * - Vertex normal calculation
+ * - Statistics calculation (radius, volume, mass)
+ */
+
+#include "AsteroidGenerator.h"
+#include "AsteroidNoise.h"
+#include "AsteroidRandom.h"
+#include "AsteroidScratch.h"
+#include "Async/ParallelFor.h"
+
+namespace
+{
+    /** Returns true when the caller has asked the pipeline to stop. */
+    FORCEINLINE bool IsCancelled(const std::atomic<bool>* CancelFlag)
+    {
+        return CancelFlag && CancelFlag->load(std::memory_order_relaxed);
+    }
+
+    /** Work per ParallelFor task in the normal passes; small meshes stay on one thread */
+    constexpr int32 NormalTriangleChunk = 4096;
+    constexpr int32 NormalVertexChunk = 4096;
+
+    /** Cube-map cell of a direction: face-major, then row, then column */
+    int32 GetDirectionCell(const FVector3f& Direction, int32 GridSize)
+    {
+        const FVector3f Abs = Direction.GetAbs();
+        int32 Face;
+        float U, V, Major;
+        if (Abs.X >= Abs.Y && Abs.X >= Abs.Z)
+        {
+            Face = Direction.X >= 0.0f ? 0 : 1; Major = Abs.X; U = Direction.Y; V = Direction.Z;
+        }
+        else if (Abs.Y >= Abs.Z)
+        {
+            Face = Direction.Y >= 0.0f ? 2 : 3; Major = Abs.Y; U = Direction.X; V = Direction.Z;
+        }
+        else
+        {
+            Face = Direction.Z >= 0.0f ? 4 : 5; Major = Abs.Z; U = Direction.X; V = Direction.Y;
+        }
+
+        const float InvMajor = Major > SMALL_NUMBER ? 1.0f / Major : 0.0f;
+        const int32 Column = FMath::Clamp((int32)((U * InvMajor + 1.0f) * 0.5f * GridSize), 0, GridSize - 1);
+        const int32 Row = FMath::Clamp((int32)((V * InvMajor + 1.0f) * 0.5f * GridSize), 0, GridSize - 1);
+        return (Face * GridSize + Row) * GridSize + Column;
+    }
+
+    /** (1 + sqrt 5) / 2, the same float the runtime expression produced */
+    constexpr float GoldenRatio = 1.618033988749895f;
+
+    /** Icosahedron corners before normalization */
+    constexpr float IcosahedronCorners[12][3] = {
+        { -1,  GoldenRatio,  0 }, {  1,  GoldenRatio,  0 }, { -1, -GoldenRatio,  0 }, {  1, -GoldenRatio,  0 },
+        {  0, -1,  GoldenRatio }, {  0,  1,  GoldenRatio }, {  0, -1, -GoldenRatio }, {  0,  1, -GoldenRatio },
+        {  GoldenRatio,  0, -1 }, {  GoldenRatio,  0,  1 }, { -GoldenRatio,  0, -1 }, { -GoldenRatio,  0,  1 }
+    };
+
+    /** Icosahedron faces, three corner indices each */
+    constexpr int32 IcosahedronFaces[60] = {
+        0,11,5, 0,5,1, 0,1,7, 0,7,10, 0,10,11,
+        1,5,9, 5,11,4, 11,10,2, 10,7,6, 7,1,8,
+        3,9,4, 3,4,2, 3,2,6, 3,6,8, 3,8,9,
+        4,9,5, 2,4,11, 6,2,10, 8,6,7, 9,8,1
+    };
+
+    /** Vertices noise is sampled for at a time */
+    constexpr int32 NoiseChunkSize = 256;
+
+    // The generic and specialized paths share the helpers below so they
+    // perform the same float operations and produce identical meshes
+
+    FORCEINLINE void NormalizeRange(float* RESTRICT X, float* RESTRICT Y, float* RESTRICT Z, int32 Count)
+    {
+        for (int32 i = 0; i < Count; ++i)
+        {
+            const float LengthSquared = X[i] * X[i] + Y[i] * Y[i] + Z[i] * Z[i];
+            const float InvLength = LengthSquared > SMALL_NUMBER ? 1.0f / FMath::Sqrt(LengthSquared) : 0.0f;
+            X[i] *= InvLength;
+            Y[i] *= InvLength;
+            Z[i] *= InvLength;
+        }
+    }
+
+    /** Rescale so the mean distance from the center is 1, keeping the displaced shape */
+    FORCEINLINE void NormalizeMeanRadiusRange(float* RESTRICT X, float* RESTRICT Y, float* RESTRICT Z, int32 Count)
+    {
+        double Sum = 0.0;
+        for (int32 i = 0; i < Count; ++i)
+        {
+            Sum += FMath::Sqrt(X[i] * X[i] + Y[i] * Y[i] + Z[i] * Z[i]);
+        }
+        const float Scale = Sum > SMALL_NUMBER ? (float)(Count / Sum) : 0.0f;
+        for (int32 i = 0; i < Count; ++i)
+        {
+            X[i] *= Scale;
+            Y[i] *= Scale;
+            Z[i] *= Scale;
+        }
+    }
+
+    FORCEINLINE void ScaleRange(float* RESTRICT X, float* RESTRICT Y, float* RESTRICT Z, int32 Count, float Scale)
+    {
+        for (int32 i = 0; i < Count; ++i)
+        {
+            X[i] *= Scale;
+            Y[i] *= Scale;
+            Z[i] *= Scale;
+        }
+    }
+
+    /** Seed and lattice offset of one noise layer */
+    void GetLayerNoiseSetup(const TArray<int32>& LayerSeeds, int32 LayerIndex, int32& OutSeed, float& OutX, float& OutY, float& OutZ)
+    {
+        OutSeed = LayerSeeds.IsValidIndex(LayerIndex)
+            ? LayerSeeds[LayerIndex]
+            : FAsteroidRandom::Seed(FAsteroidRandomKey(0, 0, LayerIndex, EAsteroidRandomPurpose::LayerSeed));
+
+        const FAsteroidRandomKey OffsetKey(OutSeed, 0, LayerIndex, EAsteroidRandomPurpose::NoiseOffset);
+        OutX = FAsteroidRandom::Unit(OffsetKey, 0) * 1000.0f;
+        OutY = FAsteroidRandom::Unit(OffsetKey, 1) * 1000.0f;
+        OutZ = FAsteroidRandom::Unit(OffsetKey, 2) * 1000.0f;
+    }
+
+    /** Displace along the normal: V += V / |V| * clamp(Noise * Amplitude) */
+    FORCEINLINE void DisplaceRange(float* RESTRICT X, float* RESTRICT Y, float* RESTRICT Z, int32 Count, const float* RESTRICT Noise, float Amplitude, float MaxDisplacement)
+    {
+        for (int32 k = 0; k < Count; ++k)
+        {
+            const float LengthSquared = X[k] * X[k] + Y[k] * Y[k] + Z[k] * Z[k];
+            const float InvLength = LengthSquared > SMALL_NUMBER ? 1.0f / FMath::Sqrt(LengthSquared) : 0.0f;
+            const float Displacement = FMath::Clamp(Noise[k] * Amplitude, -MaxDisplacement, MaxDisplacement);
+            const float Step = Displacement * InvLength;
+            X[k] += X[k] * Step;
+            Y[k] += Y[k] * Step;
+            Z[k] += Z[k] * Step;
+        }
+    }
+
+    /** Weighted face normal at each corner of triangle (I0, I1, I2), as { X0, Y0, Z0, X1, ... } */
+    FORCEINLINE void ComputeCornerNormals(const float* RESTRICT PX, const float* RESTRICT PY, const float* RESTRICT PZ, int32 I0, int32 I1, int32 I2, EAsteroidNormalWeighting Weighting, float (&Out)[9])
+    {
+        const float E1X = PX[I1] - PX[I0], E1Y = PY[I1] - PY[I0], E1Z = PZ[I1] - PZ[I0];
+        const float E2X = PX[I2] - PX[I0], E2Y = PY[I2] - PY[I0], E2Z = PZ[I2] - PZ[I0];
+
+        // Cross product length is twice the triangle area
+        const float FX = E1Y * E2Z - E1Z * E2Y;
+        const float FY = E1Z * E2X - E1X * E2Z;
+        const float FZ = E1X * E2Y - E1Y * E2X;
+
+        float W0 = 1.0f, W1 = 1.0f, W2 = 1.0f;
+        if (Weighting != EAsteroidNormalWeighting::Area)
+        {
+            const float Length = FMath::Sqrt(FX * FX + FY * FY + FZ * FZ);
+            const float InvLength = Length > SMALL_NUMBER ? 1.0f / Length : 0.0f;
+            W0 = W1 = W2 = InvLength;
+
+            if (Weighting == EAsteroidNormalWeighting::Angle)
+            {
+                // atan2(|cross|, dot) is well conditioned for thin triangles, unlike acos
+                const float Dot0 = E1X * E2X + E1Y * E2Y + E1Z * E2Z;
+                const float Dot1 = (PX[I2] - PX[I1]) * -E1X + (PY[I2] - PY[I1]) * -E1Y + (PZ[I2] - PZ[I1]) * -E1Z;
+                const float A0 = FMath::Atan2(Length, Dot0);
+                const float A1 = FMath::Atan2(Length, Dot1);
+                const float A2 = FMath::Max(PI - A0 - A1, 0.0f);
+                W0 *= A0;
+                W1 *= A1;
+                W2 *= A2;
+            }
+        }
+
+        Out[0] = FX * W0; Out[1] = FY * W0; Out[2] = FZ * W0;
+        Out[3] = FX * W1; Out[4] = FY * W1; Out[5] = FZ * W1;
+        Out[6] = FX * W2; Out[7] = FY * W2; Out[8] = FZ * W2;
+    }
+
+    /** Unit normal from a corner sum */
+    FORCEINLINE FVector3f NormalizeSum(float SX, float SY, float SZ)
+    {
+        const float LengthSquared = SX * SX + SY * SY + SZ * SZ;
+        const float InvLength = LengthSquared > SMALL_NUMBER ? FMath::InvSqrt(LengthSquared) : 0.0f;
+        return FVector3f(SX * InvLength, SY * InvLength, SZ * InvLength);
+    }
+
+    // Pipeline stages over raw SoA ranges, so their inputs and outputs can
+    // live in scratch; the public workspace functions wrap them
+    void ApplyNoiseRange(float* RESTRICT X, float* RESTRICT Y, float* RESTRICT Z, int32 VertexCount, const TArray<FNoiseLayer>& NoiseLayers, const TArray<int32>& LayerSeeds, float MaxDisplacementFrac, EAsteroidNoiseMode NoiseMode);
+    void ComputeNormalsRange(const float* RESTRICT PX, const float* RESTRICT PY, const float* RESTRICT PZ, const FAsteroidIcosphereTopology& Topology, EAsteroidNormalWeighting Weighting, float* RESTRICT NX, float* RESTRICT NY, float* RESTRICT NZ);
+    void WriteUploadRange(const float* RESTRICT X, const float* RESTRICT Y, const float* RESTRICT Z, const float* RESTRICT NX, const float* RESTRICT NY, const float* RESTRICT NZ, int32 Count, TArray<FVector>& OutVertices, TArray<FVector>& OutNormals);
+
+    // ------------------------- Specialized kernels -------------------------
+
+    /**
+     * One vertex count and layer count known at compile time: positions
+     * live in fixed stack arrays, every layer is applied to a chunk before
+     * moving on, and normals are gathered straight into the upload buffer
+     * by recomputing each face at its corners, so no corner buffer exists.
+     */
+    template <int32 Frequency, int32 LayerCount>
+    void GenerateFixed(const FAsteroidGenerationParams& Params, const FAsteroidIcosphereTopology& Topology, FAsteroidMeshData& OutData)
+    {
+        constexpr int32 VertexCount = FAsteroidGenerator::GetVertexCount(Frequency);
+        check(Topology.UnitPositions.Num() == VertexCount);
+
+        float X[VertexCount];
+        float Y[VertexCount];
+        float Z[VertexCount];
+        FMemory::Memcpy(X, Topology.UnitPositions.X.GetData(), sizeof(X));
+        FMemory::Memcpy(Y, Topology.UnitPositions.Y.GetData(), sizeof(Y));
+        FMemory::Memcpy(Z, Topology.UnitPositions.Z.GetData(), sizeof(Z));
+
+        if constexpr (LayerCount > 0)
+        {
+            int32 Seeds[LayerCount];
+            FVector3f Offsets[LayerCount];
+            for (int32 Layer = 0; Layer < LayerCount; ++Layer)
+            {
+                float OX, OY, OZ;
+                GetLayerNoiseSetup(Params.LayerSeeds, Layer, Seeds[Layer], OX, OY, OZ);
+                Offsets[Layer] = FVector3f(OX * 0.25f, OY * 0.25f, OZ * 0.25f);
+            }
+
+            // A vertex only ever depends on its own earlier layers, so
+            // finishing each chunk before the next matches the generic order
+            float ChunkNoise[NoiseChunkSize];
+            for (int32 Begin = 0; Begin < VertexCount; Begin += NoiseChunkSize)
+            {
+                const int32 Count = FMath::Min(NoiseChunkSize, VertexCount - Begin);
+                for (int32 Layer = 0; Layer < LayerCount; ++Layer)
+                {
+                    const FNoiseLayer& NoiseLayer = Params.NoiseLayers[Layer];
+                    FAsteroidNoise::SampleBatch(X + Begin, Y + Begin, Z + Begin, Count, NoiseLayer.Scale, Offsets[Layer], (uint32)Seeds[Layer], ChunkNoise);
+                    DisplaceRange(X + Begin, Y + Begin, Z + Begin, Count, ChunkNoise, NoiseLayer.Intensity * 0.5f, Params.MaxDisplacementFraction);
+                }
+            }
+        }
+
+        NormalizeMeanRadiusRange(X, Y, Z, VertexCount);
+        ScaleRange(X, Y, Z, VertexCount, Params.Radius);
+
+        OutData.Vertices.SetNumUninitialized(VertexCount);
+        OutData.Normals.SetNumUninitialized(VertexCount);
+        FVector* RESTRICT Vertices = OutData.Vertices.GetData();
+        FVector* RESTRICT Normals = OutData.Normals.GetData();
+        const int32* RESTRICT Indices = Topology.Triangles.GetData();
+        const int32* RESTRICT CornerOffsets = Topology.VertexCornerOffsets.GetData();
+        const int32* RESTRICT VertexCorners = Topology.VertexCorners.GetData();
+
+        for (int32 Vertex = 0; Vertex < VertexCount; ++Vertex)
+        {
+            float SX = 0.0f, SY = 0.0f, SZ = 0.0f;
+            for (int32 Row = CornerOffsets[Vertex]; Row < CornerOffsets[Vertex + 1]; ++Row)
+            {
+                const int32 Corner = VertexCorners[Row];
+                const int32 Base = Corner - Corner % 3;
+                float CornerNormals[9];
+                ComputeCornerNormals(X, Y, Z, Indices[Base], Indices[Base + 1], Indices[Base + 2], Params.NormalWeighting, CornerNormals);
+
+                const int32 Slot = (Corner - Base) * 3;
+                SX += CornerNormals[Slot];
+                SY += CornerNormals[Slot + 1];
+                SZ += CornerNormals[Slot + 2];
+            }
+
+            Normals[Vertex] = FVector(NormalizeSum(SX, SY, SZ));
+            Vertices[Vertex] = FVector(X[Vertex], Y[Vertex], Z[Vertex]);
+        }
+    }
+
+    typedef void (*FFixedKernel)(const FAsteroidGenerationParams&, const FAsteroidIcosphereTopology&, FAsteroidMeshData&);
+
+    // Rows are subdivision levels 1-3, columns layer counts 0..MaxFixedKernelLayers.
+    // Frequency 8 keeps about 8 KB of positions on the stack; larger meshes use the generic path.
+    static_assert(FAsteroidGenerator::MaxFixedKernelLayers == 3, "One FixedKernels column per layer count");
+    constexpr FFixedKernel FixedKernels[3][4] =
+    {
+        { &GenerateFixed<2, 0>, &GenerateFixed<2, 1>, &GenerateFixed<2, 2>, &GenerateFixed<2, 3> },
+        { &GenerateFixed<4, 0>, &GenerateFixed<4, 1>, &GenerateFixed<4, 2>, &GenerateFixed<4, 3> },
+        { &GenerateFixed<8, 0>, &GenerateFixed<8, 1>, &GenerateFixed<8, 2>, &GenerateFixed<8, 3> }
+    };
+
+    /** Specialized kernel for these params, or nullptr to use the generic path */
+    FFixedKernel FindFixedKernel(int32 Frequency, const FAsteroidGenerationParams& Params)
+    {
+        const int32 LayerCount = Params.NoiseLayers.Num();
+        if (Params.NoiseMode != EAsteroidNoiseMode::ScalarField || LayerCount > FAsteroidGenerator::MaxFixedKernelLayers)
+        {
+            return nullptr;
+        }
+
+        switch (Frequency)
+        {
+        case 2: return FixedKernels[0][LayerCount];
+        case 4: return FixedKernels[1][LayerCount];
+        case 8: return FixedKernels[2][LayerCount];
+        default: return nullptr;
+        }
+    }
+}
+
+bool FAsteroidGenerator::Generate(const FAsteroidGenerationParams& Params, FAsteroidMeshData& OutData, const std::atomic<bool>* CancelFlag)
+{
+    // Start from the shared unit icosphere
+    FAsteroidIcosphereTopologyRef Topology = GetIcosphereTopology(Params.Frequency);
+    OutData.Topology = Topology;
+    if (IsCancelled(CancelFlag)) return false;
+
+    if (const FFixedKernel Kernel = FindFixedKernel(Topology->Frequency, Params))
+    {
+        // Common small shapes: one specialized pass with no heap scratch
+        Kernel(Params, *Topology, OutData);
+    }
+    else
+    {
+        // Workspaces come from this thread's scratch arena; only the positions are copied
+        FAsteroidScratchMark ScratchMark;
+        FAsteroidScratch& Scratch = FAsteroidScratch::Get();
+        const int32 VertexCount = Topology->UnitPositions.Num();
+        float* X = Scratch.AllocArray<float>(VertexCount).GetData();
+        float* Y = Scratch.AllocArray<float>(VertexCount).GetData();
+        float* Z = Scratch.AllocArray<float>(VertexCount).GetData();
+        FMemory::Memcpy(X, Topology->UnitPositions.X.GetData(), VertexCount * sizeof(float));
+        FMemory::Memcpy(Y, Topology->UnitPositions.Y.GetData(), VertexCount * sizeof(float));
+        FMemory::Memcpy(Z, Topology->UnitPositions.Z.GetData(), VertexCount * sizeof(float));
+
+        // Apply noise layers with independent seeds and clamp
+        ApplyNoiseRange(X, Y, Z, VertexCount, Params.NoiseLayers, Params.LayerSeeds, Params.MaxDisplacementFraction, Params.NoiseMode);
+        if (IsCancelled(CancelFlag)) return false;
+
+        // Mean radius 1 before scaling, so volume and mass stay close to the
+        // sphere of Params.Radius; per-vertex normalization would erase the noise
+        NormalizeMeanRadiusRange(X, Y, Z, VertexCount);
+
+        // Scale to radius
+        ScaleRange(X, Y, Z, VertexCount, Params.Radius);
+        if (IsCancelled(CancelFlag)) return false;
+
+        // Normals are computed here so the game thread only has to upload them
+        float* NX = Scratch.AllocArray<float>(VertexCount).GetData();
+        float* NY = Scratch.AllocArray<float>(VertexCount).GetData();
+        float* NZ = Scratch.AllocArray<float>(VertexCount).GetData();
+        ComputeNormalsRange(X, Y, Z, *Topology, Params.NormalWeighting, NX, NY, NZ);
+        if (IsCancelled(CancelFlag)) return false;
+
+        // Leave the float workspace only for the final upload buffers
+        WriteUploadRange(X, Y, Z, NX, NY, NZ, VertexCount, OutData.Vertices, OutData.Normals);
+    }
+
+    CalculateStats(Params.Radius, Params.Density, OutData.Stats);
+    OutData.Stats.NoiseLayerSeeds = Params.LayerSeeds; // record seeds for reproducibility
+    OutData.Stats.GlobalSeed = Params.GlobalSeed;
+    OutData.Stats.AsteroidId = Params.AsteroidId;
+    return true;
+}
+
+bool FAsteroidGenerator::HasFixedKernel(const FAsteroidGenerationParams& Params)
+{
+    return FindFixedKernel(FMath::Clamp(Params.Frequency, 1, MaxFrequency), Params) != nullptr;
+}
+
+void FAsteroidGenerator::ResolveLayerSeeds(int32 GlobalSeed, const TArray<FNoiseLayer>& NoiseLayers, TArray<int32>& OutLayerSeeds)
+{
+    OutLayerSeeds.Reset(NoiseLayers.Num());
+    for (int32 i = 0; i < NoiseLayers.Num(); ++i)
+    {
+        int32 seed = NoiseLayers[i].Seed;
+        if (seed < 0)
+        {
+            // Keyed by layer index, so adding a layer does not reseed the ones before it
+            seed = FAsteroidRandom::Seed(FAsteroidRandomKey(GlobalSeed, 0, i, EAsteroidRandomPurpose::LayerSeed));
+        }
+        OutLayerSeeds.Add(seed);
+    }
+}
+
+// ------------------------- Geometry generation -------------------------
+FAsteroidIcosphereTopologyRef FAsteroidGenerator::GetIcosphereTopology(int32 Frequency)
+{
+    const int32 ClampedFrequency = FMath::Clamp(Frequency, 1, MaxFrequency);
+
+    // One slot per frequency, filled on first use and never modified afterwards
+    static TSharedPtr<const FAsteroidIcosphereTopology, ESPMode::ThreadSafe> CachedFrequencies[MaxFrequency + 1];
+    static FRWLock CacheLock;
+
+    {
+        FReadScopeLock ReadLock(CacheLock);
+        if (CachedFrequencies[ClampedFrequency].IsValid())
+        {
+            return CachedFrequencies[ClampedFrequency].ToSharedRef();
+        }
+    }
+
+    FWriteScopeLock WriteLock(CacheLock);
+    if (!CachedFrequencies[ClampedFrequency].IsValid())
+    {
+        TSharedRef<FAsteroidIcosphereTopology, ESPMode::ThreadSafe> Topology = MakeShared<FAsteroidIcosphereTopology, ESPMode::ThreadSafe>();
+        Topology->Frequency = ClampedFrequency;
+
+        // Positions are built in double precision once, then stored as float SoA
+        TArray<FVector> UnitVertices;
+        BuildGeodesicSphere(ClampedFrequency, UnitVertices, Topology->Triangles);
+        Topology->UnitPositions.SetNumUninitialized(UnitVertices.Num());
+        for (int32 i = 0; i < UnitVertices.Num(); ++i)
+        {
+            Topology->UnitPositions.Set(i, FVector3f(UnitVertices[i]));
+        }
+        BuildVertexAdjacency(*Topology);
+        BuildDirectionIndex(*Topology);
+        CachedFrequencies[ClampedFrequency] = Topology;
+    }
+    return CachedFrequencies[ClampedFrequency].ToSharedRef();
+}
+
+void FAsteroidGenerator::BuildGeodesicSphere(int32 Frequency, TArray<FVector>& Vertices, TArray<int32>& Triangles)
+{
+    const int32 F = FMath::Max(Frequency, 1);
+
+    // create icosahedron
+    FVector Corners[12];
+    for (int32 i = 0; i < 12; ++i)
+    {
+        Corners[i] = FVector(IcosahedronCorners[i][0], IcosahedronCorners[i][1], IcosahedronCorners[i][2]);
+    }
+    const int32* faceIndices = IcosahedronFaces;
+
+    // Number the 30 icosahedron edges in face order. A 12x12 table replaces the midpoint hash.
+    int8 EdgeIndex[12][12];
+    FMemory::Memset(EdgeIndex, 0xFF, sizeof(EdgeIndex));
+    int32 EdgeEnds[30][2];
+    int32 EdgeCount = 0;
+    for (int32 Face = 0; Face < 20; ++Face)
+    {
+        for (int32 Side = 0; Side < 3; ++Side)
+        {
+            const int32 P = faceIndices[Face * 3 + Side];
+            const int32 Q = faceIndices[Face * 3 + (Side + 1) % 3];
+            if (EdgeIndex[P][Q] < 0)
+            {
+                EdgeEnds[EdgeCount][0] = FMath::Min(P, Q);
+                EdgeEnds[EdgeCount][1] = FMath::Max(P, Q);
+                EdgeIndex[P][Q] = EdgeIndex[Q][P] = (int8)EdgeCount;
+                ++EdgeCount;
+            }
+        }
+    }
+    check(EdgeCount == 30);
+
+    const int32 PerEdge = F - 1;
+    const int32 PerFace = (F - 1) * (F - 2) / 2;
+    const int32 EdgeBase = 12;
+    const int32 FaceBase = EdgeBase + 30 * PerEdge;
+
+    Vertices.Reset(GetVertexCount(F));
+    Triangles.Reset(GetTriangleCount(F) * 3);
+
+    // Corners
+    for (int32 i = 0; i < 12; ++i)
+    {
+        Vertices.Add(Corners[i].GetUnsafeNormal());
+    }
+
+    // Edge vertices, walking from the lower corner index to the higher one
+    for (int32 Edge = 0; Edge < 30; ++Edge)
+    {
+        const FVector& A = Corners[EdgeEnds[Edge][0]];
+        const FVector& B = Corners[EdgeEnds[Edge][1]];
+        for (int32 k = 1; k < F; ++k)
+        {
+            Vertices.Add(FMath::Lerp(A, B, (double)k / F).GetUnsafeNormal());
+        }
+    }
+
+    // Index of the k-th vertex (0..F) along corner P -> corner Q
+    auto EdgeVertex = [&](int32 P, int32 Q, int32 k) -> int32
+    {
+        if (k == 0) return P;
+        if (k == F) return Q;
+        const int32 Base = EdgeBase + EdgeIndex[P][Q] * PerEdge;
+        return P < Q ? Base + (k - 1) : Base + (F - 1 - k);
+    };
+
+    for (int32 Face = 0; Face < 20; ++Face)
+    {
+        const int32 IA = faceIndices[Face * 3 + 0];
+        const int32 IB = faceIndices[Face * 3 + 1];
+        const int32 IC = faceIndices[Face * 3 + 2];
+        const FVector& A = Corners[IA];
+        const FVector& B = Corners[IB];
+        const FVector& C = Corners[IC];
+        const int32 InteriorBase = FaceBase + Face * PerFace;
+
+        // Vertex at barycentric grid position (i toward B, j toward C)
+        auto GridVertex = [&](int32 i, int32 j) -> int32
+        {
+            if (j == 0) return EdgeVertex(IA, IB, i);
+            if (i == 0) return EdgeVertex(IA, IC, j);
+            if (i + j == F) return EdgeVertex(IB, IC, j);
+            // Interior rows j = 1..F-2 hold F-1-j vertices each
+            const int32 RowOffset = (j - 1) * (F - 1) - (j - 1) * j / 2;
+            return InteriorBase + RowOffset + (i - 1);
+        };
+
+        // Interior vertices, emitted in the same row order GridVertex assumes
+        for (int32 j = 1; j < F - 1; ++j)
+        {
+            for (int32 i = 1; i + j < F; ++i)
+            {
+                const FVector P = A + (B - A) * ((double)i / F) + (C - A) * ((double)j / F);
+                Vertices.Add(P.GetUnsafeNormal());
+            }
+        }
+
+        // Triangles keep the winding of the parent face
+        for (int32 j = 0; j < F; ++j)
+        {
+            for (int32 i = 0; i + j < F; ++i)
+            {
+                Triangles.Add(GridVertex(i, j));
+                Triangles.Add(GridVertex(i + 1, j));
+                Triangles.Add(GridVertex(i, j + 1));
+
+                if (i + j < F - 1)
+                {
+                    Triangles.Add(GridVertex(i + 1, j));
+                    Triangles.Add(GridVertex(i + 1, j + 1));
+                    Triangles.Add(GridVertex(i, j + 1));
+                }
+            }
+        }
+    }
+
+    check(Vertices.Num() == GetVertexCount(F));
+    check(Triangles.Num() == GetTriangleCount(F) * 3);
+}
+
+void FAsteroidGenerator::NormalizeVertices(FAsteroidVertexWorkspace& Positions)
+{
+    NormalizeRange(Positions.X.GetData(), Positions.Y.GetData(), Positions.Z.GetData(), Positions.Num());
+}
+
+void FAsteroidGenerator::NormalizeMeanRadius(FAsteroidVertexWorkspace& Positions)
+{
+    NormalizeMeanRadiusRange(Positions.X.GetData(), Positions.Y.GetData(), Positions.Z.GetData(), Positions.Num());
+}
+
+void FAsteroidGenerator::ScaleVertices(FAsteroidVertexWorkspace& Positions, float Scale)
+{
+    ScaleRange(Positions.X.GetData(), Positions.Y.GetData(), Positions.Z.GetData(), Positions.Num(), Scale);
+}
+
+// ------------------------- Noise / Deformation -------------------------
+namespace
+{
+    void ApplyNoiseRange(float* RESTRICT X, float* RESTRICT Y, float* RESTRICT Z, int32 VertexCount, const TArray<FNoiseLayer>& NoiseLayers, const TArray<int32>& LayerSeeds, float MaxDisplacementFrac, EAsteroidNoiseMode NoiseMode)
+    {
+        if (VertexCount == 0) return;
+
+        // Noise is evaluated in fixed-size chunks straight out of the SoA arrays
+        float ChunkNoise[NoiseChunkSize];
+
+        // For each layer, apply per-vertex displacement
+        for (int32 layerIndex = 0; layerIndex < NoiseLayers.Num(); ++layerIndex)
+        {
+            const FNoiseLayer& Layer = NoiseLayers[layerIndex];
+            // Seed and offsets to vary noise per-vertex
+            int32 seed;
+            float ox, oy, oz;
+            GetLayerNoiseSetup(LayerSeeds, layerIndex, seed, ox, oy, oz);
+
+            // Max absolute displacement in unit-sphere space
+            float maxDisplacement = MaxDisplacementFrac;
+
+            if (NoiseMode == EAsteroidNoiseMode::ScalarField)
+            {
+                // One seeded field sampled along the normal; the hash already decorrelates seeds,
+                // so the offset only needs to move away from the lattice origin (and stays small for float precision)
+                const FVector3f Offset(ox * 0.25f, oy * 0.25f, oz * 0.25f);
+                const float Amplitude = Layer.Intensity * 0.5f; // scale it down a bit
+
+                for (int32 Begin = 0; Begin < VertexCount; Begin += NoiseChunkSize)
+                {
+                    const int32 Count = FMath::Min(NoiseChunkSize, VertexCount - Begin);
+                    FAsteroidNoise::SampleBatch(X + Begin, Y + Begin, Z + Begin, Count, Layer.Scale, Offset, (uint32)seed, ChunkNoise);
+                    DisplaceRange(X + Begin, Y + Begin, Z + Begin, Count, ChunkNoise, Amplitude, maxDisplacement);
+                }
+                continue;
+            }
+
+            for (int32 i = 0; i < VertexCount; ++i)
+            {
+                FVector V(X[i], Y[i], Z[i]);
+
+                // sample Perlin noise in 3D by sampling FMath::PerlinNoise3D which expects FVector
+                FVector samplePoint = V * Layer.Scale + FVector(ox, oy, oz);
+                float nx = FMath::PerlinNoise3D(samplePoint + FVector(0.0f, 0.0f, 0.0f));
+                float ny = FMath::PerlinNoise3D(samplePoint + FVector(13.13f, 37.37f, 7.73f)); // arbitrary offsets for axis variation
+                float nz = FMath::PerlinNoise3D(samplePoint + FVector(97.97f, 21.21f, 55.55f));
+
+                FVector offset = FVector(nx, ny, nz) * Layer.Intensity * 0.5f; // scale it down a bit
+
+                // Apply displacement along normal direction to preserve sphere-like behavior
+                FVector normal = V;
+                normal.Normalize();
+
+                float displacement = FVector::DotProduct(offset, normal); // scalar displacement along normal
+                displacement = FMath::Clamp(displacement, -maxDisplacement, maxDisplacement);
+
+                V = V + normal * displacement;
+                X[i] = (float)V.X;
+                Y[i] = (float)V.Y;
+                Z[i] = (float)V.Z;
+            }
+        }
+    }
+}
+
+void FAsteroidGenerator::ApplyNoiseLayers(FAsteroidVertexWorkspace& Positions, const TArray<FNoiseLayer>& NoiseLayers, const TArray<int32>& LayerSeeds, float MaxDisplacementFrac, EAsteroidNoiseMode NoiseMode)
+{
+    ApplyNoiseRange(Positions.X.GetData(), Positions.Y.GetData(), Positions.Z.GetData(), Positions.Num(), NoiseLayers, LayerSeeds, MaxDisplacementFrac, NoiseMode);
+}
+
+// ------------------------- Normals -------------------------
+void FAsteroidGenerator::BuildVertexAdjacency(FAsteroidIcosphereTopology& Topology)
+{
+    const int32 VertexCount = Topology.UnitPositions.Num();
+    const TArray<int32>& Triangles = Topology.Triangles;
+
+    // Count corners per vertex, prefix-sum into row offsets, then fill rows
+    Topology.VertexCornerOffsets.SetNumZeroed(VertexCount + 1);
+    for (const int32 Vertex : Triangles)
+    {
+        ++Topology.VertexCornerOffsets[Vertex + 1];
+    }
+    for (int32 Vertex = 0; Vertex < VertexCount; ++Vertex)
+    {
+        Topology.VertexCornerOffsets[Vertex + 1] += Topology.VertexCornerOffsets[Vertex];
+    }
+
+    FAsteroidScratchMark ScratchMark;
+    TArrayView<int32> Cursor = FAsteroidScratch::Get().AllocArray<int32>(VertexCount);
+    FMemory::Memcpy(Cursor.GetData(), Topology.VertexCornerOffsets.GetData(), VertexCount * sizeof(int32));
+    Topology.VertexCorners.SetNumUninitialized(Triangles.Num());
+    for (int32 Corner = 0; Corner < Triangles.Num(); ++Corner)
+    {
+        Topology.VertexCorners[Cursor[Triangles[Corner]]++] = Corner;
+    }
+}
+
+void FAsteroidGenerator::BuildDirectionIndex(FAsteroidIcosphereTopology& Topology)
+{
+    const int32 VertexCount = Topology.UnitPositions.Num();
+
+    // About seven vertices per cell at any frequency
+    const int32 GridSize = FMath::Max(1, Topology.Frequency / 2);
+    const int32 CellCount = 6 * GridSize * GridSize;
+    Topology.DirectionGridSize = GridSize;
+
+    FAsteroidScratchMark ScratchMark;
+    FAsteroidScratch& Scratch = FAsteroidScratch::Get();
+    TArrayView<int32> VertexCells = Scratch.AllocArray<int32>(VertexCount);
+    Topology.DirectionCellOffsets.SetNumZeroed(CellCount + 1);
+    for (int32 Vertex = 0; Vertex < VertexCount; ++Vertex)
+    {
+        VertexCells[Vertex] = GetDirectionCell(Topology.UnitPositions.Get(Vertex), GridSize);
+        ++Topology.DirectionCellOffsets[VertexCells[Vertex] + 1];
+    }
+    for (int32 Cell = 0; Cell < CellCount; ++Cell)
+    {
+        Topology.DirectionCellOffsets[Cell + 1] += Topology.DirectionCellOffsets[Cell];
+    }
+
+    TArrayView<int32> Cursor = Scratch.AllocArray<int32>(CellCount);
+    FMemory::Memcpy(Cursor.GetData(), Topology.DirectionCellOffsets.GetData(), CellCount * sizeof(int32));
+    Topology.DirectionCellVertices.SetNumUninitialized(VertexCount);
+    for (int32 Vertex = 0; Vertex < VertexCount; ++Vertex)
+    {
+        Topology.DirectionCellVertices[Cursor[VertexCells[Vertex]]++] = Vertex;
+    }
+}
+
+int32 FAsteroidGenerator::FindNearestVertex(const FAsteroidIcosphereTopology& Topology, const FVector3f& Direction)
+{
+    const FAsteroidVertexWorkspace& Unit = Topology.UnitPositions;
+    if (Unit.Num() == 0 || Topology.DirectionGridSize <= 0)
+    {
+        return INDEX_NONE;
+    }
+
+    // Best vertex in the direction's own cell (vertex 0 if the cell is empty)
+    int32 Best = 0;
+    float BestDot = FVector3f::DotProduct(Unit.Get(0), Direction);
+    const int32 Cell = GetDirectionCell(Direction, Topology.DirectionGridSize);
+    for (int32 Slot = Topology.DirectionCellOffsets[Cell]; Slot < Topology.DirectionCellOffsets[Cell + 1]; ++Slot)
+    {
+        const int32 Vertex = Topology.DirectionCellVertices[Slot];
+        const float Dot = FVector3f::DotProduct(Unit.Get(Vertex), Direction);
+        if (Dot > BestDot)
+        {
+            BestDot = Dot;
+            Best = Vertex;
+        }
+    }
+
+    // The true nearest may sit just across a cell border; on a sphere the
+    // uphill walk over neighbours always reaches it
+    for (bool bMoved = true; bMoved; )
+    {
+        bMoved = false;
+        const int32 Current = Best;
+        for (int32 Row = Topology.VertexCornerOffsets[Current]; Row < Topology.VertexCornerOffsets[Current + 1]; ++Row)
+        {
+            const int32 Triangle = Topology.VertexCorners[Row] / 3;
+            for (int32 Corner = 0; Corner < 3; ++Corner)
+            {
+                const int32 Neighbour = Topology.Triangles[Triangle * 3 + Corner];
+                const float Dot = FVector3f::DotProduct(Unit.Get(Neighbour), Direction);
+                if (Dot > BestDot)
+                {
+                    BestDot = Dot;
+                    Best = Neighbour;
+                    bMoved = true;
+                }
+            }
+        }
+    }
+    return Best;
+}
+
+FVector FAsteroidGenerator::ComputeVertexNormal(TConstArrayView<FVector> Positions, const FAsteroidIcosphereTopology& Topology, EAsteroidNormalWeighting Weighting, int32 Vertex)
+{
+    FVector Sum = FVector::ZeroVector;
+    for (int32 Row = Topology.VertexCornerOffsets[Vertex]; Row < Topology.VertexCornerOffsets[Vertex + 1]; ++Row)
+    {
+        // Edges leave this corner in winding order, so the cross product
+        // matches the face normal of ComputeNormals
+        const int32 Corner = Topology.VertexCorners[Row];
+        const int32 Base = Corner - Corner % 3;
+        const FVector& P = Positions[Vertex];
+        const FVector E1 = Positions[Topology.Triangles[Base + (Corner + 1) % 3]] - P;
+        const FVector E2 = Positions[Topology.Triangles[Base + (Corner + 2) % 3]] - P;
+        const FVector Face = FVector::CrossProduct(E1, E2);
+
+        if (Weighting == EAsteroidNormalWeighting::Area)
+        {
+            Sum += Face;
+            continue;
+        }
+
+        const double Length = Face.Size();
+        if (Length <= SMALL_NUMBER)
+        {
+            continue;
+        }
+        const double Weight = Weighting == EAsteroidNormalWeighting::Angle ? FMath::Atan2(Length, FVector::DotProduct(E1, E2)) : 1.0;
+        Sum += Face * (Weight / Length);
+    }
+    return Sum.GetSafeNormal();
+}
+
+namespace
+{
+    void ComputeNormalsRange(const float* RESTRICT PX, const float* RESTRICT PY, const float* RESTRICT PZ, const FAsteroidIcosphereTopology& Topology, EAsteroidNormalWeighting Weighting, float* RESTRICT NX, float* RESTRICT NY, float* RESTRICT NZ)
+    {
+        const int32 VertexCount = Topology.UnitPositions.Num();
+        const TArray<int32>& Triangles = Topology.Triangles;
+        const int32 TriangleCount = Triangles.Num() / 3;
+        checkSlow(Topology.VertexCornerOffsets.Num() == VertexCount + 1);
+
+        const int32* RESTRICT Indices = Triangles.GetData();
+
+        // Pass 1: one weighted normal per corner. Each task owns a disjoint
+        // range of triangles and so of corners; nothing is shared. The corner
+        // buffer is scratch owned by this thread; the workers only write into it.
+        FAsteroidScratchMark ScratchMark;
+        FAsteroidScratch& Scratch = FAsteroidScratch::Get();
+        float* RESTRICT CX = Scratch.AllocArray<float>(Triangles.Num()).GetData();
+        float* RESTRICT CY = Scratch.AllocArray<float>(Triangles.Num()).GetData();
+        float* RESTRICT CZ = Scratch.AllocArray<float>(Triangles.Num()).GetData();
+
+        const int32 TriangleChunks = FMath::DivideAndRoundUp(TriangleCount, NormalTriangleChunk);
+        ParallelFor(TriangleChunks, [=](int32 Chunk)
+        {
+            const int32 First = Chunk * NormalTriangleChunk;
+            const int32 Last = FMath::Min(First + NormalTriangleChunk, TriangleCount);
+            for (int32 Triangle = First; Triangle < Last; ++Triangle)
+            {
+                const int32 C = Triangle * 3;
+                float CornerNormals[9];
+                ComputeCornerNormals(PX, PY, PZ, Indices[C], Indices[C + 1], Indices[C + 2], Weighting, CornerNormals);
+
+                CX[C] = CornerNormals[0];     CY[C] = CornerNormals[1];     CZ[C] = CornerNormals[2];
+                CX[C + 1] = CornerNormals[3]; CY[C + 1] = CornerNormals[4]; CZ[C + 1] = CornerNormals[5];
+                CX[C + 2] = CornerNormals[6]; CY[C + 2] = CornerNormals[7]; CZ[C + 2] = CornerNormals[8];
+            }
+        });
+
+        // Pass 2: each vertex gathers its own corners and normalizes in place.
+        // The adjacency order is fixed, so the sums are identical on every run
+        // regardless of how the work was split.
+        const int32* RESTRICT Offsets = Topology.VertexCornerOffsets.GetData();
+        const int32* RESTRICT VertexCorners = Topology.VertexCorners.GetData();
+
+        const int32 VertexChunks = FMath::DivideAndRoundUp(VertexCount, NormalVertexChunk);
+        ParallelFor(VertexChunks, [=](int32 Chunk)
+        {
+            const int32 First = Chunk * NormalVertexChunk;
+            const int32 Last = FMath::Min(First + NormalVertexChunk, VertexCount);
+            for (int32 Vertex = First; Vertex < Last; ++Vertex)
+            {
+                float SX = 0.0f, SY = 0.0f, SZ = 0.0f;
+                for (int32 Row = Offsets[Vertex]; Row < Offsets[Vertex + 1]; ++Row)
+                {
+                    const int32 Corner = VertexCorners[Row];
+                    SX += CX[Corner];
+                    SY += CY[Corner];
+                    SZ += CZ[Corner];
+                }
+
+                const FVector3f Normal = NormalizeSum(SX, SY, SZ);
+                NX[Vertex] = Normal.X;
+                NY[Vertex] = Normal.Y;
+                NZ[Vertex] = Normal.Z;
+            }
+        });
+    }
+
+    void WriteUploadRange(const float* RESTRICT X, const float* RESTRICT Y, const float* RESTRICT Z, const float* RESTRICT NX, const float* RESTRICT NY, const float* RESTRICT NZ, int32 Count, TArray<FVector>& OutVertices, TArray<FVector>& OutNormals)
+    {
+        OutVertices.SetNumUninitialized(Count);
+        OutNormals.SetNumUninitialized(Count);
+
+        for (int32 i = 0; i < Count; ++i)
+        {
+            OutVertices[i] = FVector(X[i], Y[i], Z[i]);
+            OutNormals[i] = FVector(NX[i], NY[i], NZ[i]);
+        }
+    }
+}
+
+void FAsteroidGenerator::ComputeNormals(const FAsteroidVertexWorkspace& Positions, const FAsteroidIcosphereTopology& Topology, EAsteroidNormalWeighting Weighting, FAsteroidVertexWorkspace& OutNormals)
+{
+    checkSlow(Positions.Num() == Topology.UnitPositions.Num());
+    OutNormals.SetNumUninitialized(Positions.Num());
+    ComputeNormalsRange(Positions.X.GetData(), Positions.Y.GetData(), Positions.Z.GetData(), Topology, Weighting, OutNormals.X.GetData(), OutNormals.Y.GetData(), OutNormals.Z.GetData());
+}
+
+void FAsteroidGenerator::WriteProcMeshBuffers(const FAsteroidVertexWorkspace& Positions, const FAsteroidVertexWorkspace& Normals, TArray<FVector>& OutVertices, TArray<FVector>& OutNormals)
+{
+    WriteUploadRange(Positions.X.GetData(), Positions.Y.GetData(), Positions.Z.GetData(), Normals.X.GetData(), Normals.Y.GetData(), Normals.Z.GetData(), Positions.Num(), OutVertices, OutNormals);
+}
+
+// ------------------------- Stats -------------------------
+void FAsteroidGenerator::CalculateStats(float ChosenRadius, float Density, FAsteroidStats& OutStats)
+{
+    // radius in meters (user-provided units assumed m; adjust if your unit scale differs)
+    OutStats.Radius = ChosenRadius;
+
+    OutStats.Volume = CalculateVolumeFromRadius(ChosenRadius);
+    OutStats.Mass = OutStats.Volume * (double)Density;
+
+    // Seeds are filled by caller after generation
+    OutStats.NoiseLayerSeeds.Empty();
+}
+
+double FAsteroidGenerator::CalculateVolumeFromRadius(double Radius)
+{
+    // Volume of a sphere
+    return (4.0 / 3.0) * PI * Radius * Radius * Radius;
+}
@@ -0,0 +1,361 @@
+/**
+ * AsteroidGravitySubsystem Implementation
+ *
+ * Key Systems:
+ * - Barnes-Hut octree construction and traversal
+ * - Body capture on the game thread, solve on a worker task
+ * - Batched force application (awake bodies) and velocity kicks (dormant)
+ */
+
+#include "AsteroidGravitySubsystem.h"
+#include "AsteroidActor.h"
+#include "AsteroidPhysicsSubsystem.h"
+#include "ShipPawn.h"
+#include "ProceduralMeshComponent.h"
+#include "Components/PrimitiveComponent.h"
+#include "Engine/World.h"
+#include "EngineUtils.h"               // TActorIterator
+#include "Async/ParallelFor.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogAsteroidGravity, Log, All);
+
+namespace AsteroidGravityPrivate
+{
+    /**
+     * FAsteroidStats::Mass is volume in cm^3 times density in kg/m^3, so it
+     * is 1e6 times the mass in kg. The solver works in kg, like ship bodies.
+     */
+    constexpr double AsteroidMassToKg = 1.0e-6;
+}
+
+// ------------------------- Octree -------------------------
+void FAsteroidGravityOctree::Build(TConstArrayView<FVector> Positions, TConstArrayView<double> Masses)
+{
+    check(Positions.Num() == Masses.Num());
+
+    Nodes.Reset();
+    if (Positions.Num() == 0)
+    {
+        return;
+    }
+
+    // Cubic root cell around all bodies, padded so nothing sits on its faces
+    const FBox Bounds(Positions.GetData(), Positions.Num());
+    FNode& Root = Nodes.AddDefaulted_GetRef();
+    Root.Center = Bounds.GetCenter();
+    Root.HalfSize = Bounds.GetExtent().GetMax() * 1.001 + 1.0;
+
+    Nodes.Reserve(Positions.Num() * 2);
+    for (int32 Body = 0; Body < Positions.Num(); ++Body)
+    {
+        if (Masses[Body] > 0.0)
+        {
+            Insert(Body, Positions[Body], Masses[Body]);
+        }
+    }
+
+    for (FNode& Node : Nodes)
+    {
+        if (Node.Mass > 0.0)
+        {
+            Node.MassCenter /= Node.Mass;
+        }
+    }
+}
+
+int32 FAsteroidGravityOctree::GetChildFor(int32 NodeIndex, const FVector& Position) const
+{
+    const FNode& Node = Nodes[NodeIndex];
+    const int32 Octant = (Position.X >= Node.Center.X ? 1 : 0)
+        | (Position.Y >= Node.Center.Y ? 2 : 0)
+        | (Position.Z >= Node.Center.Z ? 4 : 0);
+    return Node.FirstChild + Octant;
+}
+
+void FAsteroidGravityOctree::Subdivide(int32 NodeIndex)
+{
+    // Nodes may reallocate below, so copy what is needed first
+    const FVector Center = Nodes[NodeIndex].Center;
+    const double ChildHalf = Nodes[NodeIndex].HalfSize * 0.5;
+
+    const int32 FirstChild = Nodes.Num();
+    for (int32 Octant = 0; Octant < 8; ++Octant)
+    {
+        FNode& Child = Nodes.AddDefaulted_GetRef();
+        Child.HalfSize = ChildHalf;
+        Child.Center = Center + FVector(
+            (Octant & 1) ? ChildHalf : -ChildHalf,
+            (Octant & 2) ? ChildHalf : -ChildHalf,
+            (Octant & 4) ? ChildHalf : -ChildHalf);
+    }
+    Nodes[NodeIndex].FirstChild = FirstChild;
+}
+
+void FAsteroidGravityOctree::Insert(int32 Body, const FVector& Position, double Mass)
+{
+    int32 NodeIndex = 0;
+    for (int32 Depth = 0; ; ++Depth)
+    {
+        if (Nodes[NodeIndex].FirstChild == INDEX_NONE)
+        {
+            FNode& Leaf = Nodes[NodeIndex];
+            if (Leaf.Mass <= 0.0 || Depth >= MaxDepth)
+            {
+                // Empty leaf takes the body; a full leaf at max depth lumps it in
+                Leaf.Body = Leaf.Mass <= 0.0 ? Body : INDEX_NONE;
+                Leaf.Mass += Mass;
+                Leaf.MassCenter += Position * Mass;
+                return;
+            }
+
+            // Occupied leaf: split it and push its body one level down. A
+            // single-body leaf's weighted centre and mass are that body's.
+            const int32 Existing = Leaf.Body;
+            const double ExistingMass = Leaf.Mass;
+            const FVector ExistingWeighted = Leaf.MassCenter;
+
+            Subdivide(NodeIndex);
+
+            FNode& Child = Nodes[GetChildFor(NodeIndex, ExistingWeighted / ExistingMass)];
+            Child.Body = Existing;
+            Child.Mass = ExistingMass;
+            Child.MassCenter = ExistingWeighted;
+            Nodes[NodeIndex].Body = INDEX_NONE;
+        }
+
+        FNode& Node = Nodes[NodeIndex];
+        Node.Mass += Mass;
+        Node.MassCenter += Position * Mass;
+        NodeIndex = GetChildFor(NodeIndex, Position);
+    }
+}
+
+FVector FAsteroidGravityOctree::ComputeAcceleration(const FVector& Position, int32 Self, double Theta, double GravitationalConstant, double SofteningSquared) const
+{
+    FVector Acceleration = FVector::ZeroVector;
+    if (Nodes.Num() == 0)
+    {
+        return Acceleration;
+    }
+
+    const double ThetaSquared = Theta * Theta;
+
+    TArray<int32, TInlineAllocator<256>> Stack;
+    Stack.Add(0);
+    while (Stack.Num() > 0)
+    {
+        const FNode& Node = Nodes[Stack.Pop(false)];
+        if (Node.Mass <= 0.0 || (Node.FirstChild == INDEX_NONE && Node.Body == Self && Self != INDEX_NONE))
+        {
+            continue;
+        }
+
+        const FVector Offset = Node.MassCenter - Position;
+        const double DistanceSquared = Offset.SizeSquared();
+
+        // Width / distance < theta, compared squared: (2 * HalfSize)^2 < theta^2 * d^2
+        if (Node.FirstChild == INDEX_NONE || 4.0 * Node.HalfSize * Node.HalfSize < ThetaSquared * DistanceSquared)
+        {
+            const double SoftSquared = DistanceSquared + SofteningSquared;
+            Acceleration += Offset * (GravitationalConstant * Node.Mass / (SoftSquared * FMath::Sqrt(SoftSquared)));
+            continue;
+        }
+
+        for (int32 Octant = 0; Octant < 8; ++Octant)
+        {
+            Stack.Add(Node.FirstChild + Octant);
+        }
+    }
+    return Acceleration;
+}
+
+// ------------------------- Lifecycle -------------------------
+bool UAsteroidGravitySubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+    return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UAsteroidGravitySubsystem::Deinitialize()
+{
+    if (PendingStep.IsValid())
+    {
+        PendingTask.Wait();
+    }
+    PendingStep.Reset();
+    CurrentStep.Reset();
+
+    Super::Deinitialize();
+}
+
+TStatId UAsteroidGravitySubsystem::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(UAsteroidGravitySubsystem, STATGROUP_Tickables);
+}
+
+UAsteroidGravitySubsystem* UAsteroidGravitySubsystem::Get(const UObject* WorldContext)
+{
+    UWorld* World = WorldContext ? WorldContext->GetWorld() : nullptr;
+    return World ? World->GetSubsystem<UAsteroidGravitySubsystem>() : nullptr;
+}
+
+int32 UAsteroidGravitySubsystem::GetNumBodies() const
+{
+    return CurrentStep.IsValid() ? CurrentStep->Positions.Num() : 0;
+}
+
+float UAsteroidGravitySubsystem::GetLastSolveMs() const
+{
+    return CurrentStep.IsValid() ? (float)CurrentStep->SolveMs : 0.0f;
+}
+
+// ------------------------- Step -------------------------
+void UAsteroidGravitySubsystem::LaunchStep()
+{
+    UWorld* World = GetWorld();
+    if (!World)
+    {
+        return;
+    }
+
+    TSharedPtr<FStep, ESPMode::ThreadSafe> Step = MakeShared<FStep, ESPMode::ThreadSafe>();
+
+    // Dormant actors trail their drift; the physics subsystem knows where they are
+    const UAsteroidPhysicsSubsystem* Physics = UAsteroidPhysicsSubsystem::Get(this);
+    for (TActorIterator<AAsteroidActor> It(World); It; ++It)
+    {
+        AAsteroidActor* Asteroid = *It;
+        const double Mass = Asteroid->GetAsteroidStats().Mass * AsteroidGravityPrivate::AsteroidMassToKg;
+        if (Asteroid->IsPooled() || Mass <= 0.0f)
+        {
+            continue;
+        }
+
+        Step->Positions.Add(Physics ? Physics->GetAsteroidLocation(Asteroid) : Asteroid->GetActorLocation());
+        Step->Masses.Add(Mass);
+        Step->Components.Add(Asteroid->ProcMesh);
+        Step->Asteroids.Add(Asteroid);
+    }
+
+    if (bAffectShips)
+    {
+        for (TActorIterator<AShipPawn> It(World); It; ++It)
+        {
+            UPrimitiveComponent* Body = Cast<UPrimitiveComponent>(It->GetRootComponent());
+            if (!Body || !Body->IsSimulatingPhysics())
+            {
+                continue;
+            }
+
+            Step->Positions.Add(Body->GetComponentLocation());
+            Step->Masses.Add(Body->GetMass());
+            Step->Components.Add(Body);
+            Step->Asteroids.Add(nullptr);
+        }
+    }
+
+    // A lone body has nothing to attract
+    if (Step->Positions.Num() < 2)
+    {
+        CurrentStep.Reset();
+        return;
+    }
+
+    const double Theta = FMath::Max(OpeningAngle, 0.0f);
+    const double G = (double)GravitationalConstant * GravityScale;
+    const double SofteningSquared = FMath::Square((double)SofteningDistance);
+    const double MaxAccel = MaxAcceleration;
+
+    PendingStep = Step;
+    PendingTask = UE::Tasks::Launch(UE_SOURCE_LOCATION, [Step, Theta, G, SofteningSquared, MaxAccel]()
+    {
+        const double StartTime = FPlatformTime::Seconds();
+
+        FAsteroidGravityOctree Tree;
+        Tree.Build(Step->Positions, Step->Masses);
+
+        Step->Accelerations.SetNumUninitialized(Step->Positions.Num());
+        ParallelFor(Step->Positions.Num(), [&Tree, &Step, Theta, G, SofteningSquared, MaxAccel](int32 Index)
+        {
+            FVector Acceleration = Tree.ComputeAcceleration(Step->Positions[Index], Index, Theta, G, SofteningSquared);
+            if (MaxAccel > 0.0)
+            {
+                Acceleration = Acceleration.GetClampedToMaxSize(MaxAccel);
+            }
+            Step->Accelerations[Index] = Acceleration;
+        });
+
+        Step->NumNodes = Tree.GetNumNodes();
+        Step->SolveMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+    });
+}
+
+void UAsteroidGravitySubsystem::ApplyStep(const FStep& Step, float DeltaTime)
+{
+    UAsteroidPhysicsSubsystem* Physics = UAsteroidPhysicsSubsystem::Get(this);
+
+    for (int32 Index = 0; Index < Step.Components.Num(); ++Index)
+    {
+        UPrimitiveComponent* Body = Step.Components[Index].Get();
+        if (!Body)
+        {
+            continue;
+        }
+
+        const FVector& Acceleration = Step.Accelerations[Index];
+
+        // Dormant asteroids are not in the solver; bend their drift instead
+        const AAsteroidActor* Asteroid = Step.Asteroids[Index].Get();
+        if (Asteroid && Physics && Physics->AddDormantVelocity(Asteroid, Acceleration * DeltaTime))
+        {
+            continue;
+        }
+
+        if (Body->IsSimulatingPhysics())
+        {
+            Body->AddForce(Acceleration, NAME_None, true);
+        }
+    }
+}
+
+void UAsteroidGravitySubsystem::Tick(float DeltaTime)
+{
+    Super::Tick(DeltaTime);
+
+    if (PendingStep.IsValid() && PendingTask.IsCompleted())
+    {
+        CurrentStep = MoveTemp(PendingStep);
+    }
+
+    if (CurrentStep.IsValid())
+    {
+        ApplyStep(*CurrentStep, DeltaTime);
+    }
+
+    // Only one solve in flight; a slow solve just lowers the gravity update rate
+    if (!PendingStep.IsValid())
+    {
+        LaunchStep();
+    }
+}
+
+// ------------------------- Console -------------------------
+#if !UE_BUILD_SHIPPING
+namespace AsteroidGravityPrivate
+{
+    static void PrintGravityStats(UWorld* World)
+    {
+        if (const UAsteroidGravitySubsystem* Gravity = UAsteroidGravitySubsystem::Get(World))
+        {
+            UE_LOG(LogAsteroidGravity, Display, TEXT("Asteroid gravity: %s, %d bodies, last solve %.2fms"),
+                Gravity->bEnabled ? TEXT("enabled") : TEXT("disabled"), Gravity->GetNumBodies(), Gravity->GetLastSolveMs());
+        }
+    }
+
+    static FAutoConsoleCommandWithWorld GravityStatsCommand(
+        TEXT("Asteroid.GravityStats"),
+        TEXT("Print N-body gravity body count and solve time."),
+        FConsoleCommandWithWorldDelegate::CreateStatic(&PrintGravityStats));
+}
+#endif // !UE_BUILD_SHIPPING
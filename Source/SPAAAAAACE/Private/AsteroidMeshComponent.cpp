@@ -0,0 +1,107 @@
+/**
+ * AsteroidMeshComponent Implementation
+ *
+ * Key Systems:
+ * - Override body setup creation (sphere proxy and cached convex)
+ * - Physics state rebuild with velocity hand-over
+ */
+
+#include "AsteroidMeshComponent.h"
+#include "Chaos/Convex.h"
+#include "PhysicsEngine/BodySetup.h"
+
+UBodySetup* UAsteroidMeshComponent::GetBodySetup()
+{
+    return CollisionOverride ? CollisionOverride : Super::GetBodySetup();
+}
+
+void UAsteroidMeshComponent::SetSphereCollision(float Radius)
+{
+    if (!SphereBodySetup)
+    {
+        SphereBodySetup = CreateOverrideBodySetup();
+        SphereBodySetup->AggGeom.SphereElems.AddDefaulted();
+    }
+    SphereBodySetup->AggGeom.SphereElems[0].Radius = FMath::Max(Radius, 1.0f);
+
+    CookedShape.Reset();
+    ApplyCollisionOverride(SphereBodySetup);
+    ReleaseConvexElems();
+}
+
+void UAsteroidMeshComponent::SetCookedCollision(const FAsteroidCollisionShapePtr& Shape)
+{
+    check(Shape.IsValid());
+
+    // The hull is already cooked; the body setup only wraps it, so mark its
+    // meshes as created to stop the engine from cooking it again
+    if (!ConvexBodySetup)
+    {
+        ConvexBodySetup = CreateOverrideBodySetup();
+        ConvexBodySetup->bCreatedPhysicsMeshes = true;
+    }
+
+    // Elements are rewritten in place; the body being replaced holds its own
+    // references to the old convexes until the physics state is recreated
+    TArray<FKConvexElem>& ConvexElems = ConvexBodySetup->AggGeom.ConvexElems;
+    ConvexElems.Reset(Shape->Pieces.Num());
+    for (const FAsteroidCollisionPiece& Piece : Shape->Pieces)
+    {
+        FKConvexElem& Convex = ConvexElems.AddDefaulted_GetRef();
+        Convex.VertexData = Piece.HullVertices;
+        Convex.UpdateElemBox();
+        Convex.SetChaosConvexMesh(TSharedPtr<Chaos::FConvex, ESPMode::ThreadSafe>(Piece.Convex));
+    }
+
+    CookedShape = Shape;
+    ApplyCollisionOverride(ConvexBodySetup);
+}
+
+void UAsteroidMeshComponent::ClearCollisionOverride()
+{
+    CollisionOverride = nullptr;
+    CookedShape.Reset();
+    ReleaseConvexElems();
+}
+
+void UAsteroidMeshComponent::ReleaseConvexElems()
+{
+    // The convexes belong to the collision cache, which only holds weak
+    // references; an idle body setup must not keep them alive
+    if (ConvexBodySetup)
+    {
+        ConvexBodySetup->AggGeom.ConvexElems.Reset();
+    }
+}
+
+UBodySetup* UAsteroidMeshComponent::CreateOverrideBodySetup()
+{
+    UBodySetup* BodySetup = NewObject<UBodySetup>(this, NAME_None, RF_Transient);
+    BodySetup->BodySetupGuid = FGuid::NewGuid();
+    BodySetup->bGenerateMirroredCollision = false;
+    BodySetup->bNeverNeedsCookedCollisionData = true;
+    BodySetup->CollisionTraceFlag = bUseComplexAsSimpleCollision ? CTF_UseComplexAsSimple : CTF_UseDefault;
+    return BodySetup;
+}
+
+void UAsteroidMeshComponent::ApplyCollisionOverride(UBodySetup* BodySetup)
+{
+    CollisionOverride = BodySetup;
+    if (!IsPhysicsStateCreated())
+    {
+        return;
+    }
+
+    // Recreating the physics state resets the body; carry the motion over
+    const bool bSimulating = IsSimulatingPhysics();
+    const FVector LinearVelocity = bSimulating ? GetPhysicsLinearVelocity() : FVector::ZeroVector;
+    const FVector AngularVelocity = bSimulating ? GetPhysicsAngularVelocityInRadians() : FVector::ZeroVector;
+
+    RecreatePhysicsState();
+
+    if (bSimulating)
+    {
+        SetPhysicsLinearVelocity(LinearVelocity);
+        SetPhysicsAngularVelocityInRadians(AngularVelocity);
+    }
+}
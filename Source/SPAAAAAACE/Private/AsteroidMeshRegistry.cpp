@@ -0,0 +1,229 @@
+/**
+ * AsteroidMeshRegistry Implementation
+ *
+ * Key Systems:
+ * - Shape key construction and hashing
+ * - Weak-reference entry table guarded by a critical section
+ * - Disk cache lookup before generation
+ * - Hit/miss accounting and the Asteroid.MeshRegistryStats console command
+ */
+
+#include "AsteroidMeshRegistry.h"
+#include "AsteroidDiskCache.h"
+#include "Hash/xxhash.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/ScopeLock.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogAsteroidMeshRegistry, Log, All);
+
+namespace AsteroidMeshRegistryPrivate
+{
+    typedef TWeakPtr<const FAsteroidSharedMesh, ESPMode::ThreadSafe> FWeakSharedMesh;
+
+    struct FRegistryState
+    {
+        FCriticalSection Lock;
+        TMap<FAsteroidShapeKey, FWeakSharedMesh> Entries;
+        int64 Hits = 0;
+        int64 Misses = 0;
+        int64 DiskLoads = 0;
+
+        /** Entry count at which the next sweep of expired entries happens */
+        int32 SweepThreshold = 64;
+    };
+
+    static FRegistryState& GetState()
+    {
+        static FRegistryState State;
+        return State;
+    }
+
+    /** Drops entries whose last user has gone. Caller holds the lock. */
+    static void SweepExpired(FRegistryState& State)
+    {
+        for (auto It = State.Entries.CreateIterator(); It; ++It)
+        {
+            if (!It.Value().IsValid())
+            {
+                It.RemoveCurrent();
+            }
+        }
+        State.SweepThreshold = FMath::Max(64, State.Entries.Num() * 2);
+    }
+}
+
+// ------------------------- Shape key -------------------------
+FAsteroidShapeKey FAsteroidShapeKey::FromParams(const FAsteroidGenerationParams& Params)
+{
+    FAsteroidShapeKey Key;
+    Key.Frequency = Params.Frequency;
+    Key.NoiseMode = Params.NoiseMode;
+    Key.MaxDisplacementFraction = Params.MaxDisplacementFraction;
+    Key.NormalWeighting = Params.NormalWeighting;
+    Key.Layers = Params.NoiseLayers;
+
+    uint32 Hash = GetTypeHash(Key.Frequency);
+    Hash = HashCombineFast(Hash, GetTypeHash((uint8)Key.NoiseMode));
+    Hash = HashCombineFast(Hash, GetTypeHash(Key.MaxDisplacementFraction));
+    Hash = HashCombineFast(Hash, GetTypeHash((uint8)Key.NormalWeighting));
+    for (int32 Index = 0; Index < Key.Layers.Num(); ++Index)
+    {
+        FNoiseLayer& Layer = Key.Layers[Index];
+        Layer.Seed = Params.LayerSeeds.IsValidIndex(Index) ? Params.LayerSeeds[Index] : Layer.Seed;
+
+        Hash = HashCombineFast(Hash, GetTypeHash(Layer.Scale));
+        Hash = HashCombineFast(Hash, GetTypeHash(Layer.Intensity));
+        Hash = HashCombineFast(Hash, GetTypeHash(Layer.Seed));
+    }
+    Key.Hash = Hash;
+
+    return Key;
+}
+
+bool FAsteroidShapeKey::operator==(const FAsteroidShapeKey& Other) const
+{
+    if (Hash != Other.Hash || Frequency != Other.Frequency || NoiseMode != Other.NoiseMode
+        || MaxDisplacementFraction != Other.MaxDisplacementFraction || NormalWeighting != Other.NormalWeighting
+        || Layers.Num() != Other.Layers.Num())
+    {
+        return false;
+    }
+
+    for (int32 Index = 0; Index < Layers.Num(); ++Index)
+    {
+        const FNoiseLayer& A = Layers[Index];
+        const FNoiseLayer& B = Other.Layers[Index];
+        if (A.Scale != B.Scale || A.Intensity != B.Intensity || A.Seed != B.Seed)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+uint64 FAsteroidShapeKey::GetStableHash() const
+{
+    // Fixed-width words so the hash does not depend on struct padding
+    TArray<uint32, TInlineAllocator<32>> Words;
+    Words.Add((uint32)Frequency);
+    Words.Add((uint32)NoiseMode);
+    Words.Add(FMath::AsUInt(MaxDisplacementFraction));
+    Words.Add((uint32)NormalWeighting);
+    for (const FNoiseLayer& Layer : Layers)
+    {
+        Words.Add(FMath::AsUInt(Layer.Scale));
+        Words.Add(FMath::AsUInt(Layer.Intensity));
+        Words.Add((uint32)Layer.Seed);
+    }
+    return FXxHash64::HashBuffer(Words.GetData(), Words.Num() * sizeof(uint32)).Hash;
+}
+
+// ------------------------- Registry -------------------------
+FAsteroidSharedMeshPtr FAsteroidMeshRegistry::Find(const FAsteroidShapeKey& Key)
+{
+    using namespace AsteroidMeshRegistryPrivate;
+    FRegistryState& State = GetState();
+
+    FScopeLock ScopeLock(&State.Lock);
+    if (const FWeakSharedMesh* Entry = State.Entries.Find(Key))
+    {
+        FAsteroidSharedMeshPtr Mesh = Entry->Pin();
+        if (Mesh.IsValid())
+        {
+            ++State.Hits;
+            return Mesh;
+        }
+    }
+    return nullptr;
+}
+
+FAsteroidSharedMeshPtr FAsteroidMeshRegistry::FindOrGenerate(const FAsteroidGenerationParams& Params, const std::atomic<bool>* CancelFlag)
+{
+    using namespace AsteroidMeshRegistryPrivate;
+    FRegistryState& State = GetState();
+
+    FAsteroidShapeKey Key = FAsteroidShapeKey::FromParams(Params);
+    if (FAsteroidSharedMeshPtr Existing = Find(Key))
+    {
+        return Existing;
+    }
+
+    // Load or generate outside the lock; duplicates racing here are resolved on insert
+    TSharedPtr<FAsteroidSharedMesh, ESPMode::ThreadSafe> Mesh = MakeShared<FAsteroidSharedMesh, ESPMode::ThreadSafe>();
+    const bool bFromDisk = FAsteroidDiskCache::Load(Key, Mesh->MeshData);
+    if (bFromDisk)
+    {
+        FAsteroidGenerator::CalculateStats(ReferenceRadius, Params.Density, Mesh->MeshData.Stats);
+        Mesh->MeshData.Stats.NoiseLayerSeeds = Params.LayerSeeds;
+    }
+    else
+    {
+        FAsteroidGenerationParams ReferenceParams = Params;
+        ReferenceParams.Radius = ReferenceRadius;
+        if (!FAsteroidGenerator::Generate(ReferenceParams, Mesh->MeshData, CancelFlag))
+        {
+            return nullptr;
+        }
+    }
+    Mesh->Key = MoveTemp(Key);
+
+    FScopeLock ScopeLock(&State.Lock);
+    FWeakSharedMesh& Entry = State.Entries.FindOrAdd(Mesh->Key);
+    if (FAsteroidSharedMeshPtr Winner = Entry.Pin())
+    {
+        ++State.Hits;
+        return Winner;
+    }
+
+    ++State.Misses;
+    State.DiskLoads += bFromDisk ? 1 : 0;
+    Entry = Mesh;
+
+    if (State.Entries.Num() >= State.SweepThreshold)
+    {
+        SweepExpired(State);
+    }
+
+    return Mesh;
+}
+
+FAsteroidMeshRegistryStats FAsteroidMeshRegistry::GetStats()
+{
+    using namespace AsteroidMeshRegistryPrivate;
+    FRegistryState& State = GetState();
+
+    FAsteroidMeshRegistryStats Stats;
+
+    FScopeLock ScopeLock(&State.Lock);
+    Stats.Hits = State.Hits;
+    Stats.Misses = State.Misses;
+    Stats.DiskLoads = State.DiskLoads;
+    for (const TPair<FAsteroidShapeKey, FWeakSharedMesh>& Pair : State.Entries)
+    {
+        if (FAsteroidSharedMeshPtr Mesh = Pair.Value.Pin())
+        {
+            ++Stats.LiveEntries;
+            Stats.LiveBytes += Mesh->MeshData.Vertices.GetAllocatedSize() + Mesh->MeshData.Normals.GetAllocatedSize();
+        }
+    }
+    return Stats;
+}
+
+#if !UE_BUILD_SHIPPING
+namespace AsteroidMeshRegistryPrivate
+{
+    static void PrintRegistryStats()
+    {
+        const FAsteroidMeshRegistryStats Stats = FAsteroidMeshRegistry::GetStats();
+        const int64 Lookups = Stats.Hits + Stats.Misses;
+        UE_LOG(LogAsteroidMeshRegistry, Display, TEXT("Asteroid mesh registry: %d live shapes, %.2f MB, %lld hits / %lld misses (%.1f%% hit rate), %lld misses served from disk"),
+            Stats.LiveEntries, Stats.LiveBytes / (1024.0 * 1024.0), Stats.Hits, Stats.Misses,
+            Lookups > 0 ? 100.0 * Stats.Hits / Lookups : 0.0, Stats.DiskLoads);
+    }
+
+    static FAutoConsoleCommand MeshRegistryStatsCommand(
+        TEXT("Asteroid.MeshRegistryStats"),
+        TEXT("Print shared asteroid geometry registry counters."),
+        FConsoleCommandDelegate::CreateStatic(&PrintRegistryStats));
+}
+#endif // !UE_BUILD_SHIPPING
@@ -0,0 +1,469 @@
+/**
+ * AsteroidNoise Implementation
+ *
+ * This file contains the batched gradient noise kernel used for asteroid
+ * displacement, plus a console microbenchmark comparing it to the legacy
+ * three-sample FMath::PerlinNoise3D approach.
+ *
+ * Key Systems:
+ * - Integer lattice hashing and gradient selection
+ * - 8-wide AVX2, 4-wide VectorRegister4 and scalar evaluation paths
+ * - Asteroid.NoiseBenchmark console command (non-shipping builds)
+ *
+ * Reproducibility rules for anyone editing the kernels below:
+ * - Every path must perform the same operations in the same order
+ * - Never use multiply-add helpers; write the multiply and the add separately
+ * - Negate with (0 - x), never with a sign flip, so zeros keep the same sign
+ */
+
+#include "AsteroidNoise.h"
+#include "AsteroidGenerator.h"
+#include "Math/VectorRegister.h"
+#include "HAL/IConsoleManager.h"
+
+#if defined(PLATFORM_ALWAYS_HAS_AVX_2) && PLATFORM_ALWAYS_HAS_AVX_2
+#define ASTEROID_NOISE_AVX2 1
+#include <immintrin.h>
+#else
+#define ASTEROID_NOISE_AVX2 0
+#endif
+
+// Keep the scalar path from being contracted into FMA, which would change its results
+#if defined(__clang__)
+#pragma clang fp contract(off)
+#elif defined(_MSC_VER)
+#pragma fp_contract(off)
+#endif
+
+DEFINE_LOG_CATEGORY_STATIC(LogAsteroidNoise, Log, All);
+
+namespace AsteroidNoisePrivate
+{
+    // Hash constants (odd, well-mixed 32-bit multipliers)
+    constexpr uint32 PrimeX = 0x8da6b343u;
+    constexpr uint32 PrimeY = 0xd8163841u;
+    constexpr uint32 PrimeZ = 0xcb1ab31fu;
+    constexpr uint32 MixA = 0x2c1b3c6du;
+    constexpr uint32 MixB = 0x297a2d39u;
+
+    // ------------------------- Scalar -------------------------
+    FORCEINLINE uint32 HashCorner(int32 IX, int32 IY, int32 IZ, uint32 Seed)
+    {
+        uint32 H = Seed;
+        H ^= (uint32)IX * PrimeX;
+        H ^= (uint32)IY * PrimeY;
+        H ^= (uint32)IZ * PrimeZ;
+        H ^= H >> 15;
+        H *= MixA;
+        H ^= H >> 12;
+        H *= MixB;
+        H ^= H >> 15;
+        return H;
+    }
+
+    // Improved-Perlin gradient set: 12 cube edge directions selected by the low 4 hash bits
+    FORCEINLINE float Grad(uint32 H, float X, float Y, float Z)
+    {
+        const uint32 G = H & 15u;
+        const float U = G < 8u ? X : Y;
+        const float V = G < 4u ? Y : ((G == 12u || G == 14u) ? X : Z);
+        const float A = (G & 1u) ? (0.0f - U) : U;
+        const float B = (G & 2u) ? (0.0f - V) : V;
+        return A + B;
+    }
+
+    // 6t^5 - 15t^4 + 10t^3
+    FORCEINLINE float Fade(float T)
+    {
+        float T3 = T * T;
+        T3 = T3 * T;
+        float Inner = T * 6.0f;
+        Inner = Inner - 15.0f;
+        Inner = Inner * T;
+        Inner = Inner + 10.0f;
+        return T3 * Inner;
+    }
+
+    FORCEINLINE float Lerp(float A, float B, float T)
+    {
+        const float D = B - A;
+        const float S = T * D;
+        return A + S;
+    }
+
+    FORCEINLINE float SampleScalar(float X, float Y, float Z, uint32 Seed)
+    {
+        const float FX = FMath::FloorToFloat(X);
+        const float FY = FMath::FloorToFloat(Y);
+        const float FZ = FMath::FloorToFloat(Z);
+        const int32 IX = (int32)FX;
+        const int32 IY = (int32)FY;
+        const int32 IZ = (int32)FZ;
+
+        const float DX = X - FX;
+        const float DY = Y - FY;
+        const float DZ = Z - FZ;
+        const float DX1 = DX - 1.0f;
+        const float DY1 = DY - 1.0f;
+        const float DZ1 = DZ - 1.0f;
+
+        const float U = Fade(DX);
+        const float V = Fade(DY);
+        const float W = Fade(DZ);
+
+        const float N000 = Grad(HashCorner(IX,     IY,     IZ,     Seed), DX,  DY,  DZ);
+        const float N100 = Grad(HashCorner(IX + 1, IY,     IZ,     Seed), DX1, DY,  DZ);
+        const float N010 = Grad(HashCorner(IX,     IY + 1, IZ,     Seed), DX,  DY1, DZ);
+        const float N110 = Grad(HashCorner(IX + 1, IY + 1, IZ,     Seed), DX1, DY1, DZ);
+        const float N001 = Grad(HashCorner(IX,     IY,     IZ + 1, Seed), DX,  DY,  DZ1);
+        const float N101 = Grad(HashCorner(IX + 1, IY,     IZ + 1, Seed), DX1, DY,  DZ1);
+        const float N011 = Grad(HashCorner(IX,     IY + 1, IZ + 1, Seed), DX,  DY1, DZ1);
+        const float N111 = Grad(HashCorner(IX + 1, IY + 1, IZ + 1, Seed), DX1, DY1, DZ1);
+
+        const float X00 = Lerp(N000, N100, U);
+        const float X10 = Lerp(N010, N110, U);
+        const float X01 = Lerp(N001, N101, U);
+        const float X11 = Lerp(N011, N111, U);
+        const float Y0 = Lerp(X00, X10, V);
+        const float Y1 = Lerp(X01, X11, V);
+        return Lerp(Y0, Y1, W);
+    }
+
+    FORCEINLINE void SampleRangeScalar(const float* X, const float* Y, const float* Z, int32 Begin, int32 End, float Scale, const FVector3f& Offset, uint32 Seed, float* OutNoise)
+    {
+        for (int32 i = Begin; i < End; ++i)
+        {
+            float SX = X[i] * Scale;
+            float SY = Y[i] * Scale;
+            float SZ = Z[i] * Scale;
+            SX = SX + Offset.X;
+            SY = SY + Offset.Y;
+            SZ = SZ + Offset.Z;
+            OutNoise[i] = SampleScalar(SX, SY, SZ, Seed);
+        }
+    }
+
+    // ------------------------- 4-wide (SSE / NEON / FPU fallback) -------------------------
+    FORCEINLINE VectorRegister4Int SplatInt(uint32 Value)
+    {
+        return MakeVectorRegisterInt((int32)Value, (int32)Value, (int32)Value, (int32)Value);
+    }
+
+    FORCEINLINE VectorRegister4Int HashCorner4(const VectorRegister4Int& IX, const VectorRegister4Int& IY, const VectorRegister4Int& IZ, const VectorRegister4Int& Seed)
+    {
+        VectorRegister4Int H = Seed;
+        H = VectorIntXor(H, VectorIntMultiply(IX, SplatInt(PrimeX)));
+        H = VectorIntXor(H, VectorIntMultiply(IY, SplatInt(PrimeY)));
+        H = VectorIntXor(H, VectorIntMultiply(IZ, SplatInt(PrimeZ)));
+        H = VectorIntXor(H, VectorShiftRightImmLogical(H, 15));
+        H = VectorIntMultiply(H, SplatInt(MixA));
+        H = VectorIntXor(H, VectorShiftRightImmLogical(H, 12));
+        H = VectorIntMultiply(H, SplatInt(MixB));
+        H = VectorIntXor(H, VectorShiftRightImmLogical(H, 15));
+        return H;
+    }
+
+    FORCEINLINE VectorRegister4Float Grad4(const VectorRegister4Int& H, const VectorRegister4Float& X, const VectorRegister4Float& Y, const VectorRegister4Float& Z)
+    {
+        const VectorRegister4Int G = VectorIntAnd(H, SplatInt(15));
+        const VectorRegister4Float LessThan8 = VectorCastIntToFloat(VectorIntCompareLT(G, SplatInt(8)));
+        const VectorRegister4Float LessThan4 = VectorCastIntToFloat(VectorIntCompareLT(G, SplatInt(4)));
+        const VectorRegister4Float UseX = VectorCastIntToFloat(VectorIntOr(VectorIntCompareEQ(G, SplatInt(12)), VectorIntCompareEQ(G, SplatInt(14))));
+        const VectorRegister4Float Bit1 = VectorCastIntToFloat(VectorIntCompareEQ(VectorIntAnd(G, SplatInt(1)), SplatInt(1)));
+        const VectorRegister4Float Bit2 = VectorCastIntToFloat(VectorIntCompareEQ(VectorIntAnd(G, SplatInt(2)), SplatInt(2)));
+
+        const VectorRegister4Float Zero = VectorZeroFloat();
+        const VectorRegister4Float U = VectorSelect(LessThan8, X, Y);
+        const VectorRegister4Float V = VectorSelect(LessThan4, Y, VectorSelect(UseX, X, Z));
+        const VectorRegister4Float A = VectorSelect(Bit1, VectorSubtract(Zero, U), U);
+        const VectorRegister4Float B = VectorSelect(Bit2, VectorSubtract(Zero, V), V);
+        return VectorAdd(A, B);
+    }
+
+    FORCEINLINE VectorRegister4Float Fade4(const VectorRegister4Float& T)
+    {
+        VectorRegister4Float T3 = VectorMultiply(T, T);
+        T3 = VectorMultiply(T3, T);
+        VectorRegister4Float Inner = VectorMultiply(T, VectorSetFloat1(6.0f));
+        Inner = VectorSubtract(Inner, VectorSetFloat1(15.0f));
+        Inner = VectorMultiply(Inner, T);
+        Inner = VectorAdd(Inner, VectorSetFloat1(10.0f));
+        return VectorMultiply(T3, Inner);
+    }
+
+    FORCEINLINE VectorRegister4Float Lerp4(const VectorRegister4Float& A, const VectorRegister4Float& B, const VectorRegister4Float& T)
+    {
+        const VectorRegister4Float D = VectorSubtract(B, A);
+        const VectorRegister4Float S = VectorMultiply(T, D);
+        return VectorAdd(A, S);
+    }
+
+    FORCEINLINE void Sample4(const float* X, const float* Y, const float* Z, float Scale, const FVector3f& Offset, uint32 Seed, float* OutNoise)
+    {
+        const VectorRegister4Float VScale = VectorSetFloat1(Scale);
+        const VectorRegister4Float SX = VectorAdd(VectorMultiply(VectorLoad(X), VScale), VectorSetFloat1(Offset.X));
+        const VectorRegister4Float SY = VectorAdd(VectorMultiply(VectorLoad(Y), VScale), VectorSetFloat1(Offset.Y));
+        const VectorRegister4Float SZ = VectorAdd(VectorMultiply(VectorLoad(Z), VScale), VectorSetFloat1(Offset.Z));
+
+        const VectorRegister4Float FX = VectorFloor(SX);
+        const VectorRegister4Float FY = VectorFloor(SY);
+        const VectorRegister4Float FZ = VectorFloor(SZ);
+        const VectorRegister4Int IX = VectorFloatToInt(FX);
+        const VectorRegister4Int IY = VectorFloatToInt(FY);
+        const VectorRegister4Int IZ = VectorFloatToInt(FZ);
+        const VectorRegister4Int One = SplatInt(1);
+        const VectorRegister4Int IX1 = VectorIntAdd(IX, One);
+        const VectorRegister4Int IY1 = VectorIntAdd(IY, One);
+        const VectorRegister4Int IZ1 = VectorIntAdd(IZ, One);
+        const VectorRegister4Int VSeed = SplatInt(Seed);
+
+        const VectorRegister4Float VOne = VectorSetFloat1(1.0f);
+        const VectorRegister4Float DX = VectorSubtract(SX, FX);
+        const VectorRegister4Float DY = VectorSubtract(SY, FY);
+        const VectorRegister4Float DZ = VectorSubtract(SZ, FZ);
+        const VectorRegister4Float DX1 = VectorSubtract(DX, VOne);
+        const VectorRegister4Float DY1 = VectorSubtract(DY, VOne);
+        const VectorRegister4Float DZ1 = VectorSubtract(DZ, VOne);
+
+        const VectorRegister4Float U = Fade4(DX);
+        const VectorRegister4Float V = Fade4(DY);
+        const VectorRegister4Float W = Fade4(DZ);
+
+        const VectorRegister4Float N000 = Grad4(HashCorner4(IX,  IY,  IZ,  VSeed), DX,  DY,  DZ);
+        const VectorRegister4Float N100 = Grad4(HashCorner4(IX1, IY,  IZ,  VSeed), DX1, DY,  DZ);
+        const VectorRegister4Float N010 = Grad4(HashCorner4(IX,  IY1, IZ,  VSeed), DX,  DY1, DZ);
+        const VectorRegister4Float N110 = Grad4(HashCorner4(IX1, IY1, IZ,  VSeed), DX1, DY1, DZ);
+        const VectorRegister4Float N001 = Grad4(HashCorner4(IX,  IY,  IZ1, VSeed), DX,  DY,  DZ1);
+        const VectorRegister4Float N101 = Grad4(HashCorner4(IX1, IY,  IZ1, VSeed), DX1, DY,  DZ1);
+        const VectorRegister4Float N011 = Grad4(HashCorner4(IX,  IY1, IZ1, VSeed), DX,  DY1, DZ1);
+        const VectorRegister4Float N111 = Grad4(HashCorner4(IX1, IY1, IZ1, VSeed), DX1, DY1, DZ1);
+
+        const VectorRegister4Float X00 = Lerp4(N000, N100, U);
+        const VectorRegister4Float X10 = Lerp4(N010, N110, U);
+        const VectorRegister4Float X01 = Lerp4(N001, N101, U);
+        const VectorRegister4Float X11 = Lerp4(N011, N111, U);
+        const VectorRegister4Float Y0 = Lerp4(X00, X10, V);
+        const VectorRegister4Float Y1 = Lerp4(X01, X11, V);
+        VectorStore(Lerp4(Y0, Y1, W), OutNoise);
+    }
+
+#if ASTEROID_NOISE_AVX2
+    // ------------------------- 8-wide (AVX2) -------------------------
+    FORCEINLINE __m256i HashCorner8(__m256i IX, __m256i IY, __m256i IZ, __m256i Seed)
+    {
+        __m256i H = Seed;
+        H = _mm256_xor_si256(H, _mm256_mullo_epi32(IX, _mm256_set1_epi32((int32)PrimeX)));
+        H = _mm256_xor_si256(H, _mm256_mullo_epi32(IY, _mm256_set1_epi32((int32)PrimeY)));
+        H = _mm256_xor_si256(H, _mm256_mullo_epi32(IZ, _mm256_set1_epi32((int32)PrimeZ)));
+        H = _mm256_xor_si256(H, _mm256_srli_epi32(H, 15));
+        H = _mm256_mullo_epi32(H, _mm256_set1_epi32((int32)MixA));
+        H = _mm256_xor_si256(H, _mm256_srli_epi32(H, 12));
+        H = _mm256_mullo_epi32(H, _mm256_set1_epi32((int32)MixB));
+        H = _mm256_xor_si256(H, _mm256_srli_epi32(H, 15));
+        return H;
+    }
+
+    // Mask ? True : False
+    FORCEINLINE __m256 Select8(__m256i Mask, __m256 True, __m256 False)
+    {
+        return _mm256_blendv_ps(False, True, _mm256_castsi256_ps(Mask));
+    }
+
+    FORCEINLINE __m256 Grad8(__m256i H, __m256 X, __m256 Y, __m256 Z)
+    {
+        const __m256i G = _mm256_and_si256(H, _mm256_set1_epi32(15));
+        const __m256i LessThan8 = _mm256_cmpgt_epi32(_mm256_set1_epi32(8), G);
+        const __m256i LessThan4 = _mm256_cmpgt_epi32(_mm256_set1_epi32(4), G);
+        const __m256i UseX = _mm256_or_si256(_mm256_cmpeq_epi32(G, _mm256_set1_epi32(12)), _mm256_cmpeq_epi32(G, _mm256_set1_epi32(14)));
+        const __m256i Bit1 = _mm256_cmpeq_epi32(_mm256_and_si256(G, _mm256_set1_epi32(1)), _mm256_set1_epi32(1));
+        const __m256i Bit2 = _mm256_cmpeq_epi32(_mm256_and_si256(G, _mm256_set1_epi32(2)), _mm256_set1_epi32(2));
+
+        const __m256 Zero = _mm256_setzero_ps();
+        const __m256 U = Select8(LessThan8, X, Y);
+        const __m256 V = Select8(LessThan4, Y, Select8(UseX, X, Z));
+        const __m256 A = Select8(Bit1, _mm256_sub_ps(Zero, U), U);
+        const __m256 B = Select8(Bit2, _mm256_sub_ps(Zero, V), V);
+        return _mm256_add_ps(A, B);
+    }
+
+    FORCEINLINE __m256 Fade8(__m256 T)
+    {
+        __m256 T3 = _mm256_mul_ps(T, T);
+        T3 = _mm256_mul_ps(T3, T);
+        __m256 Inner = _mm256_mul_ps(T, _mm256_set1_ps(6.0f));
+        Inner = _mm256_sub_ps(Inner, _mm256_set1_ps(15.0f));
+        Inner = _mm256_mul_ps(Inner, T);
+        Inner = _mm256_add_ps(Inner, _mm256_set1_ps(10.0f));
+        return _mm256_mul_ps(T3, Inner);
+    }
+
+    FORCEINLINE __m256 Lerp8(__m256 A, __m256 B, __m256 T)
+    {
+        const __m256 D = _mm256_sub_ps(B, A);
+        const __m256 S = _mm256_mul_ps(T, D);
+        return _mm256_add_ps(A, S);
+    }
+
+    FORCEINLINE void Sample8(const float* X, const float* Y, const float* Z, float Scale, const FVector3f& Offset, uint32 Seed, float* OutNoise)
+    {
+        const __m256 VScale = _mm256_set1_ps(Scale);
+        const __m256 SX = _mm256_add_ps(_mm256_mul_ps(_mm256_loadu_ps(X), VScale), _mm256_set1_ps(Offset.X));
+        const __m256 SY = _mm256_add_ps(_mm256_mul_ps(_mm256_loadu_ps(Y), VScale), _mm256_set1_ps(Offset.Y));
+        const __m256 SZ = _mm256_add_ps(_mm256_mul_ps(_mm256_loadu_ps(Z), VScale), _mm256_set1_ps(Offset.Z));
+
+        const __m256 FX = _mm256_floor_ps(SX);
+        const __m256 FY = _mm256_floor_ps(SY);
+        const __m256 FZ = _mm256_floor_ps(SZ);
+        const __m256i IX = _mm256_cvttps_epi32(FX);
+        const __m256i IY = _mm256_cvttps_epi32(FY);
+        const __m256i IZ = _mm256_cvttps_epi32(FZ);
+        const __m256i One = _mm256_set1_epi32(1);
+        const __m256i IX1 = _mm256_add_epi32(IX, One);
+        const __m256i IY1 = _mm256_add_epi32(IY, One);
+        const __m256i IZ1 = _mm256_add_epi32(IZ, One);
+        const __m256i VSeed = _mm256_set1_epi32((int32)Seed);
+
+        const __m256 VOne = _mm256_set1_ps(1.0f);
+        const __m256 DX = _mm256_sub_ps(SX, FX);
+        const __m256 DY = _mm256_sub_ps(SY, FY);
+        const __m256 DZ = _mm256_sub_ps(SZ, FZ);
+        const __m256 DX1 = _mm256_sub_ps(DX, VOne);
+        const __m256 DY1 = _mm256_sub_ps(DY, VOne);
+        const __m256 DZ1 = _mm256_sub_ps(DZ, VOne);
+
+        const __m256 U = Fade8(DX);
+        const __m256 V = Fade8(DY);
+        const __m256 W = Fade8(DZ);
+
+        const __m256 N000 = Grad8(HashCorner8(IX,  IY,  IZ,  VSeed), DX,  DY,  DZ);
+        const __m256 N100 = Grad8(HashCorner8(IX1, IY,  IZ,  VSeed), DX1, DY,  DZ);
+        const __m256 N010 = Grad8(HashCorner8(IX,  IY1, IZ,  VSeed), DX,  DY1, DZ);
+        const __m256 N110 = Grad8(HashCorner8(IX1, IY1, IZ,  VSeed), DX1, DY1, DZ);
+        const __m256 N001 = Grad8(HashCorner8(IX,  IY,  IZ1, VSeed), DX,  DY,  DZ1);
+        const __m256 N101 = Grad8(HashCorner8(IX1, IY,  IZ1, VSeed), DX1, DY,  DZ1);
+        const __m256 N011 = Grad8(HashCorner8(IX,  IY1, IZ1, VSeed), DX,  DY1, DZ1);
+        const __m256 N111 = Grad8(HashCorner8(IX1, IY1, IZ1, VSeed), DX1, DY1, DZ1);
+
+        const __m256 X00 = Lerp8(N000, N100, U);
+        const __m256 X10 = Lerp8(N010, N110, U);
+        const __m256 X01 = Lerp8(N001, N101, U);
+        const __m256 X11 = Lerp8(N011, N111, U);
+        const __m256 Y0 = Lerp8(X00, X10, V);
+        const __m256 Y1 = Lerp8(X01, X11, V);
+        _mm256_storeu_ps(OutNoise, Lerp8(Y0, Y1, W));
+    }
+#endif // ASTEROID_NOISE_AVX2
+}
+
+float FAsteroidNoise::Sample(float X, float Y, float Z, uint32 Seed)
+{
+    return AsteroidNoisePrivate::SampleScalar(X, Y, Z, Seed);
+}
+
+void FAsteroidNoise::SampleBatch(const float* X, const float* Y, const float* Z, int32 Count, float Scale, const FVector3f& Offset, uint32 Seed, float* OutNoise)
+{
+    using namespace AsteroidNoisePrivate;
+
+    int32 Index = 0;
+
+#if ASTEROID_NOISE_AVX2
+    for (; Index + 8 <= Count; Index += 8)
+    {
+        Sample8(X + Index, Y + Index, Z + Index, Scale, Offset, Seed, OutNoise + Index);
+    }
+#endif
+
+    for (; Index + 4 <= Count; Index += 4)
+    {
+        Sample4(X + Index, Y + Index, Z + Index, Scale, Offset, Seed, OutNoise + Index);
+    }
+
+    SampleRangeScalar(X, Y, Z, Index, Count, Scale, Offset, Seed, OutNoise);
+}
+
+void FAsteroidNoise::SampleBatchScalar(const float* X, const float* Y, const float* Z, int32 Count, float Scale, const FVector3f& Offset, uint32 Seed, float* OutNoise)
+{
+    AsteroidNoisePrivate::SampleRangeScalar(X, Y, Z, 0, Count, Scale, Offset, Seed, OutNoise);
+}
+
+// ------------------------- Microbenchmark -------------------------
+#if !UE_BUILD_SHIPPING
+namespace AsteroidNoisePrivate
+{
+    /**
+     * Compares per-vertex noise cost of the legacy displacement (three
+     * FMath::PerlinNoise3D samples projected onto the normal) with the
+     * scalar-field kernel, and checks that SIMD and scalar paths agree bit for bit.
+     *
+     * Usage: Asteroid.NoiseBenchmark [Frequency=16] [Iterations=50]
+     */
+    void RunNoiseBenchmark(const TArray<FString>& Args)
+    {
+        const int32 Frequency = Args.Num() > 0 ? FMath::Max(1, FCString::Atoi(*Args[0])) : 16;
+        const int32 Iterations = Args.Num() > 1 ? FMath::Max(1, FCString::Atoi(*Args[1])) : 50;
+
+        FAsteroidIcosphereTopologyRef Topology = FAsteroidGenerator::GetIcosphereTopology(Frequency);
+        const FAsteroidVertexWorkspace& Unit = Topology->UnitPositions;
+        const int32 Count = Unit.Num();
+        const float* X = Unit.X.GetData();
+        const float* Y = Unit.Y.GetData();
+        const float* Z = Unit.Z.GetData();
+
+        TArray<float> SimdOut, ScalarOut;
+        SimdOut.SetNumUninitialized(Count);
+        ScalarOut.SetNumUninitialized(Count);
+
+        const float Scale = 0.1f;
+        const FVector3f Offset(123.4f, 56.7f, 89.1f);
+        const uint32 Seed = 12345u;
+        double Checksum = 0.0;
+
+        // Legacy: three Perlin samples per vertex, two of them discarded by the dot product
+        double Start = FPlatformTime::Seconds();
+        for (int32 Iter = 0; Iter < Iterations; ++Iter)
+        {
+            for (int32 i = 0; i < Count; ++i)
+            {
+                const FVector V(Unit.Get(i));
+                const FVector SamplePoint = V * Scale + FVector(Offset);
+                const float NX = FMath::PerlinNoise3D(SamplePoint);
+                const float NY = FMath::PerlinNoise3D(SamplePoint + FVector(13.13f, 37.37f, 7.73f));
+                const float NZ = FMath::PerlinNoise3D(SamplePoint + FVector(97.97f, 21.21f, 55.55f));
+                Checksum += FVector::DotProduct(FVector(NX, NY, NZ), V);
+            }
+        }
+        const double LegacySeconds = FPlatformTime::Seconds() - Start;
+
+        Start = FPlatformTime::Seconds();
+        for (int32 Iter = 0; Iter < Iterations; ++Iter)
+        {
+            FAsteroidNoise::SampleBatchScalar(X, Y, Z, Count, Scale, Offset, Seed, ScalarOut.GetData());
+            Checksum += ScalarOut[Iter % Count];
+        }
+        const double ScalarSeconds = FPlatformTime::Seconds() - Start;
+
+        Start = FPlatformTime::Seconds();
+        for (int32 Iter = 0; Iter < Iterations; ++Iter)
+        {
+            FAsteroidNoise::SampleBatch(X, Y, Z, Count, Scale, Offset, Seed, SimdOut.GetData());
+            Checksum += SimdOut[Iter % Count];
+        }
+        const double SimdSeconds = FPlatformTime::Seconds() - Start;
+
+        const bool bIdentical = FMemory::Memcmp(SimdOut.GetData(), ScalarOut.GetData(), Count * sizeof(float)) == 0;
+        const double Samples = (double)Count * Iterations;
+
+        UE_LOG(LogAsteroidNoise, Display, TEXT("Noise benchmark: %d vertices x %d iterations (AVX2 path %s)"),
+            Count, Iterations, ASTEROID_NOISE_AVX2 ? TEXT("enabled") : TEXT("disabled"));
+        UE_LOG(LogAsteroidNoise, Display, TEXT("  Legacy 3x PerlinNoise3D: %.2f ns/vertex"), LegacySeconds * 1e9 / Samples);
+        UE_LOG(LogAsteroidNoise, Display, TEXT("  Scalar field (scalar):   %.2f ns/vertex"), ScalarSeconds * 1e9 / Samples);
+        UE_LOG(LogAsteroidNoise, Display, TEXT("  Scalar field (SIMD):     %.2f ns/vertex"), SimdSeconds * 1e9 / Samples);
+        UE_LOG(LogAsteroidNoise, Display, TEXT("  SIMD matches scalar bit for bit: %s (checksum %g)"), bIdentical ? TEXT("yes") : TEXT("NO"), Checksum);
+    }
+
+    static FAutoConsoleCommand NoiseBenchmarkCommand(
+        TEXT("Asteroid.NoiseBenchmark"),
+        TEXT("Compare legacy and batched asteroid noise cost. Usage: Asteroid.NoiseBenchmark [Frequency] [Iterations]"),
+        FConsoleCommandWithArgsDelegate::CreateStatic(&RunNoiseBenchmark));
+}
+#endif // !UE_BUILD_SHIPPING
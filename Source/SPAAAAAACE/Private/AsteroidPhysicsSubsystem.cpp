@@ -0,0 +1,453 @@
+/**
+ * AsteroidPhysicsSubsystem Implementation
+ *
+ * Key Systems:
+ * - Ship sampling (location and velocity)
+ * - Predictive wake / hysteretic sleep pass
+ * - Momentum-preserving kinematic drift for dormant asteroids, integrated
+ *   on demand and applied to the actors in bounded batches
+ * - Distance-driven collision tiers
+ */
+
+#include "AsteroidPhysicsSubsystem.h"
+#include "AsteroidActor.h"
+#include "ShipPawn.h"
+#include "ProceduralMeshComponent.h"
+#include "Engine/World.h"
+#include "EngineUtils.h"               // TActorIterator
+#include "HAL/IConsoleManager.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogAsteroidPhysics, Log, All);
+
+// ------------------------- Lifecycle -------------------------
+bool UAsteroidPhysicsSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+    return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UAsteroidPhysicsSubsystem::Deinitialize()
+{
+    Bodies.Reset();
+    BodyIndices.Reset();
+    Ships.Reset();
+    NumAwake = 0;
+    DormantMoveCursor = 0;
+    FMemory::Memzero(CollisionLODCounts);
+
+    Super::Deinitialize();
+}
+
+TStatId UAsteroidPhysicsSubsystem::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(UAsteroidPhysicsSubsystem, STATGROUP_Tickables);
+}
+
+UAsteroidPhysicsSubsystem* UAsteroidPhysicsSubsystem::Get(const UObject* WorldContext)
+{
+    UWorld* World = WorldContext ? WorldContext->GetWorld() : nullptr;
+    return World ? World->GetSubsystem<UAsteroidPhysicsSubsystem>() : nullptr;
+}
+
+// ------------------------- Registration -------------------------
+void UAsteroidPhysicsSubsystem::RegisterAsteroid(AAsteroidActor* Asteroid)
+{
+    if (!bEnabled || !IsValid(Asteroid))
+    {
+        return;
+    }
+
+    int32 Index = INDEX_NONE;
+    if (const int32* Existing = BodyIndices.Find(Asteroid))
+    {
+        // Regenerated in place - carry the drift over to the new body
+        Index = *Existing;
+        if (!Bodies[Index].bAwake)
+        {
+            WakeBody(Bodies[Index]);
+        }
+    }
+    else
+    {
+        Index = Bodies.Num();
+        FAsteroidPhysicsBody& Body = Bodies.AddDefaulted_GetRef();
+        Body.Actor = Asteroid;
+        Body.Key = Asteroid;
+        BodyIndices.Add(Asteroid, Index);
+        ++NumAwake;
+    }
+
+    FAsteroidPhysicsBody& Body = Bodies[Index];
+    Body.Radius = Asteroid->GetAsteroidStats().Radius;
+
+    // Streamed asteroids mostly appear far from the ship; never let them
+    // reach the solver
+    if (GatherShips() && GetPredictedShipDistance(Body, Asteroid->GetActorLocation(), WakeLookAheadSeconds + UpdateInterval) > FMath::Max(SleepRadius, WakeRadius))
+    {
+        SleepBody(Body);
+    }
+}
+
+void UAsteroidPhysicsSubsystem::UnregisterAsteroid(AAsteroidActor* Asteroid)
+{
+    if (const int32* Index = BodyIndices.Find(Asteroid))
+    {
+        // Leave a dormant asteroid where its drift has taken it
+        FAsteroidPhysicsBody& Body = Bodies[*Index];
+        if (!Body.bAwake && Body.Actor.IsValid())
+        {
+            MoveDormantActor(Body, GetNow());
+        }
+        RemoveBodyAt(*Index);
+    }
+}
+
+void UAsteroidPhysicsSubsystem::RemoveBodyAt(int32 Index)
+{
+    if (Bodies[Index].bAwake)
+    {
+        --NumAwake;
+    }
+    BodyIndices.Remove(Bodies[Index].Key);
+
+    Bodies.RemoveAtSwap(Index, 1, false);
+    if (Bodies.IsValidIndex(Index))
+    {
+        BodyIndices.Add(Bodies[Index].Key, Index);
+    }
+}
+
+void UAsteroidPhysicsSubsystem::WakeAsteroid(AAsteroidActor* Asteroid)
+{
+    if (const int32* Index = BodyIndices.Find(Asteroid))
+    {
+        if (!Bodies[*Index].bAwake)
+        {
+            WakeBody(Bodies[*Index]);
+        }
+    }
+}
+
+bool UAsteroidPhysicsSubsystem::IsAsteroidDormant(const AAsteroidActor* Asteroid) const
+{
+    const int32* Index = BodyIndices.Find(Asteroid);
+    return Index && !Bodies[*Index].bAwake;
+}
+
+bool UAsteroidPhysicsSubsystem::GetAsteroidVelocity(const AAsteroidActor* Asteroid, FVector& OutLinear, FVector& OutAngular) const
+{
+    if (!IsValid(Asteroid))
+    {
+        return false;
+    }
+
+    const int32* Index = BodyIndices.Find(Asteroid);
+    if (Index && !Bodies[*Index].bAwake)
+    {
+        OutLinear = Bodies[*Index].LinearVelocity;
+        OutAngular = Bodies[*Index].AngularVelocity;
+    }
+    else
+    {
+        OutLinear = Asteroid->ProcMesh->GetPhysicsLinearVelocity();
+        OutAngular = Asteroid->ProcMesh->GetPhysicsAngularVelocityInRadians();
+    }
+    return true;
+}
+
+FVector UAsteroidPhysicsSubsystem::GetAsteroidLocation(const AAsteroidActor* Asteroid) const
+{
+    if (!IsValid(Asteroid))
+    {
+        return FVector::ZeroVector;
+    }
+
+    const int32* Index = BodyIndices.Find(Asteroid);
+    if (!Index || Bodies[*Index].bAwake)
+    {
+        return Asteroid->GetActorLocation();
+    }
+
+    FVector Location;
+    FQuat Rotation;
+    GetDormantTransform(Bodies[*Index], GetNow(), Location, Rotation);
+    return Location;
+}
+
+EAsteroidCollisionLOD UAsteroidPhysicsSubsystem::GetInitialCollisionLOD(const AAsteroidActor* Asteroid)
+{
+    if (!bEnabled || !bCollisionLOD || !IsValid(Asteroid) || !GatherShips())
+    {
+        return EAsteroidCollisionLOD::Full;
+    }
+
+    // Not registered yet; judge it as at rest, the way RegisterAsteroid does
+    FAsteroidPhysicsBody Body;
+    Body.Radius = Asteroid->GetAsteroidStats().Radius;
+    const float Predicted = GetPredictedShipDistance(Body, Asteroid->GetActorLocation(), WakeLookAheadSeconds + UpdateInterval);
+    return GetCollisionLODForDistance(Predicted, EAsteroidCollisionLOD::Sphere);
+}
+
+int32 UAsteroidPhysicsSubsystem::GetNumAtCollisionLOD(EAsteroidCollisionLOD LOD) const
+{
+    const int32 Index = static_cast<int32>(LOD);
+    return Index < UE_ARRAY_COUNT(CollisionLODCounts) ? CollisionLODCounts[Index] : 0;
+}
+
+bool UAsteroidPhysicsSubsystem::AddDormantVelocity(const AAsteroidActor* Asteroid, const FVector& DeltaVelocity)
+{
+    const int32* Index = BodyIndices.Find(Asteroid);
+    if (!Index || Bodies[*Index].bAwake)
+    {
+        return false;
+    }
+
+    // The drift so far was at the old velocity; only the rest uses the new one
+    FAsteroidPhysicsBody& Body = Bodies[*Index];
+    ReanchorBody(Body, GetNow());
+    Body.LinearVelocity += DeltaVelocity;
+    return true;
+}
+
+// ------------------------- Body state -------------------------
+void UAsteroidPhysicsSubsystem::SleepBody(FAsteroidPhysicsBody& Body)
+{
+    UProceduralMeshComponent* Mesh = Body.Actor->ProcMesh;
+
+    Body.LinearVelocity = Mesh->GetPhysicsLinearVelocity();
+    Body.AngularVelocity = Mesh->GetPhysicsAngularVelocityInRadians();
+
+    // Kinematic, not disabled: it still blocks traces and awake bodies
+    Mesh->SetSimulatePhysics(false);
+
+    Body.DormantLocation = Body.Actor->GetActorLocation();
+    Body.DormantRotation = Body.Actor->GetActorQuat();
+    Body.DormantTime = GetNow();
+    Body.bAwake = false;
+    --NumAwake;
+}
+
+void UAsteroidPhysicsSubsystem::WakeBody(FAsteroidPhysicsBody& Body)
+{
+    UProceduralMeshComponent* Mesh = Body.Actor->ProcMesh;
+
+    // Catch up on the drift the actor has not been moved through yet
+    MoveDormantActor(Body, GetNow());
+
+    Mesh->SetSimulatePhysics(true);
+    Mesh->SetPhysicsLinearVelocity(Body.LinearVelocity);
+    Mesh->SetPhysicsAngularVelocityInRadians(Body.AngularVelocity);
+
+    Body.bAwake = true;
+    ++NumAwake;
+}
+
+double UAsteroidPhysicsSubsystem::GetNow() const
+{
+    const UWorld* World = GetWorld();
+    return World ? World->GetTimeSeconds() : 0.0;
+}
+
+void UAsteroidPhysicsSubsystem::GetDormantTransform(const FAsteroidPhysicsBody& Body, double Now, FVector& OutLocation, FQuat& OutRotation) const
+{
+    const double Elapsed = FMath::Max(Now - Body.DormantTime, 0.0);
+    OutLocation = Body.DormantLocation + Body.LinearVelocity * Elapsed;
+
+    OutRotation = Body.DormantRotation;
+    const double AngularSpeed = Body.AngularVelocity.Size();
+    if (AngularSpeed > KINDA_SMALL_NUMBER)
+    {
+        OutRotation = FQuat(Body.AngularVelocity / AngularSpeed, AngularSpeed * Elapsed) * OutRotation;
+        OutRotation.Normalize();
+    }
+}
+
+void UAsteroidPhysicsSubsystem::ReanchorBody(FAsteroidPhysicsBody& Body, double Now)
+{
+    GetDormantTransform(Body, Now, Body.DormantLocation, Body.DormantRotation);
+    Body.DormantTime = Now;
+}
+
+void UAsteroidPhysicsSubsystem::MoveDormantActor(FAsteroidPhysicsBody& Body, double Now)
+{
+    ReanchorBody(Body, Now);
+    Body.Actor->SetActorLocationAndRotation(Body.DormantLocation, Body.DormantRotation, false, nullptr, ETeleportType::TeleportPhysics);
+}
+
+// ------------------------- Proximity update -------------------------
+bool UAsteroidPhysicsSubsystem::GatherShips()
+{
+    Ships.Reset();
+    if (UWorld* World = GetWorld())
+    {
+        for (TActorIterator<AShipPawn> It(World); It; ++It)
+        {
+            Ships.Add({ It->GetActorLocation(), It->GetVelocity() });
+        }
+    }
+    return Ships.Num() > 0;
+}
+
+float UAsteroidPhysicsSubsystem::GetPredictedShipDistance(const FAsteroidPhysicsBody& Body, const FVector& Location, float Horizon) const
+{
+    float Best = TNumericLimits<float>::Max();
+    for (const FShipSample& Ship : Ships)
+    {
+        const FVector Offset = Location - Ship.Location;
+        const float Distance = Offset.Size();
+
+        // Only the approaching component of the relative velocity matters
+        const FVector RelativeVelocity = Ship.Velocity - Body.LinearVelocity;
+        const float ClosingSpeed = Distance > KINDA_SMALL_NUMBER ? FVector::DotProduct(RelativeVelocity, Offset / Distance) : 0.0f;
+
+        const float Predicted = Distance - Body.Radius - FMath::Max(ClosingSpeed, 0.0f) * Horizon;
+        Best = FMath::Min(Best, Predicted);
+    }
+    return Best;
+}
+
+EAsteroidCollisionLOD UAsteroidPhysicsSubsystem::GetCollisionLODForDistance(float Distance, EAsteroidCollisionLOD Current) const
+{
+    const float EffectiveReducedRadius = FMath::Max(ReducedCollisionRadius, FullCollisionRadius);
+    const float Padding = 1.0f + FMath::Max(CollisionLODHysteresis, 0.0f);
+
+    const EAsteroidCollisionLOD Target = Distance < FullCollisionRadius ? EAsteroidCollisionLOD::Full
+        : Distance < EffectiveReducedRadius ? EAsteroidCollisionLOD::Reduced : EAsteroidCollisionLOD::Sphere;
+    if (Target >= Current)
+    {
+        return Target;
+    }
+
+    // Going down a tier needs the padded radius cleared as well
+    const EAsteroidCollisionLOD Padded = Distance < FullCollisionRadius * Padding ? EAsteroidCollisionLOD::Full
+        : Distance < EffectiveReducedRadius * Padding ? EAsteroidCollisionLOD::Reduced : EAsteroidCollisionLOD::Sphere;
+    return FMath::Min(Current, Padded);
+}
+
+void UAsteroidPhysicsSubsystem::UpdateProximity()
+{
+    // With no ship there is nothing to wake for, and nothing to compare against
+    if (!GatherShips())
+    {
+        return;
+    }
+
+    // Proximity is only re-checked every UpdateInterval, so look ahead over it too
+    const float Horizon = WakeLookAheadSeconds + UpdateInterval;
+    const float EffectiveSleepRadius = FMath::Max(SleepRadius, WakeRadius);
+    const double Now = GetNow();
+
+    int32 Woken = 0;
+    int32 Slept = 0;
+    int32 Downgraded = 0;
+    FMemory::Memzero(CollisionLODCounts);
+    for (int32 Index = Bodies.Num() - 1; Index >= 0; --Index)
+    {
+        FAsteroidPhysicsBody& Body = Bodies[Index];
+        AAsteroidActor* Actor = Body.Actor.Get();
+        if (!Actor)
+        {
+            RemoveBodyAt(Index);
+            continue;
+        }
+
+        FVector Location = Actor->GetActorLocation();
+        if (Body.bAwake)
+        {
+            // Awake bodies' velocity comes from the solver
+            Body.LinearVelocity = Actor->ProcMesh->GetPhysicsLinearVelocity();
+        }
+        else
+        {
+            // The actor may not have been moved yet; judge where it really is
+            FQuat Rotation;
+            GetDormantTransform(Body, Now, Location, Rotation);
+        }
+
+        const float Predicted = GetPredictedShipDistance(Body, Location, Horizon);
+        if (!Body.bAwake && Predicted < WakeRadius)
+        {
+            WakeBody(Body);
+            ++Woken;
+        }
+        else if (Body.bAwake && Predicted > EffectiveSleepRadius && Slept < MaxSleepsPerUpdate)
+        {
+            SleepBody(Body);
+            ++Slept;
+        }
+
+        // Collision swaps keep the body's velocity, awake or not
+        EAsteroidCollisionLOD LOD = Actor->GetCollisionLOD();
+        if (bCollisionLOD)
+        {
+            const EAsteroidCollisionLOD Desired = GetCollisionLODForDistance(Predicted, LOD);
+            if (Desired > LOD)
+            {
+                Actor->SetCollisionLOD(Desired);
+                LOD = Desired;
+            }
+            else if (Desired < LOD && Downgraded < MaxCollisionDowngradesPerUpdate)
+            {
+                Actor->SetCollisionLOD(Desired);
+                LOD = Desired;
+                ++Downgraded;
+            }
+        }
+        ++CollisionLODCounts[static_cast<int32>(LOD)];
+    }
+
+    UE_LOG(LogAsteroidPhysics, Verbose, TEXT("Asteroid physics: %d woken, %d slept, %d collision downgrades, %d awake / %d managed"),
+        Woken, Slept, Downgraded, NumAwake, Bodies.Num());
+}
+
+void UAsteroidPhysicsSubsystem::Tick(float DeltaTime)
+{
+    Super::Tick(DeltaTime);
+
+    // Dormant drift is exact whenever it is read; the actors only need to
+    // follow closely enough to look right, so a bounded slice is moved per frame
+    const double Now = GetNow();
+    const int32 NumVisits = FMath::Min(FMath::Max(MaxDormantMovesPerTick, 1), Bodies.Num());
+    for (int32 Visit = 0; Visit < NumVisits; ++Visit)
+    {
+        if (DormantMoveCursor >= Bodies.Num())
+        {
+            DormantMoveCursor = 0;
+        }
+
+        FAsteroidPhysicsBody& Body = Bodies[DormantMoveCursor++];
+        if (!Body.bAwake && Body.Actor.IsValid() && Now - Body.DormantTime >= UpdateInterval)
+        {
+            MoveDormantActor(Body, Now);
+        }
+    }
+
+    TimeUntilUpdate -= DeltaTime;
+    if (TimeUntilUpdate <= 0.0f)
+    {
+        TimeUntilUpdate = UpdateInterval;
+        UpdateProximity();
+    }
+}
+
+// ------------------------- Console -------------------------
+#if !UE_BUILD_SHIPPING
+namespace AsteroidPhysicsPrivate
+{
+    static void PrintPhysicsStats(UWorld* World)
+    {
+        if (const UAsteroidPhysicsSubsystem* Physics = UAsteroidPhysicsSubsystem::Get(World))
+        {
+            UE_LOG(LogAsteroidPhysics, Display, TEXT("Asteroid physics: %d awake, %d dormant; collision %d full, %d reduced, %d sphere"),
+                Physics->GetNumAwake(), Physics->GetNumDormant(),
+                Physics->GetNumAtCollisionLOD(EAsteroidCollisionLOD::Full),
+                Physics->GetNumAtCollisionLOD(EAsteroidCollisionLOD::Reduced),
+                Physics->GetNumAtCollisionLOD(EAsteroidCollisionLOD::Sphere));
+        }
+    }
+
+    static FAutoConsoleCommandWithWorld PhysicsStatsCommand(
+        TEXT("Asteroid.PhysicsStats"),
+        TEXT("Print how many managed asteroids are simulating, how many are dormant, and their collision tiers."),
+        FConsoleCommandWithWorldDelegate::CreateStatic(&PrintPhysicsStats));
+}
+#endif // !UE_BUILD_SHIPPING
@@ -0,0 +1,164 @@
+/**
+ * AsteroidPoolSubsystem Implementation
+ *
+ * Key Systems:
+ * - Per-class parked actor lists
+ * - Acquire (reuse or spawn) and release (park or destroy)
+ * - Level-start warm-up
+ */
+
+#include "AsteroidPoolSubsystem.h"
+#include "AsteroidActor.h"
+#include "Engine/World.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogAsteroidPool, Log, All);
+
+// ------------------------- Lifecycle -------------------------
+bool UAsteroidPoolSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+    return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UAsteroidPoolSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+    Super::OnWorldBeginPlay(InWorld);
+
+    if (WarmUpCount > 0)
+    {
+        UClass* Class = WarmUpClass.IsNull() ? nullptr : WarmUpClass.LoadSynchronous();
+        WarmUp(Class, WarmUpCount);
+    }
+}
+
+void UAsteroidPoolSubsystem::Deinitialize()
+{
+    Pool.Reset();
+    Stats = FAsteroidPoolStats();
+
+    Super::Deinitialize();
+}
+
+UAsteroidPoolSubsystem* UAsteroidPoolSubsystem::Get(const UObject* WorldContext)
+{
+    UWorld* World = WorldContext ? WorldContext->GetWorld() : nullptr;
+    return World ? World->GetSubsystem<UAsteroidPoolSubsystem>() : nullptr;
+}
+
+// ------------------------- Pooling -------------------------
+AAsteroidActor* UAsteroidPoolSubsystem::PopParked(UClass* Class)
+{
+    TArray<TWeakObjectPtr<AAsteroidActor>>* Parked = Pool.Find(Class);
+    while (Parked && Parked->Num() > 0)
+    {
+        AAsteroidActor* Actor = Parked->Pop(false).Get();
+        --Stats.Pooled;
+        if (Actor && Actor->IsPooled())
+        {
+            return Actor;
+        }
+    }
+    return nullptr;
+}
+
+AAsteroidActor* UAsteroidPoolSubsystem::SpawnParked(UClass* Class)
+{
+    UWorld* World = GetWorld();
+    AAsteroidActor* Actor = World ? World->SpawnActorDeferred<AAsteroidActor>(Class, FTransform::Identity, nullptr, nullptr, ESpawnActorCollisionHandlingMethod::AlwaysSpawn) : nullptr;
+    if (!Actor)
+    {
+        return nullptr;
+    }
+
+    // Parked before BeginPlay so it never generates
+    Actor->DeactivateForPool();
+    Actor->FinishSpawning(FTransform::Identity);
+    return Actor;
+}
+
+AAsteroidActor* UAsteroidPoolSubsystem::AcquireAsteroid(UClass* Class, const FTransform& Transform, TFunctionRef<void(AAsteroidActor&)> Configure, AActor* Owner)
+{
+    if (!Class)
+    {
+        Class = AAsteroidActor::StaticClass();
+    }
+
+    if (AAsteroidActor* Actor = PopParked(Class))
+    {
+        ++Stats.Hits;
+        ++Stats.Active;
+
+        // Whatever the previous user configured must not carry over
+        Actor->CopyGenerationSettings(*Class->GetDefaultObject<AAsteroidActor>());
+        Actor->SetOwner(Owner);
+        Configure(*Actor);
+        Actor->ReactivateFromPool(Transform);
+        return Actor;
+    }
+
+    UWorld* World = GetWorld();
+    AAsteroidActor* Actor = World ? World->SpawnActorDeferred<AAsteroidActor>(Class, Transform, Owner, nullptr, ESpawnActorCollisionHandlingMethod::AlwaysSpawn) : nullptr;
+    if (!Actor)
+    {
+        return nullptr;
+    }
+
+    ++Stats.Misses;
+    ++Stats.Active;
+    Configure(*Actor);
+    Actor->FinishSpawning(Transform);
+    return Actor;
+}
+
+AAsteroidActor* UAsteroidPoolSubsystem::AcquireAsteroidWithSeed(TSubclassOf<AAsteroidActor> Class, const FTransform& Transform, int32 Seed, float Radius)
+{
+    return AcquireAsteroid(Class.Get(), Transform, [Seed, Radius](AAsteroidActor& Asteroid)
+    {
+        Asteroid.GlobalSeed = Seed;
+        Asteroid.MinRadius = Radius;
+        Asteroid.MaxRadius = Radius;
+    });
+}
+
+void UAsteroidPoolSubsystem::ReleaseAsteroid(AAsteroidActor* Asteroid)
+{
+    if (!IsValid(Asteroid) || Asteroid->IsPooled())
+    {
+        return;
+    }
+
+    Stats.Active = FMath::Max(0, Stats.Active - 1);
+
+    if (Stats.Pooled >= MaxPoolSize)
+    {
+        ++Stats.Evictions;
+        Asteroid->Destroy();
+        return;
+    }
+
+    Asteroid->DeactivateForPool();
+    Pool.FindOrAdd(Asteroid->GetClass()).Add(Asteroid);
+    ++Stats.Pooled;
+}
+
+void UAsteroidPoolSubsystem::WarmUp(TSubclassOf<AAsteroidActor> Class, int32 Count)
+{
+    UClass* PoolClass = Class ? Class.Get() : AAsteroidActor::StaticClass();
+
+    const TArray<TWeakObjectPtr<AAsteroidActor>>* Parked = Pool.Find(PoolClass);
+    const int32 ToSpawn = FMath::Min(Count - (Parked ? Parked->Num() : 0), MaxPoolSize - Stats.Pooled);
+
+    int32 Spawned = 0;
+    for (; Spawned < ToSpawn; ++Spawned)
+    {
+        AAsteroidActor* Actor = SpawnParked(PoolClass);
+        if (!Actor)
+        {
+            break;
+        }
+        Pool.FindOrAdd(PoolClass).Add(Actor);
+        ++Stats.Pooled;
+    }
+
+    UE_LOG(LogAsteroidPool, Log, TEXT("Asteroid pool warm-up: %d %s actors parked (%d total)"),
+        Spawned, *PoolClass->GetName(), Stats.Pooled);
+}
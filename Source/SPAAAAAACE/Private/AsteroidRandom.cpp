@@ -0,0 +1,18 @@
+/**
+ * AsteroidRandom Implementation
+ *
+ * Key Systems:
+ * - Per-process counter behind MakeGlobalSeed
+ */
+
+#include "AsteroidRandom.h"
+#include "HAL/PlatformTime.h"
+#include <atomic>
+
+int32 FAsteroidRandom::MakeGlobalSeed()
+{
+    // Started from the clock so runs differ; the counter keeps calls distinct
+    static const int32 RunSeed = (int32)(uint32)FPlatformTime::Cycles64();
+    static std::atomic<uint32> Counter{0};
+    return Seed(FAsteroidRandomKey(RunSeed, 0, 0, EAsteroidRandomPurpose::GlobalSeed), Counter.fetch_add(1, std::memory_order_relaxed));
+}
@@ -0,0 +1,168 @@
+/**
+ * AsteroidScratch Implementation
+ *
+ * Key Systems:
+ * - Thread-local arena instances
+ * - Block chain with merge-on-release
+ * - Process-wide counters and the Asteroid.ScratchStats console command
+ */
+
+#include "AsteroidScratch.h"
+#include "HAL/IConsoleManager.h"
+#include <atomic>
+
+DEFINE_LOG_CATEGORY_STATIC(LogAsteroidScratch, Log, All);
+
+namespace AsteroidScratchPrivate
+{
+    /** Smallest block an arena allocates */
+    static constexpr SIZE_T MinBlockSize = 64 * 1024;
+
+    static std::atomic<int64> Allocations{0};
+    static std::atomic<int64> AllocatedBytes{0};
+    static std::atomic<int64> BlockAllocations{0};
+    static std::atomic<int64> ReservedBytes{0};
+}
+
+// ------------------------- Arena -------------------------
+FAsteroidScratch::~FAsteroidScratch()
+{
+    FreeBlocks();
+}
+
+FAsteroidScratch& FAsteroidScratch::Get()
+{
+    static thread_local FAsteroidScratch Scratch;
+    return Scratch;
+}
+
+void* FAsteroidScratch::Alloc(SIZE_T Size, SIZE_T Alignment)
+{
+    using namespace AsteroidScratchPrivate;
+    checkf(MarkDepth > 0, TEXT("Asteroid scratch allocated outside an FAsteroidScratchMark"));
+    checkSlow(FMath::IsPowerOfTwo(Alignment));
+
+    Allocations.fetch_add(1, std::memory_order_relaxed);
+    AllocatedBytes.fetch_add((int64)Size, std::memory_order_relaxed);
+
+    // Blocks left over from earlier, deeper use are reused before growing
+    while (BlockIndex < Blocks.Num())
+    {
+        const FBlock& Block = Blocks[BlockIndex];
+        uint8* Result = Align(Block.Data + BlockOffset, Alignment);
+        if (Result + Size <= Block.Data + Block.Size)
+        {
+            BlockOffset = (Result - Block.Data) + Size;
+            return Result;
+        }
+        ++BlockIndex;
+        BlockOffset = 0;
+    }
+
+    // Each new block is at least as large as everything held so far, so a
+    // growing workload settles after a few calls
+    SIZE_T Reserved = 0;
+    for (const FBlock& Existing : Blocks)
+    {
+        Reserved += Existing.Size;
+    }
+
+    FBlock& Block = Blocks.AddDefaulted_GetRef();
+    Block.Size = Align(FMath::Max3(Size + Alignment, Reserved, MinBlockSize), MinBlockSize);
+    Block.Data = (uint8*)FMemory::Malloc(Block.Size, 64);
+    BlockAllocations.fetch_add(1, std::memory_order_relaxed);
+    ReservedBytes.fetch_add((int64)Block.Size, std::memory_order_relaxed);
+
+    BlockIndex = Blocks.Num() - 1;
+    uint8* Result = Align(Block.Data, Alignment);
+    BlockOffset = (Result - Block.Data) + Size;
+    return Result;
+}
+
+void FAsteroidScratch::Release(int32 InBlockIndex, SIZE_T InBlockOffset)
+{
+    BlockIndex = InBlockIndex;
+    BlockOffset = InBlockOffset;
+    if (--MarkDepth > 0)
+    {
+        return;
+    }
+
+    SIZE_T Reserved = 0;
+    for (const FBlock& Block : Blocks)
+    {
+        Reserved += Block.Size;
+    }
+
+    // One block that fits the whole high-water mark, or nothing if that is
+    // more than a thread should sit on
+    if (Blocks.Num() > 1 || Reserved > MaxRetainedBytes)
+    {
+        FreeBlocks();
+        if (Reserved <= MaxRetainedBytes)
+        {
+            using namespace AsteroidScratchPrivate;
+            FBlock& Block = Blocks.AddDefaulted_GetRef();
+            Block.Size = Reserved;
+            Block.Data = (uint8*)FMemory::Malloc(Block.Size, 64);
+            BlockAllocations.fetch_add(1, std::memory_order_relaxed);
+            ReservedBytes.fetch_add((int64)Block.Size, std::memory_order_relaxed);
+        }
+    }
+}
+
+void FAsteroidScratch::FreeBlocks()
+{
+    using namespace AsteroidScratchPrivate;
+    for (const FBlock& Block : Blocks)
+    {
+        FMemory::Free(Block.Data);
+        ReservedBytes.fetch_sub((int64)Block.Size, std::memory_order_relaxed);
+    }
+    Blocks.Reset();
+    BlockIndex = 0;
+    BlockOffset = 0;
+}
+
+FAsteroidScratchStats FAsteroidScratch::GetStats()
+{
+    using namespace AsteroidScratchPrivate;
+    FAsteroidScratchStats Stats;
+    Stats.Allocations = Allocations.load(std::memory_order_relaxed);
+    Stats.AllocatedBytes = AllocatedBytes.load(std::memory_order_relaxed);
+    Stats.BlockAllocations = BlockAllocations.load(std::memory_order_relaxed);
+    Stats.ReservedBytes = ReservedBytes.load(std::memory_order_relaxed);
+    return Stats;
+}
+
+// ------------------------- Mark -------------------------
+FAsteroidScratchMark::FAsteroidScratchMark(FAsteroidScratch& InScratch)
+    : Scratch(InScratch)
+    , BlockIndex(InScratch.BlockIndex)
+    , BlockOffset(InScratch.BlockOffset)
+{
+    ++Scratch.MarkDepth;
+}
+
+FAsteroidScratchMark::~FAsteroidScratchMark()
+{
+    Scratch.Release(BlockIndex, BlockOffset);
+}
+
+// ------------------------- Console -------------------------
+#if !UE_BUILD_SHIPPING
+namespace AsteroidScratchPrivate
+{
+    static void PrintScratchStats()
+    {
+        const FAsteroidScratchStats Stats = FAsteroidScratch::GetStats();
+        UE_LOG(LogAsteroidScratch, Display, TEXT("Asteroid scratch: %lld allocations (%.2f MB) served by %lld heap blocks, %.2f MB reserved"),
+            Stats.Allocations, Stats.AllocatedBytes / (1024.0 * 1024.0), Stats.BlockAllocations, Stats.ReservedBytes / (1024.0 * 1024.0));
+    }
+
+    static FAutoConsoleCommand ScratchStatsCommand(
+        TEXT("Asteroid.ScratchStats"),
+        TEXT("Print scratch arena allocation counts and the heap blocks behind them."),
+        FConsoleCommandDelegate::CreateStatic(&PrintScratchStats));
+}
+#endif // !UE_BUILD_SHIPPING
@@ -0,0 +1,462 @@
+/**
+ * AsteroidSpatialSubsystem Implementation
+ *
+ * Key Systems:
+ * - Snapshot queries: radius, batched radius, k-nearest, ray candidates
+ * - Live hash maintenance (register, unregister, cell moves)
+ * - On-demand refresh and rate-limited snapshot publication
+ */
+
+#include "AsteroidSpatialSubsystem.h"
+#include "AsteroidActor.h"
+#include "AsteroidPhysicsSubsystem.h"
+#include "Engine/World.h"
+#include "Async/ParallelFor.h"
+#include "HAL/IConsoleManager.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogAsteroidSpatial, Log, All);
+
+// ------------------------- Snapshot queries -------------------------
+FIntVector FAsteroidSpatialSnapshot::GetCell(const FVector& Location) const
+{
+    return FIntVector(
+        FMath::FloorToInt(Location.X / CellSize),
+        FMath::FloorToInt(Location.Y / CellSize),
+        FMath::FloorToInt(Location.Z / CellSize));
+}
+
+template <typename FunctionType>
+void FAsteroidSpatialSnapshot::ForEachCellInBox(const FVector& Min, const FVector& Max, FunctionType&& Visit) const
+{
+    const FIntVector MinCell = GetCell(Min);
+    const FIntVector MaxCell = GetCell(Max);
+
+    const int64 NumCellsInBox = int64(MaxCell.X - MinCell.X + 1) * int64(MaxCell.Y - MinCell.Y + 1) * int64(MaxCell.Z - MinCell.Z + 1);
+
+    // A box larger than the occupied set is cheaper to answer by scanning the occupied cells
+    if (NumCellsInBox > Cells.Num())
+    {
+        for (const TPair<FIntVector, FCellRange>& Pair : Cells)
+        {
+            const FIntVector& Cell = Pair.Key;
+            if (Cell.X >= MinCell.X && Cell.X <= MaxCell.X
+                && Cell.Y >= MinCell.Y && Cell.Y <= MaxCell.Y
+                && Cell.Z >= MinCell.Z && Cell.Z <= MaxCell.Z)
+            {
+                Visit(Pair.Value);
+            }
+        }
+        return;
+    }
+
+    for (int32 Z = MinCell.Z; Z <= MaxCell.Z; ++Z)
+    {
+        for (int32 Y = MinCell.Y; Y <= MaxCell.Y; ++Y)
+        {
+            for (int32 X = MinCell.X; X <= MaxCell.X; ++X)
+            {
+                if (const FCellRange* Range = Cells.Find(FIntVector(X, Y, Z)))
+                {
+                    Visit(*Range);
+                }
+            }
+        }
+    }
+}
+
+void FAsteroidSpatialSnapshot::QueryRadius(const FVector& Center, float Radius, TArray<FAsteroidSpatialHit>& OutHits) const
+{
+    OutHits.Reset();
+
+    // Loose grid: an asteroid in a neighbouring cell may still reach in by its radius
+    const FVector Pad(Radius + MaxEntryRadius);
+    ForEachCellInBox(Center - Pad, Center + Pad, [&](const FCellRange& Range)
+    {
+        for (int32 Entry = Range.Start; Entry < Range.Start + Range.Num; ++Entry)
+        {
+            const float DistanceSquared = FVector::DistSquared(Positions[Entry], Center);
+            if (DistanceSquared <= FMath::Square(Radius + Radii[Entry]))
+            {
+                OutHits.Add({ Entry, FMath::Sqrt(DistanceSquared) });
+            }
+        }
+    });
+}
+
+void FAsteroidSpatialSnapshot::QueryRadiusBatch(TConstArrayView<FVector> Centers, float Radius, TArray<TArray<FAsteroidSpatialHit>>& OutHits) const
+{
+    OutHits.SetNum(Centers.Num());
+    ParallelFor(Centers.Num(), [this, &Centers, Radius, &OutHits](int32 Index)
+    {
+        QueryRadius(Centers[Index], Radius, OutHits[Index]);
+    });
+}
+
+void FAsteroidSpatialSnapshot::QueryNearest(const FVector& Point, int32 Count, TArray<FAsteroidSpatialHit>& OutHits) const
+{
+    OutHits.Reset();
+    if (Count <= 0 || Positions.Num() == 0)
+    {
+        return;
+    }
+
+    // Farthest any entry can be; once the search sphere covers it, everything has been seen
+    const FVector FarCorner(
+        FMath::Max(FMath::Abs(Point.X - Bounds.Min.X), FMath::Abs(Point.X - Bounds.Max.X)),
+        FMath::Max(FMath::Abs(Point.Y - Bounds.Min.Y), FMath::Abs(Point.Y - Bounds.Max.Y)),
+        FMath::Max(FMath::Abs(Point.Z - Bounds.Min.Z), FMath::Abs(Point.Z - Bounds.Max.Z)));
+    const float MaxReach = FarCorner.Size();
+
+    // Grow the search sphere until it holds Count centres; the Count nearest
+    // of the centres inside a sphere are the Count nearest overall
+    float SearchRadius = CellSize;
+    for (;;)
+    {
+        OutHits.Reset();
+        const FVector Extent(SearchRadius);
+        ForEachCellInBox(Point - Extent, Point + Extent, [&](const FCellRange& Range)
+        {
+            for (int32 Entry = Range.Start; Entry < Range.Start + Range.Num; ++Entry)
+            {
+                const float DistanceSquared = FVector::DistSquared(Positions[Entry], Point);
+                if (DistanceSquared <= SearchRadius * SearchRadius)
+                {
+                    OutHits.Add({ Entry, FMath::Sqrt(DistanceSquared) });
+                }
+            }
+        });
+
+        if (OutHits.Num() >= Count || SearchRadius >= MaxReach)
+        {
+            break;
+        }
+        SearchRadius *= 2.0f;
+    }
+
+    OutHits.Sort([](const FAsteroidSpatialHit& A, const FAsteroidSpatialHit& B) { return A.Distance < B.Distance; });
+    if (OutHits.Num() > Count)
+    {
+        OutHits.SetNum(Count, false);
+    }
+}
+
+void FAsteroidSpatialSnapshot::QueryRay(const FVector& Start, const FVector& End, float Thickness, TArray<FAsteroidSpatialHit>& OutHits) const
+{
+    OutHits.Reset();
+    if (Positions.Num() == 0)
+    {
+        return;
+    }
+
+    const FVector Segment = End - Start;
+    const float Length = Segment.Size();
+    const FVector Direction = Length > KINDA_SMALL_NUMBER ? Segment / Length : FVector::ZeroVector;
+
+    // Sample the segment once per cell; any point on it is then at most one
+    // cell from a sample, plus however far asteroids and the sweep reach
+    const int32 Reach = FMath::CeilToInt((MaxEntryRadius + Thickness) / CellSize) + 1;
+    const int32 NumSamples = FMath::FloorToInt(Length / CellSize) + 1;
+
+    TSet<FIntVector> Visited;
+    for (int32 Sample = 0; Sample <= NumSamples; ++Sample)
+    {
+        const FIntVector Base = GetCell(Start + Direction * FMath::Min(Sample * CellSize, Length));
+        for (int32 Z = -Reach; Z <= Reach; ++Z)
+        {
+            for (int32 Y = -Reach; Y <= Reach; ++Y)
+            {
+                for (int32 X = -Reach; X <= Reach; ++X)
+                {
+                    const FIntVector Cell = Base + FIntVector(X, Y, Z);
+                    bool bAlreadyVisited = false;
+                    Visited.Add(Cell, &bAlreadyVisited);
+                    const FCellRange* Range = bAlreadyVisited ? nullptr : Cells.Find(Cell);
+                    if (!Range)
+                    {
+                        continue;
+                    }
+
+                    for (int32 Entry = Range->Start; Entry < Range->Start + Range->Num; ++Entry)
+                    {
+                        const float T = FMath::Clamp(FVector::DotProduct(Positions[Entry] - Start, Direction), 0.0f, Length);
+                        const float DistanceSquared = FVector::DistSquared(Start + Direction * T, Positions[Entry]);
+                        if (DistanceSquared <= FMath::Square(Radii[Entry] + Thickness))
+                        {
+                            OutHits.Add({ Entry, T });
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    OutHits.Sort([](const FAsteroidSpatialHit& A, const FAsteroidSpatialHit& B) { return A.Distance < B.Distance; });
+}
+
+// ------------------------- Lifecycle -------------------------
+bool UAsteroidSpatialSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+    return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UAsteroidSpatialSubsystem::Deinitialize()
+{
+    Entries.Reset();
+    EntryIndices.Reset();
+    Cells.Reset();
+    Snapshot.Reset();
+    RefreshTime = 0.0;
+    bDirty = false;
+
+    Super::Deinitialize();
+}
+
+UAsteroidSpatialSubsystem* UAsteroidSpatialSubsystem::Get(const UObject* WorldContext)
+{
+    UWorld* World = WorldContext ? WorldContext->GetWorld() : nullptr;
+    return World ? World->GetSubsystem<UAsteroidSpatialSubsystem>() : nullptr;
+}
+
+// ------------------------- Live hash -------------------------
+FIntVector UAsteroidSpatialSubsystem::GetCell(const FVector& Location) const
+{
+    return FIntVector(
+        FMath::FloorToInt(Location.X / CellSize),
+        FMath::FloorToInt(Location.Y / CellSize),
+        FMath::FloorToInt(Location.Z / CellSize));
+}
+
+void UAsteroidSpatialSubsystem::RegisterAsteroid(AAsteroidActor* Asteroid)
+{
+    if (!IsValid(Asteroid))
+    {
+        return;
+    }
+
+    // Where a dormant asteroid has drifted to, not its lagging actor
+    const UAsteroidPhysicsSubsystem* Physics = UAsteroidPhysicsSubsystem::Get(this);
+    const FVector Location = Physics ? Physics->GetAsteroidLocation(Asteroid) : Asteroid->GetActorLocation();
+    const float Radius = Asteroid->GetAsteroidStats().Radius;
+
+    if (const int32* Existing = EntryIndices.Find(Asteroid))
+    {
+        Entries[*Existing].Radius = Radius;
+        bDirty = true;
+        return;
+    }
+
+    const int32 Index = Entries.Num();
+    FEntry& Entry = Entries.AddDefaulted_GetRef();
+    Entry.Actor = Asteroid;
+    Entry.Key = Asteroid;
+    Entry.Position = Location;
+    Entry.Radius = Radius;
+    Entry.Cell = GetCell(Location);
+
+    EntryIndices.Add(Entry.Key, Index);
+    Cells.FindOrAdd(Entry.Cell).Add(Index);
+    bDirty = true;
+}
+
+void UAsteroidSpatialSubsystem::UnregisterAsteroid(AAsteroidActor* Asteroid)
+{
+    if (const int32* Index = EntryIndices.Find(Asteroid))
+    {
+        RemoveEntryAt(*Index);
+    }
+}
+
+void UAsteroidSpatialSubsystem::RemoveEntryAt(int32 Index)
+{
+    const FEntry& Removed = Entries[Index];
+    TArray<int32>& RemovedCell = Cells.FindChecked(Removed.Cell);
+    RemovedCell.RemoveSingleSwap(Index, false);
+    if (RemovedCell.Num() == 0)
+    {
+        Cells.Remove(Removed.Cell);
+    }
+    EntryIndices.Remove(Removed.Key);
+
+    // The last entry moves into the freed slot
+    const int32 Last = Entries.Num() - 1;
+    if (Index != Last)
+    {
+        const FEntry& Moved = Entries[Last];
+        TArray<int32>& MovedCell = Cells.FindChecked(Moved.Cell);
+        MovedCell[MovedCell.IndexOfByKey(Last)] = Index;
+        EntryIndices[Moved.Key] = Index;
+    }
+
+    Entries.RemoveAtSwap(Index, 1, false);
+    bDirty = true;
+}
+
+bool UAsteroidSpatialSubsystem::RefreshEntries()
+{
+    // Dormant actors are only moved now and then; index where the drift is
+    const UAsteroidPhysicsSubsystem* Physics = UAsteroidPhysicsSubsystem::Get(this);
+
+    bool bMoved = false;
+    for (int32 Index = Entries.Num() - 1; Index >= 0; --Index)
+    {
+        const AAsteroidActor* Actor = Entries[Index].Actor.Get();
+        if (!Actor)
+        {
+            RemoveEntryAt(Index);
+            continue;
+        }
+
+        FEntry& Entry = Entries[Index];
+        const FVector Location = Physics ? Physics->GetAsteroidLocation(Actor) : Actor->GetActorLocation();
+        if (Location.Equals(Entry.Position))
+        {
+            continue;
+        }
+        Entry.Position = Location;
+        bMoved = true;
+
+        // Only a change of cell touches the buckets
+        const FIntVector Cell = GetCell(Location);
+        if (Cell != Entry.Cell)
+        {
+            TArray<int32>& OldCell = Cells.FindChecked(Entry.Cell);
+            OldCell.RemoveSingleSwap(Index, false);
+            if (OldCell.Num() == 0)
+            {
+                Cells.Remove(Entry.Cell);
+            }
+            Cells.FindOrAdd(Cell).Add(Index);
+            Entry.Cell = Cell;
+        }
+    }
+    return bMoved;
+}
+
+void UAsteroidSpatialSubsystem::PublishSnapshot()
+{
+    // Rebuild in place when no query still holds the old snapshot; its
+    // buffers keep their capacity
+    TSharedPtr<FAsteroidSpatialSnapshot, ESPMode::ThreadSafe> NewSnapshot = Snapshot;
+    if (NewSnapshot.IsValid() && NewSnapshot.IsUnique())
+    {
+        NewSnapshot->Positions.Reset();
+        NewSnapshot->Radii.Reset();
+        NewSnapshot->Actors.Reset();
+        NewSnapshot->Cells.Reset();
+        NewSnapshot->MaxEntryRadius = 0.0f;
+        NewSnapshot->Bounds = FBox(ForceInit);
+    }
+    else
+    {
+        NewSnapshot = MakeShared<FAsteroidSpatialSnapshot, ESPMode::ThreadSafe>();
+    }
+
+    NewSnapshot->CellSize = CellSize;
+    NewSnapshot->Positions.Reserve(Entries.Num());
+    NewSnapshot->Radii.Reserve(Entries.Num());
+    NewSnapshot->Actors.Reserve(Entries.Num());
+    NewSnapshot->Cells.Reserve(Cells.Num());
+
+    // Lay entries out cell by cell so each cell is one contiguous range
+    for (const TPair<FIntVector, TArray<int32>>& Pair : Cells)
+    {
+        FAsteroidSpatialSnapshot::FCellRange Range;
+        Range.Start = NewSnapshot->Positions.Num();
+        Range.Num = Pair.Value.Num();
+
+        for (const int32 Index : Pair.Value)
+        {
+            const FEntry& Entry = Entries[Index];
+            NewSnapshot->Positions.Add(Entry.Position);
+            NewSnapshot->Radii.Add(Entry.Radius);
+            NewSnapshot->Actors.Add(Entry.Actor);
+            NewSnapshot->MaxEntryRadius = FMath::Max(NewSnapshot->MaxEntryRadius, Entry.Radius);
+            NewSnapshot->Bounds += Entry.Position;
+        }
+
+        NewSnapshot->Cells.Add(Pair.Key, Range);
+    }
+
+    Snapshot = NewSnapshot;
+    bDirty = false;
+}
+
+// ------------------------- Queries -------------------------
+FAsteroidSpatialSnapshotPtr UAsteroidSpatialSubsystem::GetSnapshot()
+{
+    // Movement alone is only picked up once the snapshot is old enough
+    const UWorld* World = GetWorld();
+    const double Now = World ? World->GetTimeSeconds() : 0.0;
+    if (!Snapshot.IsValid() || Now - RefreshTime >= SnapshotInterval)
+    {
+        RefreshTime = Now;
+        if (RefreshEntries())
+        {
+            bDirty = true;
+        }
+    }
+    if (bDirty || !Snapshot.IsValid())
+    {
+        PublishSnapshot();
+    }
+    return Snapshot;
+}
+
+TArray<AAsteroidActor*> UAsteroidSpatialSubsystem::FindAsteroidsInRadius(const FVector& Center, float Radius)
+{
+    const FAsteroidSpatialSnapshotPtr Current = GetSnapshot();
+
+    TArray<FAsteroidSpatialHit> Hits;
+    Current->QueryRadius(Center, Radius, Hits);
+
+    TArray<AAsteroidActor*> Result;
+    Result.Reserve(Hits.Num());
+    for (const FAsteroidSpatialHit& Hit : Hits)
+    {
+        if (AAsteroidActor* Actor = Current->GetActor(Hit.Entry))
+        {
+            Result.Add(Actor);
+        }
+    }
+    return Result;
+}
+
+TArray<AAsteroidActor*> UAsteroidSpatialSubsystem::FindNearestAsteroids(const FVector& Point, int32 Count)
+{
+    const FAsteroidSpatialSnapshotPtr Current = GetSnapshot();
+
+    TArray<FAsteroidSpatialHit> Hits;
+    Current->QueryNearest(Point, Count, Hits);
+
+    TArray<AAsteroidActor*> Result;
+    Result.Reserve(Hits.Num());
+    for (const FAsteroidSpatialHit& Hit : Hits)
+    {
+        if (AAsteroidActor* Actor = Current->GetActor(Hit.Entry))
+        {
+            Result.Add(Actor);
+        }
+    }
+    return Result;
+}
+
+// ------------------------- Console -------------------------
+#if !UE_BUILD_SHIPPING
+namespace AsteroidSpatialPrivate
+{
+    static void PrintSpatialStats(UWorld* World)
+    {
+        if (UAsteroidSpatialSubsystem* Spatial = UAsteroidSpatialSubsystem::Get(World))
+        {
+            const FAsteroidSpatialSnapshotPtr Snapshot = Spatial->GetSnapshot();
+            UE_LOG(LogAsteroidSpatial, Display, TEXT("Asteroid spatial hash: %d asteroids, cell %.0fcm"),
+                Snapshot->Num(), Spatial->CellSize);
+        }
+    }
+
+    static FAutoConsoleCommandWithWorld SpatialStatsCommand(
+        TEXT("Asteroid.SpatialStats"),
+        TEXT("Print the number of asteroids in the spatial hash."),
+        FConsoleCommandWithWorldDelegate::CreateStatic(&PrintSpatialStats));
+}
+#endif // !UE_BUILD_SHIPPING
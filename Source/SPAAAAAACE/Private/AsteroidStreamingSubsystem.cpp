@@ -0,0 +1,375 @@
+/**
+ * AsteroidStreamingSubsystem Implementation
+ *
+ * Key Systems:
+ * - Deterministic cell content from (world seed, cell coordinates)
+ * - Load / unload queue maintenance with hysteresis
+ * - Budgeted acquisition and release of pooled asteroid actors
+ */
+
+#include "AsteroidStreamingSubsystem.h"
+#include "AsteroidActor.h"
+#include "AsteroidPoolSubsystem.h"
+#include "ShipPawn.h"
+#include "Engine/World.h"
+#include "EngineUtils.h"               // TActorIterator
+#include "GameFramework/PlayerController.h"
+#include "HAL/PlatformTime.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogAsteroidStreaming, Log, All);
+
+namespace AsteroidStreamingPrivate
+{
+    /** Murmur3 32-bit finalizer */
+    static uint32 Mix(uint32 H)
+    {
+        H ^= H >> 16;
+        H *= 0x85EBCA6Bu;
+        H ^= H >> 13;
+        H *= 0xC2B2AE35u;
+        H ^= H >> 16;
+        return H;
+    }
+
+    /** Stable seed for a cell; must not change between versions or saved worlds reshuffle */
+    static int32 HashCell(int32 WorldSeed, const FIntVector& Cell)
+    {
+        uint32 H = Mix((uint32)WorldSeed);
+        H = Mix(H ^ (uint32)Cell.X);
+        H = Mix(H ^ ((uint32)Cell.Y * 0x9E3779B1u));
+        H = Mix(H ^ ((uint32)Cell.Z * 0x85EBCA77u));
+        return (int32)(H & 0x7FFFFFFF);
+    }
+
+    /** World-wide palette seed, independent of the cell it is used in */
+    static int32 HashPaletteSeed(int32 WorldSeed, int32 PaletteIndex)
+    {
+        return (int32)(Mix(Mix((uint32)WorldSeed) ^ ((uint32)PaletteIndex * 0xC2B2AE3Du)) & 0x7FFFFFFF);
+    }
+
+    static int64 CellDistanceSquared(const FIntVector& A, const FIntVector& B)
+    {
+        const int64 DX = A.X - B.X;
+        const int64 DY = A.Y - B.Y;
+        const int64 DZ = A.Z - B.Z;
+        return DX * DX + DY * DY + DZ * DZ;
+    }
+}
+
+// ------------------------- Lifecycle -------------------------
+bool UAsteroidStreamingSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+    return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UAsteroidStreamingSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+    Super::OnWorldBeginPlay(InWorld);
+
+    if (bAutoStart)
+    {
+        StartStreaming(WorldSeed);
+    }
+}
+
+void UAsteroidStreamingSubsystem::Deinitialize()
+{
+    // The world is tearing down and takes the actors with it
+    bStreamingActive = false;
+    Cells.Reset();
+    LoadQueue.Reset();
+    ReleaseQueue.Reset();
+
+    Super::Deinitialize();
+}
+
+TStatId UAsteroidStreamingSubsystem::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(UAsteroidStreamingSubsystem, STATGROUP_Tickables);
+}
+
+UAsteroidStreamingSubsystem* UAsteroidStreamingSubsystem::Get(const UObject* WorldContext)
+{
+    UWorld* World = WorldContext ? WorldContext->GetWorld() : nullptr;
+    return World ? World->GetSubsystem<UAsteroidStreamingSubsystem>() : nullptr;
+}
+
+// ------------------------- Control -------------------------
+void UAsteroidStreamingSubsystem::StartStreaming(int32 InWorldSeed)
+{
+    StopStreaming();
+
+    ActiveWorldSeed = InWorldSeed;
+    ResolvedAsteroidClass = AsteroidClass.IsNull() ? nullptr : AsteroidClass.LoadSynchronous();
+    if (!ResolvedAsteroidClass)
+    {
+        ResolvedAsteroidClass = AAsteroidActor::StaticClass();
+    }
+    bStreamingActive = true;
+
+    UE_LOG(LogAsteroidStreaming, Log, TEXT("Asteroid streaming started: seed %d, cell %.0fcm, load %d / unload %d cells"),
+        ActiveWorldSeed, CellSize, LoadRadius, FMath::Max(UnloadRadius, LoadRadius + 1));
+}
+
+void UAsteroidStreamingSubsystem::StopStreaming()
+{
+    for (TPair<FIntVector, FAsteroidStreamCell>& Pair : Cells)
+    {
+        for (TWeakObjectPtr<AAsteroidActor>& Actor : Pair.Value.Actors)
+        {
+            if (Actor.IsValid())
+            {
+                ReleaseAsteroid(Actor.Get());
+            }
+        }
+    }
+    for (TWeakObjectPtr<AAsteroidActor>& Actor : ReleaseQueue)
+    {
+        if (Actor.IsValid())
+        {
+            ReleaseAsteroid(Actor.Get());
+        }
+    }
+
+    Cells.Reset();
+    LoadQueue.Reset();
+    ReleaseQueue.Reset();
+    LastCenterCell = FIntVector(MAX_int32);
+    bStreamingActive = false;
+}
+
+int32 UAsteroidStreamingSubsystem::GetNumStreamedAsteroids() const
+{
+    int32 Count = 0;
+    for (const TPair<FIntVector, FAsteroidStreamCell>& Pair : Cells)
+    {
+        for (const TWeakObjectPtr<AAsteroidActor>& Actor : Pair.Value.Actors)
+        {
+            Count += Actor.IsValid() ? 1 : 0;
+        }
+    }
+    return Count;
+}
+
+// ------------------------- Cell content -------------------------
+FIntVector UAsteroidStreamingSubsystem::GetCellForLocation(const FVector& Location) const
+{
+    return FIntVector(
+        FMath::FloorToInt(Location.X / CellSize),
+        FMath::FloorToInt(Location.Y / CellSize),
+        FMath::FloorToInt(Location.Z / CellSize));
+}
+
+void UAsteroidStreamingSubsystem::BuildCellSpawns(const FIntVector& Cell, TArray<FAsteroidStreamSpawn>& OutSpawns) const
+{
+    using namespace AsteroidStreamingPrivate;
+
+    FRandomStream Rand(HashCell(ActiveWorldSeed, Cell));
+
+    const int32 Count = Rand.RandRange(FMath::Min(MinAsteroidsPerCell, MaxAsteroidsPerCell), FMath::Max(MinAsteroidsPerCell, MaxAsteroidsPerCell));
+    const FVector Origin = FVector(Cell) * CellSize;
+    const float MinR = FMath::Min(MinRadius, MaxRadius);
+    const float MaxR = FMath::Max(MinRadius, MaxRadius);
+
+    OutSpawns.Reset(Count);
+    for (int32 Index = 0; Index < Count; ++Index)
+    {
+        FAsteroidStreamSpawn& Spawn = OutSpawns.AddDefaulted_GetRef();
+
+        const FVector Location = Origin + FVector(Rand.FRand(), Rand.FRand(), Rand.FRand()) * CellSize;
+        const FRotator Rotation(Rand.FRandRange(-180.0f, 180.0f), Rand.FRandRange(-180.0f, 180.0f), Rand.FRandRange(-180.0f, 180.0f));
+        Spawn.Transform = FTransform(Rotation, Location);
+        Spawn.Radius = Rand.FRandRange(MinR, MaxR);
+        Spawn.Seed = SeedPaletteSize > 0
+            ? HashPaletteSeed(ActiveWorldSeed, Rand.RandRange(0, SeedPaletteSize - 1))
+            : Rand.RandRange(0, MAX_int32);
+    }
+}
+
+// ------------------------- Streaming update -------------------------
+bool UAsteroidStreamingSubsystem::GetStreamingCenter(FVector& OutLocation) const
+{
+    UWorld* World = GetWorld();
+    if (!World)
+    {
+        return false;
+    }
+
+    APlayerController* PC = World->GetFirstPlayerController();
+    if (AShipPawn* Ship = PC ? Cast<AShipPawn>(PC->GetPawn()) : nullptr)
+    {
+        OutLocation = Ship->GetActorLocation();
+        return true;
+    }
+
+    // No possessed ship (e.g. during respawn) - fall back to any ship in the world
+    for (TActorIterator<AShipPawn> It(World); It; ++It)
+    {
+        OutLocation = It->GetActorLocation();
+        return true;
+    }
+    return false;
+}
+
+void UAsteroidStreamingSubsystem::UpdateQueues(const FIntVector& CenterCell)
+{
+    using namespace AsteroidStreamingPrivate;
+
+    const int32 Load = FMath::Max(0, LoadRadius);
+    const int64 LoadSq = (int64)Load * Load;
+    const int64 UnloadSq = (int64)FMath::Max(UnloadRadius, Load + 1) * FMath::Max(UnloadRadius, Load + 1);
+
+    // Unload first so memory is released before new cells arrive
+    TArray<FIntVector, TInlineAllocator<64>> FarCells;
+    for (const TPair<FIntVector, FAsteroidStreamCell>& Pair : Cells)
+    {
+        if (CellDistanceSquared(Pair.Key, CenterCell) > UnloadSq)
+        {
+            FarCells.Add(Pair.Key);
+        }
+    }
+    for (const FIntVector& Cell : FarCells)
+    {
+        UnloadCell(Cell);
+    }
+
+    LoadQueue.Reset();
+    for (int32 DZ = -Load; DZ <= Load; ++DZ)
+    {
+        for (int32 DY = -Load; DY <= Load; ++DY)
+        {
+            for (int32 DX = -Load; DX <= Load; ++DX)
+            {
+                const FIntVector Cell = CenterCell + FIntVector(DX, DY, DZ);
+                if (CellDistanceSquared(Cell, CenterCell) > LoadSq)
+                {
+                    continue;
+                }
+
+                const FAsteroidStreamCell* Existing = Cells.Find(Cell);
+                if (!Existing || Existing->NumSpawned < Existing->Spawns.Num())
+                {
+                    LoadQueue.Add(Cell);
+                }
+            }
+        }
+    }
+
+    // Cells left half-spawned by an earlier centre keep filling in
+    for (const TPair<FIntVector, FAsteroidStreamCell>& Pair : Cells)
+    {
+        if (Pair.Value.NumSpawned < Pair.Value.Spawns.Num() && CellDistanceSquared(Pair.Key, CenterCell) > LoadSq)
+        {
+            LoadQueue.Add(Pair.Key);
+        }
+    }
+
+    // Farthest first, so the nearest cell is popped from the back
+    LoadQueue.Sort([&CenterCell](const FIntVector& A, const FIntVector& B)
+    {
+        return CellDistanceSquared(A, CenterCell) > CellDistanceSquared(B, CenterCell);
+    });
+}
+
+void UAsteroidStreamingSubsystem::UnloadCell(const FIntVector& Cell)
+{
+    FAsteroidStreamCell* Entry = Cells.Find(Cell);
+    if (!Entry)
+    {
+        return;
+    }
+
+    // Hide now, release over the next frames within budget
+    for (TWeakObjectPtr<AAsteroidActor>& Actor : Entry->Actors)
+    {
+        if (Actor.IsValid())
+        {
+            Actor->SetActorHiddenInGame(true);
+            Actor->SetActorEnableCollision(false);
+            ReleaseQueue.Add(Actor);
+        }
+    }
+    Cells.Remove(Cell);
+}
+
+AAsteroidActor* UAsteroidStreamingSubsystem::SpawnAsteroid(const FAsteroidStreamSpawn& Spawn, UClass* Class)
+{
+    UAsteroidPoolSubsystem* Pool = UAsteroidPoolSubsystem::Get(this);
+    if (!Pool)
+    {
+        return nullptr;
+    }
+
+    return Pool->AcquireAsteroid(Class, Spawn.Transform, [&Spawn](AAsteroidActor& Asteroid)
+    {
+        Asteroid.GlobalSeed = Spawn.Seed;
+        Asteroid.MinRadius = Spawn.Radius;
+        Asteroid.MaxRadius = Spawn.Radius;
+    });
+}
+
+void UAsteroidStreamingSubsystem::ReleaseAsteroid(AAsteroidActor* Actor)
+{
+    if (UAsteroidPoolSubsystem* Pool = UAsteroidPoolSubsystem::Get(this))
+    {
+        Pool->ReleaseAsteroid(Actor);
+    }
+    else
+    {
+        Actor->Destroy();
+    }
+}
+
+void UAsteroidStreamingSubsystem::Tick(float DeltaTime)
+{
+    Super::Tick(DeltaTime);
+
+    FVector Center;
+    if (GetStreamingCenter(Center))
+    {
+        const FIntVector CenterCell = GetCellForLocation(Center);
+        if (CenterCell != LastCenterCell)
+        {
+            LastCenterCell = CenterCell;
+            UpdateQueues(CenterCell);
+        }
+    }
+
+    const double Deadline = FPlatformTime::Seconds() + FrameBudgetMs * 0.001;
+
+    int32 Released = 0;
+    while (ReleaseQueue.Num() > 0 && Released < MaxReleasesPerFrame && FPlatformTime::Seconds() < Deadline)
+    {
+        TWeakObjectPtr<AAsteroidActor> Actor = ReleaseQueue.Pop(false);
+        if (Actor.IsValid())
+        {
+            ReleaseAsteroid(Actor.Get());
+            ++Released;
+        }
+    }
+
+    int32 Spawned = 0;
+    while (LoadQueue.Num() > 0 && Spawned < MaxSpawnsPerFrame && FPlatformTime::Seconds() < Deadline)
+    {
+        const FIntVector Cell = LoadQueue.Last();
+
+        FAsteroidStreamCell* Entry = Cells.Find(Cell);
+        if (!Entry)
+        {
+            Entry = &Cells.Add(Cell);
+            BuildCellSpawns(Cell, Entry->Spawns);
+        }
+
+        if (Entry->NumSpawned < Entry->Spawns.Num())
+        {
+            Entry->Actors.Add(SpawnAsteroid(Entry->Spawns[Entry->NumSpawned], ResolvedAsteroidClass));
+            ++Entry->NumSpawned;
+            ++Spawned;
+        }
+
+        if (Entry->NumSpawned >= Entry->Spawns.Num())
+        {
+            LoadQueue.Pop(false);
+        }
+    }
+}
@@ -20,117 +20,51 @@
 
 #include "CoreMinimal.h"
 #include "GameFramework/Actor.h"
-#include "ProceduralMeshComponent.h"
+#include "AsteroidMeshComponent.h"
+#include "AsteroidGenerator.h"
+#include "AsteroidMeshRegistry.h"
+#include "AsteroidFracture.h"
 #include "AsteroidActor.generated.h"
 
 /**
- * FAsteroidStats - Asteroid Statistics Structure
+ * FOnAsteroidGenerated - Asteroid Generation Event Delegate
+ * 
+ * Multicast delegate that is broadcast when an asteroid is successfully generated.
+ * This allows other systems to respond to asteroid creation events.
  * 
- * Contains calculated statistics for a generated asteroid.
- * These values are computed during generation and stored for
- * physics simulation and gameplay purposes.
+ * @param Stats - The calculated statistics of the generated asteroid
  */
-USTRUCT(BlueprintType)
-struct FAsteroidStats
-{
-    GENERATED_BODY()
-
-    /**
-     * Radius - Asteroid Radius
-     * 
-     * The average radius of the asteroid in centimeters.
-     * This is calculated from the generated mesh vertices.
-     */
-    UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
-    float Radius = 0.0f;
-
-    /**
-     * Volume - Asteroid Volume
-     * 
-     * The calculated volume of the asteroid in cubic centimeters.
-     * This is used for mass calculations and physics simulation.
-     */
-    UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
-    double Volume = 0.0;
-
-    /**
-     * Mass - Asteroid Mass
-     * 
-     * The calculated mass of the asteroid in kilograms.
-     * This is computed from volume and density for physics simulation.
-     */
-    UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
-    double Mass = 0.0;
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnAsteroidGenerated, const FAsteroidStats&, Stats);
 
-    /**
-     * NoiseLayerSeeds - Noise Layer Seeds
-     * 
-     * The random seeds used for each noise layer during generation.
-     * These are stored for reproducibility - the same seeds will
-     * generate the same asteroid shape.
-     */
-    UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
-    TArray<int32> NoiseLayerSeeds;
-};
+/**
+ * FOnAsteroidFractured - Asteroid Break-Up Event Delegate
+ * 
+ * Broadcast just before a broken asteroid is hidden and its fragments
+ * take over.
+ * 
+ * @param ImpactPoint - World-space location of the impact that broke it
+ */
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnAsteroidFractured, const FVector&, ImpactPoint);
 
 /**
- * FNoiseLayer - Noise Layer Configuration
+ * EAsteroidCollisionLOD - Collision Detail Tier
  * 
- * Defines a single layer of noise deformation for asteroid generation.
- * Multiple layers can be combined to create complex, realistic asteroid shapes.
+ * Which body an asteroid simulates with. UAsteroidPhysicsSubsystem picks
+ * the tier from the distance to the nearest ship.
  */
-USTRUCT(BlueprintType)
-struct FNoiseLayer
+UENUM(BlueprintType)
+enum class EAsteroidCollisionLOD : uint8
 {
-    GENERATED_BODY()
-
-    /**
-     * Scale - Noise Scale
-     * 
-     * Controls the frequency/wavelength of the noise.
-     * Higher values create smaller, more detailed features.
-     * Lower values create larger, smoother features.
-     * 
-     * Default: 0.1 (creates medium-scale surface features)
-     */
-    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Noise")
-    float Scale = 0.1f;
+    /** Sphere at the asteroid's radius; nothing to cook */
+    Sphere  UMETA(DisplayName = "Sphere"),
 
-    /**
-     * Intensity - Noise Intensity
-     * 
-     * Controls how much the noise affects the asteroid shape.
-     * Higher values create more dramatic surface variations.
-     * Lower values create subtle surface details.
-     * 
-     * Default: 1.0 (moderate surface variation)
-     */
-    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Noise")
-    float Intensity = 1.0f;
+    /** Single hull of at most ReducedHullVertices vertices */
+    Reduced UMETA(DisplayName = "Reduced Hull"),
 
-    /**
-     * Seed - Layer-Specific Seed
-     * 
-     * Random seed for this noise layer. This allows for reproducible
-     * asteroid generation while maintaining variation between layers.
-     * 
-     * -1 = Use global seed + random offset
-     * Any other value = Use this specific seed
-     */
-    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Noise")
-    int32 Seed = -1;
+    /** Hull or pieces as set by MaxHullVertices and CollisionPieces */
+    Full    UMETA(DisplayName = "Full Hull")
 };
 
-/**
- * FOnAsteroidGenerated - Asteroid Generation Event Delegate
- * 
- * Multicast delegate that is broadcast when an asteroid is successfully generated.
- * This allows other systems to respond to asteroid creation events.
- * 
- * @param Stats - The calculated statistics of the generated asteroid
- */
-DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnAsteroidGenerated, const FAsteroidStats&, Stats);
-
 /**
  * AAsteroidActor - Procedural Asteroid Actor
  * 
@@ -169,6 +103,16 @@ protected:
      */
     virtual void BeginPlay() override;
 
+    /**
+     * EndPlay - Asteroid Shutdown
+     * 
+     * Called when the asteroid is removed from the world. Cancels any
+     * generation task that is still running so its result is discarded.
+     * 
+     * @param EndPlayReason - Why the actor is leaving play
+     */
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
 public:
     // ============================================================================
     // COMPONENTS
@@ -180,11 +124,11 @@ public:
      * The procedural mesh component that holds the generated asteroid geometry.
      * This component handles both rendering and physics collision for the asteroid.
      * 
-     * The mesh is generated procedurally using triangle collision for accurate
-     * physics simulation of the irregular asteroid shape.
+     * Collision is a convex hull of the generated mesh, taken from
+     * FAsteroidCollisionCache; a sphere proxy stands in while it cooks.
      */
     UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Components")
-    UProceduralMeshComponent* ProcMesh;
+    UAsteroidMeshComponent* ProcMesh;
 
     // ============================================================================
     // ASTEROID GENERATION CONFIGURATION
@@ -202,6 +146,20 @@ public:
     UPROPERTY(EditAnywhere, Category = "Asteroid Generation")
     int32 Subdivisions = 2;
 
+    /**
+     * GeodesicFrequency - Direct Detail Control
+     * 
+     * Number of segments each icosahedron edge is split into. Unlike
+     * Subdivisions, which can only step the triangle count by 4x, any value
+     * is allowed here (e.g. 6 sits between Subdivisions 2 and 3).
+     * 
+     * 0 = Derive from Subdivisions (frequency 2^Subdivisions)
+     * Any other value = Use this frequency and ignore Subdivisions
+     * Vertex count is 10 * F² + 2
+     */
+    UPROPERTY(EditAnywhere, Category = "Asteroid Generation", meta = (ClampMin = "0", ClampMax = "128"))
+    int32 GeodesicFrequency = 0;
+
     /**
      * MinRadius - Minimum Asteroid Radius
      * 
@@ -248,6 +206,16 @@ public:
     UPROPERTY(EditAnywhere, Category = "Asteroid Generation")
     int32 GlobalSeed = -1;
 
+    /**
+     * AsteroidId - Asteroid Identifier
+     * 
+     * Distinguishes asteroids that share a GlobalSeed. The shape depends
+     * only on GlobalSeed, so such asteroids still share geometry, but the
+     * radius is drawn from (GlobalSeed, AsteroidId) and differs per id.
+     */
+    UPROPERTY(EditAnywhere, Category = "Asteroid Generation")
+    int32 AsteroidId = 0;
+
     /**
      * NoiseLayers - Noise Layer Configuration
      * 
@@ -270,6 +238,42 @@ public:
     UPROPERTY(EditAnywhere, Category = "Asteroid Generation", meta = (ClampMin = "0.0"))
     float MaxDisplacementFraction = 0.5f;
 
+    /**
+     * NoiseMode - Noise Displacement Mode
+     * 
+     * ScalarField samples one seeded noise value per vertex with the batched
+     * SIMD kernel and displaces along the normal. LegacyVectorProject keeps
+     * the original three-sample projection for content authored against it.
+     * 
+     * Default: ScalarField (about a third of the noise cost, vectorized)
+     */
+    UPROPERTY(EditAnywhere, Category = "Asteroid Generation")
+    EAsteroidNoiseMode NoiseMode = EAsteroidNoiseMode::ScalarField;
+
+    /**
+     * NormalWeighting - Vertex Normal Weighting
+     * 
+     * How adjacent faces are combined into vertex normals. Area is the
+     * cheapest; Angle holds up best where the geodesic triangles are uneven.
+     * 
+     * Default: Area
+     */
+    UPROPERTY(EditAnywhere, Category = "Asteroid Generation")
+    EAsteroidNormalWeighting NormalWeighting = EAsteroidNormalWeighting::Area;
+
+    /**
+     * bSkipUnusedVertexBuffers - Skip UV/Colour/Tangent Buffers
+     * 
+     * The generator produces positions and normals only. When enabled the
+     * mesh section is created without UV, colour and tangent arrays and the
+     * component uses its defaults; disable if a material relies on the old
+     * zero-filled values.
+     * 
+     * Default: true
+     */
+    UPROPERTY(EditAnywhere, Category = "Asteroid Generation")
+    bool bSkipUnusedVertexBuffers = true;
+
     /**
      * bEnablePhysics - Physics Simulation
      * 
@@ -281,6 +285,187 @@ public:
     UPROPERTY(EditAnywhere, Category = "Asteroid Generation")
     bool bEnablePhysics = true;
 
+    // ============================================================================
+    // ASYNC GENERATION
+    // ============================================================================
+
+    /**
+     * bGenerateAsync - Background Generation
+     * 
+     * When enabled, the icosphere, noise, normal and statistics work runs on
+     * a worker task and only the mesh upload and collision setup happen on
+     * the game thread. Disable to generate synchronously inside BeginPlay.
+     * 
+     * Default: true (generate off the game thread)
+     */
+    UPROPERTY(EditAnywhere, Category = "Asteroid Generation|Async")
+    bool bGenerateAsync = true;
+
+    /**
+     * GenerationPriority - Worker Task Priority
+     * 
+     * Priority of the background generation task. Use High for rocks the
+     * player will see immediately and Low for distant field filler.
+     * 
+     * Default: Normal
+     */
+    UPROPERTY(EditAnywhere, Category = "Asteroid Generation|Async", meta = (EditCondition = "bGenerateAsync"))
+    EAsteroidGenerationPriority GenerationPriority = EAsteroidGenerationPriority::Normal;
+
+    // ============================================================================
+    // SHARED GEOMETRY
+    // ============================================================================
+
+    /**
+     * bShareGeometry - Share Identical Shapes
+     * 
+     * When enabled, geometry comes from FAsteroidMeshRegistry: asteroids
+     * with the same seed, detail and noise settings reuse one mesh built at
+     * the registry's reference radius, and the chosen radius is applied as
+     * the actor's scale. Any scale set on the actor is overwritten.
+     * Disable to generate a private mesh at the final radius.
+     * 
+     * Default: true (share geometry)
+     */
+    UPROPERTY(EditAnywhere, Category = "Asteroid Generation|Async")
+    bool bShareGeometry = true;
+
+    /**
+     * bCookCollisionAsync - Cook Collision On A Worker
+     * 
+     * When enabled, a shape whose convex collision is not already in
+     * FAsteroidCollisionCache gets a sphere proxy body at its radius, and
+     * the hull is cooked on a background task and swapped in (keeping the
+     * asteroid's velocity) when it is ready. Disable to cook on the game
+     * thread before the asteroid is shown. Cached hulls are used
+     * immediately either way.
+     * 
+     * Default: true (cook in the background)
+     */
+    UPROPERTY(EditAnywhere, Category = "Asteroid Generation|Async")
+    bool bCookCollisionAsync = true;
+
+    // ============================================================================
+    // COLLISION HULL
+    // ============================================================================
+
+    /**
+     * MaxHullVertices - Collision Hull Vertex Budget
+     * 
+     * Most vertices each convex collision hull may have. The hull is built
+     * from the mesh farthest-point-first, so a small budget keeps the
+     * outermost features. Fewer vertices make every contact against the
+     * asteroid cheaper. 0 uses every hull vertex of the mesh.
+     * 
+     * Default: 64
+     */
+    UPROPERTY(EditAnywhere, Category = "Asteroid Generation|Collision", meta = (ClampMin = "0", ClampMax = "256"))
+    int32 MaxHullVertices = 64;
+
+    /**
+     * HullTolerance - Collision Hull Error
+     * 
+     * The hull stops growing once no mesh vertex is farther than this
+     * fraction of the radius outside it, even with budget left.
+     * 
+     * Default: 0.01 (1% of the radius)
+     */
+    UPROPERTY(EditAnywhere, Category = "Asteroid Generation|Collision", meta = (ClampMin = "0.0", ClampMax = "0.5"))
+    float HullTolerance = 0.01f;
+
+    /**
+     * CollisionPieces - Convex Decomposition Piece Count
+     * 
+     * Number of convex pieces collision is split into, each covering one
+     * cone-shaped region of the surface. A single hull bridges over every
+     * dent; with more pieces, concavities between them stay open, so ships
+     * can fly into them. Pieces are cooked in parallel on the cook worker,
+     * but every piece adds contact cost. MaxHullVertices applies per piece.
+     * 
+     * Default: 1 (a single hull)
+     */
+    UPROPERTY(EditAnywhere, Category = "Asteroid Generation|Collision", meta = (ClampMin = "1", ClampMax = "16"))
+    int32 CollisionPieces = 1;
+
+    /**
+     * ReducedHullVertices - Mid-Range Hull Vertex Budget
+     * 
+     * Vertex budget of the single hull used at the Reduced collision tier,
+     * between the sphere far away and the full hull up close. Shares the
+     * cache with every asteroid of the same shape and size, like the full
+     * hull.
+     * 
+     * Default: 16
+     */
+    UPROPERTY(EditAnywhere, Category = "Asteroid Generation|Collision", meta = (ClampMin = "4", ClampMax = "256"))
+    int32 ReducedHullVertices = 16;
+
+    // ============================================================================
+    // MESH DEFORMATION
+    // ============================================================================
+
+    /**
+     * CollisionRebuildInterval - Deformation Collision Throttle
+     * 
+     * Minimum seconds between convex collision rebuilds while the mesh is
+     * being deformed. Collision lags the visible mesh by at most this long.
+     * A negative value never rebuilds automatically; call RebuildCollision.
+     * 
+     * Default: 0.5 seconds
+     */
+    UPROPERTY(EditAnywhere, Category = "Asteroid Generation|Deformation")
+    float CollisionRebuildInterval = 0.5f;
+
+    /**
+     * MinCoreFraction - Mining Depth Limit
+     * 
+     * CarveCrater never pushes a vertex closer to the centre than this
+     * fraction of the asteroid's radius, so the surface cannot fold over.
+     * 
+     * Default: 0.25
+     */
+    UPROPERTY(EditAnywhere, Category = "Asteroid Generation|Deformation", meta = (ClampMin = "0.0", ClampMax = "1.0"))
+    float MinCoreFraction = 0.25f;
+
+    // ============================================================================
+    // FRACTURE
+    // ============================================================================
+
+    /**
+     * bFracturable - Break Apart On Impact
+     * 
+     * When enabled, a fracture set is built on a worker task once the mesh
+     * is applied, and impacts faster than FractureImpactSpeed swap the
+     * asteroid for its fragments through UAsteroidFractureSubsystem.
+     * 
+     * Default: false
+     */
+    UPROPERTY(EditAnywhere, Category = "Asteroid Generation|Fracture")
+    bool bFracturable = false;
+
+    /**
+     * FragmentCount - Fragments Per Break
+     * 
+     * Number of pieces the asteroid splits into. Every asteroid with the
+     * same shape and count shares one cached fracture set.
+     * 
+     * Default: 8
+     */
+    UPROPERTY(EditAnywhere, Category = "Asteroid Generation|Fracture", meta = (EditCondition = "bFracturable", ClampMin = "2", ClampMax = "32"))
+    int32 FragmentCount = 8;
+
+    /**
+     * FractureImpactSpeed - Break Threshold
+     * 
+     * Change in closing speed (cm/s) an impact must cause to break the
+     * asteroid, measured from the contact impulse and both bodies' masses,
+     * so it does not depend on which body is heavier.
+     * 
+     * Default: 1500 cm/s
+     */
+    UPROPERTY(EditAnywhere, Category = "Asteroid Generation|Fracture", meta = (EditCondition = "bFracturable", ClampMin = "0.0"))
+    float FractureImpactSpeed = 1500.0f;
+
     // ============================================================================
     // EVENTS
     // ============================================================================
@@ -292,11 +477,21 @@ public:
      * This allows other systems to respond to asteroid creation events.
      * 
      * Use this to trigger gameplay events, spawn effects, or update game state
-     * when new asteroids are created.
+     * when new asteroids are created. With async generation this fires on the
+     * game thread once the worker result has been applied, not in BeginPlay.
      */
     UPROPERTY(BlueprintAssignable, Category = "Asteroid")
     FOnAsteroidGenerated OnAsteroidGenerated;
 
+    /**
+     * OnAsteroidFractured - Asteroid Break-Up Event
+     * 
+     * Broadcast when the asteroid breaks. Spawners that own the actor
+     * should treat it as gone and release it as usual.
+     */
+    UPROPERTY(BlueprintAssignable, Category = "Asteroid")
+    FOnAsteroidFractured OnAsteroidFractured;
+
     // ============================================================================
     // PUBLIC INTERFACE
     // ============================================================================
@@ -323,101 +518,427 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Asteroid")
     FAsteroidStats GetAsteroidStats() const { return AsteroidStats; }
 
-private:
+    /**
+     * IsGenerationPending - Check For In-Flight Generation
+     * 
+     * Returns true while a background generation task is running and
+     * the asteroid has no mesh yet.
+     * 
+     * @return True if generation has been requested but not applied
+     */
+    UFUNCTION(BlueprintCallable, Category = "Asteroid")
+    bool IsGenerationPending() const { return GenerationCancelFlag.IsValid(); }
+
+    /**
+     * GetDeterministicGenerationParams - Params For Offline Caching
+     * 
+     * Returns the generation params this asteroid will use, for tools that
+     * pre-generate geometry. Only asteroids with a fixed GlobalSeed have a
+     * reproducible shape; the radius in the result is not meaningful.
+     * 
+     * @param OutParams - Generation params with resolved layer seeds
+     * @return False if GlobalSeed is random
+     */
+    bool GetDeterministicGenerationParams(FAsteroidGenerationParams& OutParams) const;
+
     // ============================================================================
-    // INTERNAL STATE
+    // POOLING
     // ============================================================================
-    
+
     /**
-     * AsteroidStats - Asteroid Statistics Storage
+     * CopyGenerationSettings - Copy Generation Properties
      * 
-     * Internal storage for calculated asteroid statistics.
-     * This is populated during generation and used for physics setup.
+     * Copies every generation setting (seed, radius range, detail, noise,
+     * physics and async options) and the mesh material from another asteroid. Used by the pool to
+     * reset a recycled actor to its class defaults.
+     * 
+     * @param Source - Asteroid to copy from (usually a class default object)
      */
-    FAsteroidStats AsteroidStats;
+    void CopyGenerationSettings(const AAsteroidActor& Source);
+
+    /**
+     * DeactivateForPool - Park The Asteroid
+     * 
+     * Cancels pending generation, stops physics, hides the actor and
+     * disables collision. The mesh section and body instance are kept so
+     * the next ReactivateFromPool can reuse them. Safe to call on a
+     * deferred-spawned actor before FinishSpawning, in which case BeginPlay
+     * does not generate.
+     */
+    void DeactivateForPool();
+
+    /**
+     * ReactivateFromPool - Reuse A Parked Asteroid
+     * 
+     * Moves the asteroid and regenerates it from its current settings. It
+     * becomes visible and collidable once the new mesh is applied. When the new mesh has the same topology as the
+     * old one, the existing mesh section buffers are updated in place.
+     * 
+     * @param Transform - New world transform
+     */
+    void ReactivateFromPool(const FTransform& Transform);
+
+    /**
+     * IsPooled - Check Pool State
+     * 
+     * @return True while the asteroid is parked in a pool
+     */
+    UFUNCTION(BlueprintCallable, Category = "Asteroid")
+    bool IsPooled() const { return bPooled; }
 
     // ============================================================================
-    // MESH GENERATION
+    // MESH DEFORMATION
     // ============================================================================
-    
+
     /**
-     * BuildBaseIcosphere - Create Base Icosphere Mesh
+     * BeginMeshEdit - Make The Mesh Editable
      * 
-     * Creates the base icosphere mesh and subdivides it to the specified level.
-     * This forms the foundation for the asteroid shape.
+     * Copies the applied mesh into an editable buffer the first time it is
+     * called after generation. Shared registry geometry is detached, since
+     * this asteroid will no longer match it. Vertices are in mesh-local
+     * space, before the actor's scale.
      * 
-     * @param Vertices - Output array for mesh vertices
-     * @param Triangles - Output array for mesh triangles
-     * @param SubdivisionsLevel - Number of subdivision levels
+     * @return False if no mesh has been applied yet
      */
-    void BuildBaseIcosphere(TArray<FVector>& Vertices, TArray<int32>& Triangles, int32 SubdivisionsLevel);
-    
+    bool BeginMeshEdit();
+
     /**
-     * SubdivideIcosphere - Subdivide Icosphere Mesh
+     * GetEditableVertices / GetEditableNormals - Direct Buffer Access
      * 
-     * Subdivides the icosphere mesh to increase detail.
-     * Each subdivision level approximately quadruples the triangle count.
+     * Valid after a successful BeginMeshEdit until the next generation.
+     * Report every change with MarkMeshDirty.
+     */
+    TArrayView<FVector> GetEditableVertices() { return EditVertices; }
+    TArrayView<FVector> GetEditableNormals() { return EditNormals; }
+
+    /**
+     * MarkMeshDirty - Queue A Range For Upload
      * 
-     * @param Vertices - Mesh vertices (modified in place)
-     * @param Triangles - Mesh triangles (modified in place)
+     * The union of all ranges marked in a frame is pushed to the mesh
+     * section once, at the start of the next tick. Collision is rebuilt on
+     * the CollisionRebuildInterval throttle.
+     * 
+     * @param FirstVertex - First changed vertex
+     * @param Count - Number of changed vertices
+     * @param bAffectsCollision - Whether the change should reach the convex hull
      */
-    void SubdivideIcosphere(TArray<FVector>& Vertices, TArray<int32>& Triangles);
-    
+    void MarkMeshDirty(int32 FirstVertex, int32 Count, bool bAffectsCollision = true);
+
     /**
-     * GetMiddlePoint - Find Middle Point of Edge
+     * UpdateMeshVertices - Replace A Vertex Range
      * 
-     * Finds or creates the middle point of an edge between two vertices.
-     * This is used during icosphere subdivision to maintain mesh topology.
+     * Convenience over BeginMeshEdit / GetEditableVertices / MarkMeshDirty.
      * 
-     * @param p1 - First vertex index
-     * @param p2 - Second vertex index
-     * @param Vertices - Vertex array
-     * @param Cache - Cache for middle points to avoid duplicates
-     * @return Index of middle point vertex
+     * @param FirstVertex - First vertex to replace
+     * @param Positions - New mesh-local positions
+     * @param Normals - New normals for the same range (empty keeps the old ones)
+     * @return False if there is no mesh or the range is out of bounds
      */
-    int32 GetMiddlePoint(int32 p1, int32 p2, TArray<FVector>& Vertices, TMap<int64, int32>& Cache);
+    bool UpdateMeshVertices(int32 FirstVertex, TConstArrayView<FVector> Positions, TConstArrayView<FVector> Normals);
+
+    /**
+     * SetMeshVertexRange - Blueprint Vertex Update
+     * 
+     * @param FirstVertex - First vertex to replace
+     * @param Positions - New mesh-local positions
+     * @param Normals - New normals for the same range (empty keeps the old ones)
+     * @return False if there is no mesh or the range is out of bounds
+     */
+    UFUNCTION(BlueprintCallable, Category = "Asteroid|Deformation")
+    bool SetMeshVertexRange(int32 FirstVertex, const TArray<FVector>& Positions, const TArray<FVector>& Normals);
+
+    /**
+     * FlushMeshUpdate - Upload Pending Changes Now
+     * 
+     * Pushes the dirty range to the mesh section through UpdateMeshSection
+     * (positions and normals only) instead of waiting for the next tick.
+     */
+    UFUNCTION(BlueprintCallable, Category = "Asteroid|Deformation")
+    void FlushMeshUpdate();
+
+    /**
+     * RebuildCollision - Rebuild Convex Collision Now
+     * 
+     * Cooks a new hull from the editable vertices with the same vertex
+     * budget, tolerance and piece count as the undeformed shape, on a
+     * worker when bCookCollisionAsync is set. The body keeps its previous
+     * hull, and its velocity, until the new one is swapped in.
+     */
+    UFUNCTION(BlueprintCallable, Category = "Asteroid|Deformation")
+    void RebuildCollision();
+
+    /**
+     * CarveCrater - Dig Into The Surface
+     * 
+     * Pushes the vertices inside a sphere towards the centre with a smooth
+     * bowl falloff. Affected vertices are found by flood fill over the
+     * vertex adjacency from the vertex nearest the crater, then only their
+     * one-ring normals are recomputed and the removed volume is taken off
+     * the asteroid's stats. Cost scales with the crater, not the mesh, so
+     * it is cheap enough to call every frame from a mining beam. The
+     * physics mass follows on the next collision rebuild.
+     * 
+     * @param WorldCenter - Crater centre, usually the beam's hit point
+     * @param Radius - Crater radius in cm
+     * @param Depth - Depth at the centre in cm
+     * @return Mass removed in kg
+     */
+    UFUNCTION(BlueprintCallable, Category = "Asteroid|Deformation")
+    double CarveCrater(FVector WorldCenter, float Radius, float Depth);
+
+    /**
+     * SetCollisionLOD - Change Collision Detail
+     * 
+     * Swaps the physics body to the given tier, keeping its velocity. A
+     * hull that is not cached yet is cooked like a new mesh's, and the
+     * current body stays until it is ready. Normally driven by
+     * UAsteroidPhysicsSubsystem; a deformed asteroid uses its own hull at
+     * both hull tiers.
+     * 
+     * @param LOD - Tier to use
+     */
+    UFUNCTION(BlueprintCallable, Category = "Asteroid")
+    void SetCollisionLOD(EAsteroidCollisionLOD LOD);
+
+    /** @return Collision tier currently requested */
+    UFUNCTION(BlueprintCallable, Category = "Asteroid")
+    EAsteroidCollisionLOD GetCollisionLOD() const { return CollisionLOD; }
+
+    /** @return Topology of the applied mesh (adjacency for deformation), or null */
+    const FAsteroidIcosphereTopology* GetMeshTopology() const { return MeshTopology.Get(); }
 
     // ============================================================================
-    // NOISE AND DEFORMATION
+    // FRACTURE
     // ============================================================================
-    
+
+    /** @return Fracture set for the current shape, or null until it has been built */
+    FAsteroidFractureSetPtr GetFractureSet() const { return FractureSet; }
+
     /**
-     * ApplyNoiseLayers - Apply Noise Deformation
+     * GetFractureTransform - Fragment Space To World
      * 
-     * Applies multiple layers of noise to deform the asteroid shape.
-     * Each layer adds different scales and types of surface variation.
+     * Fracture sets are stored at the registry reference radius; this maps
+     * them onto the asteroid as it currently stands.
+     * 
+     * @return Transform from fracture set space to world space
+     */
+    FTransform GetFractureTransform() const;
+
+    /**
+     * MarkFractured - Retire A Broken Asteroid
+     * 
+     * Called by UAsteroidFractureSubsystem once fragments are taking over.
+     * Broadcasts OnAsteroidFractured, then stops physics, hides the actor
+     * and drops it from the physics and spatial subsystems. The actor
+     * stays alive for its owner to release.
      * 
-     * @param Vertices - Mesh vertices (modified in place)
-     * @param LayerSeeds - Random seeds for each noise layer
-     * @param MaxDisplacementFrac - Maximum displacement limit
+     * @param ImpactPoint - World-space impact location
      */
-    void ApplyNoiseLayers(TArray<FVector>& Vertices, const TArray<int32>& LayerSeeds, float MaxDisplacementFrac);
+    void MarkFractured(const FVector& ImpactPoint);
+
+    /**
+     * IsFractured - Check Break State
+     * 
+     * @return True once the asteroid has broken, until it is reused from the pool
+     */
+    UFUNCTION(BlueprintCallable, Category = "Asteroid")
+    bool IsFractured() const { return bFractured; }
 
+private:
     // ============================================================================
-    // UTILITIES
+    // INTERNAL STATE
     // ============================================================================
     
     /**
-     * NormalizeVertices - Normalize Vertex Positions
+     * AsteroidStats - Asteroid Statistics Storage
      * 
-     * Normalizes all vertices to unit length, creating a perfect sphere.
-     * This is done before applying noise deformation.
+     * Internal storage for calculated asteroid statistics.
+     * This is populated during generation and used for physics setup.
+     */
+    FAsteroidStats AsteroidStats;
+
+    /**
+     * GenerationCancelFlag - In-Flight Task Cancellation
      * 
-     * @param Vertices - Mesh vertices (modified in place)
+     * Shared with the worker task of the current generation request.
+     * Setting it makes the task stop at its next stage boundary and
+     * makes the game thread discard whatever result it produced.
      */
-    void NormalizeVertices(TArray<FVector>& Vertices);
-    
+    TSharedPtr<std::atomic<bool>, ESPMode::ThreadSafe> GenerationCancelFlag;
+
+    /**
+     * GenerationSerial - Generation Request Counter
+     * 
+     * Incremented for every generation request. Results tagged with an
+     * older serial are stale and ignored when they reach the game thread.
+     */
+    uint32 GenerationSerial = 0;
+
+    /**
+     * SharedMesh - Registry Geometry Reference
+     * 
+     * Keeps this asteroid's registry entry alive while bShareGeometry is
+     * enabled. Null for privately generated meshes.
+     */
+    FAsteroidSharedMeshPtr SharedMesh;
+
+    /**
+     * bPooled - Pool State
+     * 
+     * True while the asteroid is parked in UAsteroidPoolSubsystem.
+     */
+    bool bPooled = false;
+
+    /**
+     * bRevealOnApply - Deferred Reactivation
+     * 
+     * Set by ReactivateFromPool so the actor becomes visible and
+     * collidable only once its new mesh has been applied.
+     */
+    bool bRevealOnApply = false;
+
+    /**
+     * MeshTopology - Applied Mesh Topology
+     * 
+     * Triangle list and adjacency of the mesh currently in section 0.
+     */
+    TSharedPtr<const FAsteroidIcosphereTopology, ESPMode::ThreadSafe> MeshTopology;
+
+    /**
+     * EditVertices / EditNormals - Editable Mesh Copy
+     * 
+     * Empty until BeginMeshEdit; afterwards the authoritative mesh-local
+     * geometry that dirty ranges are uploaded from.
+     */
+    TArray<FVector> EditVertices;
+    TArray<FVector> EditNormals;
+
+    /** Pending upload range [DirtyFirst, DirtyEnd); DirtyFirst is INDEX_NONE when clean */
+    int32 DirtyFirst = INDEX_NONE;
+    int32 DirtyEnd = 0;
+
+    /** Convex collision is older than EditVertices */
+    bool bCollisionDirty = false;
+
+    /** AsteroidStats.Mass changed since the physics mass override was set */
+    bool bMassDirty = false;
+
+    /**
+     * VertexVisitStamps / TriangleVisitStamps - Crater Scratch
+     * 
+     * Per-element marks compared against VisitStamp, so each crater starts
+     * with a clean set by bumping one counter instead of clearing arrays.
+     */
+    TArray<uint32> VertexVisitStamps;
+    TArray<uint32> TriangleVisitStamps;
+    uint32 VisitStamp = 0;
+
+    /** Bumps VisitStamp, clearing the stamp arrays when it wraps */
+    uint32 NextVisitStamp();
+
+    /** World time of the last deformation collision rebuild */
+    double LastCollisionRebuildTime = -1.0e9;
+
+    FTimerHandle MeshFlushTimer;
+    FTimerHandle CollisionRebuildTimer;
+
+    /** Drops editable state and pending work; called when a new mesh is applied */
+    void ResetMeshEdit();
+
     /**
-     * CreateMeshFromData - Create Procedural Mesh
+     * ShapeKey - Current Shape Identity
      * 
-     * Creates the final procedural mesh from vertex and triangle data.
-     * This handles both rendering and physics collision setup.
+     * Key of the shape last requested by GenerateAsteroid, used to look up
+     * the cached fracture set whether or not the geometry is shared.
+     */
+    FAsteroidShapeKey ShapeKey;
+
+    /**
+     * FractureSet - Precomputed Fragments
      * 
-     * @param Vertices - Mesh vertices
-     * @param Triangles - Mesh triangles
-     * @param bCreateCollision - Whether to create physics collision
+     * Null until the worker build for the current mesh finishes.
      */
-    void CreateMeshFromData(const TArray<FVector>& Vertices, const TArray<int32>& Triangles, bool bCreateCollision);
+    FAsteroidFractureSetPtr FractureSet;
+
+    /** Asteroid radius in the space the current mesh's vertices were built in */
+    float MeshSpaceRadius = 1.0f;
+
+    /** Mesh-space size of one fracture set unit (1 for shared geometry) */
+    float FractureMeshScale = 1.0f;
+
+    /** Bumped per fracture set request; stale worker results are dropped */
+    uint32 FractureSerial = 0;
+
+    /** Broken and hidden, waiting to be released */
+    bool bFractured = false;
+
+    /** Bumped per collision request; stale cooks are dropped */
+    uint32 CollisionSerial = 0;
+
+    /** Collision comes from the edited vertices rather than the cache */
+    bool bDeformedCollision = false;
+
+    /** Hull cooked from the edited vertices; null while its cook is in flight */
+    FAsteroidCollisionShapePtr DeformedCollision;
+
+    /** Collision tier, see SetCollisionLOD */
+    EAsteroidCollisionLOD CollisionLOD = EAsteroidCollisionLOD::Full;
+
+    /**
+     * Cooked hulls of the Reduced and Full tiers this mesh has used. The
+     * cache only holds weak references, so without these a hull dropped
+     * for a coarser tier would be cooked again on the way back.
+     */
+    FAsteroidCollisionShapePtr TierCollision[2];
+
+    /** Drops the held tier hulls once the mesh they were cooked for is gone */
+    void ResetTierCollision()
+    {
+        TierCollision[0].Reset();
+        TierCollision[1].Reset();
+    }
+
+    /**
+     * RequestCollision - Fetch Or Cook Collision For The Current Tier
+     * 
+     * Uses a sphere at the Sphere tier, and otherwise the cached hull for
+     * this shape, size and tier if one is live. Otherwise cooks it, either
+     * right away or on a background worker task (see bCookCollisionAsync);
+     * a new mesh waits behind a sphere proxy. Expects AsteroidStats to
+     * describe the current mesh.
+     * 
+     * @param MeshData - Geometry that was just applied, or null for a tier change
+     */
+    void RequestCollision(const FAsteroidMeshData* MeshData);
+
+    /**
+     * MakeCollisionSource - Geometry For A Collision Cook
+     * 
+     * @param MeshData - Geometry that was just applied, or null to read back the mesh section
+     * @return Vertices and topology safe to hand to a worker, or null if there is no mesh
+     */
+    TSharedPtr<const FAsteroidMeshData, ESPMode::ThreadSafe> MakeCollisionSource(const FAsteroidMeshData* MeshData) const;
+
+    /**
+     * RequestFractureSet - Fetch Or Build Fragments
+     * 
+     * Takes the cached set if one is live, otherwise builds it on a
+     * background worker task from the applied mesh.
+     * 
+     * @param MeshData - Geometry that was just applied
+     */
+    void RequestFractureSet(const FAsteroidMeshData& MeshData);
+
+    /**
+     * HandleProcMeshHit - Impact Test
+     * 
+     * Queues a break when an impact is hard enough.
+     */
+    UFUNCTION()
+    void HandleProcMeshHit(UPrimitiveComponent* HitComponent, AActor* OtherActor, UPrimitiveComponent* OtherComp, FVector NormalImpulse, const FHitResult& Hit);
+
+    /** Removes the asteroid from the physics and spatial subsystems */
+    void UnregisterFromSubsystems();
 
     // ============================================================================
     // GENERATION LIFECYCLE
@@ -427,37 +948,62 @@ private:
      * GenerateAsteroid - Main Generation Function
      * 
      * Orchestrates the entire asteroid generation process:
-     * 1. Create base icosphere
-     * 2. Apply noise deformation
-     * 3. Scale to desired size
-     * 4. Calculate statistics
-     * 5. Create mesh and physics
-     * 6. Broadcast generation event
+     * 1. Resolve seeds and radius on the game thread
+     * 2. Build geometry, normals and statistics (worker task when async)
+     * 3. Hand the result to ApplyGeneratedMesh on the game thread
      */
     void GenerateAsteroid();
 
-    // ============================================================================
-    // STATISTICS CALCULATION
-    // ============================================================================
-    
     /**
-     * CalculateStats - Calculate Asteroid Statistics
+     * MakeGenerationParams - Snapshot Generation Settings
+     * 
+     * Resolves the global seed, per-layer seeds and the chosen radius and
+     * copies them together with the rest of the configuration into a
+     * self-contained parameter block for the geometry pipeline.
+     * 
+     * @return Parameters ready to be handed to FAsteroidGenerator
+     */
+    FAsteroidGenerationParams MakeGenerationParams() const;
+
+    /**
+     * CancelPendingGeneration - Abort In-Flight Generation
+     * 
+     * Signals the running generation task (if any) to stop and
+     * invalidates its result.
+     */
+    void CancelPendingGeneration();
+
+    /**
+     * AcceptGenerationResult - Validate Worker Result
+     * 
+     * Checks that a result arriving on the game thread still belongs to
+     * the current request and clears the pending state if it does.
+     * 
+     * @param Serial - Serial the request was launched with
+     * @param CancelFlag - Cancel flag the request was launched with
+     * @return True if the result should be applied
+     */
+    bool AcceptGenerationResult(uint32 Serial, const std::atomic<bool>& CancelFlag);
+
+    /**
+     * ApplySharedMesh - Use Registry Geometry
      * 
-     * Calculates the final statistics for the generated asteroid.
-     * This includes radius, volume, and mass calculations.
+     * Holds the shared entry, scales the actor to the requested radius and
+     * applies the mesh with statistics computed for that radius.
      * 
-     * @param ChosenRadius - The selected radius for the asteroid
+     * @param Mesh - Shared reference-radius geometry
+     * @param Params - Parameters the mesh was requested with
      */
-    void CalculateStats(float ChosenRadius);
+    void ApplySharedMesh(const FAsteroidSharedMeshPtr& Mesh, const FAsteroidGenerationParams& Params);
 
     /**
-     * CalculateVolumeFromRadius - Calculate Volume from Radius
+     * ApplyGeneratedMesh - Game Thread Hand-off
      * 
-     * Calculates the volume of a sphere with the given radius.
-     * This is used for mass calculations.
+     * Uploads finished geometry to the procedural mesh component, builds
+     * convex collision, configures physics and broadcasts OnAsteroidGenerated.
      * 
-     * @param Radius - Sphere radius in centimeters
-     * @return Volume in cubic centimeters
+     * @param MeshData - Finished geometry
+     * @param Stats - Statistics for this asteroid
      */
-    double CalculateVolumeFromRadius(double Radius) const;
+    void ApplyGeneratedMesh(const FAsteroidMeshData& MeshData, const FAsteroidStats& Stats);
 };
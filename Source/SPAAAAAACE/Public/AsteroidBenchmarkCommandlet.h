@@ -0,0 +1,61 @@
+/**
+ * AsteroidBenchmarkCommandlet - Asteroid Generation Benchmark
+ *
+ * This file defines a headless commandlet that generates asteroids across
+ * a matrix of detail levels, noise-layer counts and seeds and times every
+ * stage of the pipeline separately, so branches can be compared on the
+ * same machine.
+ *
+ * Usage:
+ *   UnrealEditor-Cmd SPAAAAAACE.uproject -run=AsteroidBenchmark -nullrhi
+ *       [-Subdivisions=1+2+3+4] [-Layers=1+2+4] [-Count=50] [-FirstSeed=1]
+ *       [-Warmup=3] [-HullVertices=64] [-HullTolerance=0.01] [-Pieces=1]
+ *       [-Format=CSV|JSON] [-Out=<path>] [-Label=<branch>]
+ *
+ * Key Features:
+ * - Stages: icosphere build, adjacency, FAsteroidGenerator::Generate
+ *   (noise, normals, upload buffers and stats, through the specialized
+ *   kernel whenever one applies), mesh section creation, convex cooking
+ *   (a bounded-hull cache miss in FAsteroidCollisionCache::FindOrCook)
+ * - Per-stage mean / p50 / p90 / p99 / max over Count asteroids per cell
+ *   of the matrix; warm-up runs are discarded
+ * - Per-stage scratch arena allocations, bytes and the heap blocks the
+ *   arena had to take, from FAsteroidScratch's counters
+ * - Per-stage general heap bytes, as the net LLM-tagged bytes each stage
+ *   left allocated; reported as "untracked" unless run with -llm
+ * - Physical memory growth per cell and process peak physical memory
+ * - Steady-state heap check: after the timed runs each cell generates
+ *   Count more asteroids into the same output and fails the commandlet
+ *   if the scratch arena took a heap block or, with -llm, if any heap
+ *   bytes tagged to those calls were left allocated
+ * - CSV (one row per cell and stage) or JSON output under
+ *   Saved/Benchmarks unless -Out is given
+ *
+ * The allocator itself is left alone. Scratch counters and physical memory
+ * are process-wide, so anything else running during the benchmark is
+ * included; run it on an otherwise idle editor process.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "AsteroidBenchmarkCommandlet.generated.h"
+
+UCLASS()
+class SPAAAAAACE_API UAsteroidBenchmarkCommandlet : public UCommandlet
+{
+    GENERATED_BODY()
+
+public:
+    UAsteroidBenchmarkCommandlet();
+
+    /**
+     * Main - Commandlet Entry Point
+     *
+     * @param Params - Command line (see file header)
+     * @return 0 on success, 1 if the report could not be written or the
+     *         steady-state heap check failed
+     */
+    virtual int32 Main(const FString& Params) override;
+};
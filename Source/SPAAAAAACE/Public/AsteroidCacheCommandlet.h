@@ -0,0 +1,41 @@
+/**
+ * AsteroidCacheCommandlet - Offline Asteroid Cache Builder
+ *
+ * This file defines a commandlet that loads one or more maps, collects
+ * every asteroid shape they will generate at runtime, and writes them to
+ * the persistent geometry cache (FAsteroidDiskCache).
+ *
+ * Usage:
+ *   UnrealEditor-Cmd SPAAAAAACE.uproject -run=AsteroidCache -Map=/Game/Maps/Belt+/Game/Maps/Station [-Clean]
+ *
+ * Key Features:
+ * - Gathers AAsteroidActor and AAsteroidFieldActor shapes with fixed seeds
+ * - Keeps still-valid entries from the existing file unless -Clean is given
+ * - Generates missing shapes in parallel
+ *
+ * Asteroids with a random seed (GlobalSeed / FieldSeed = -1) cannot be
+ * cached and are skipped. Only the persistent level of each map is scanned.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "AsteroidCacheCommandlet.generated.h"
+
+UCLASS()
+class SPAAAAAACE_API UAsteroidCacheCommandlet : public UCommandlet
+{
+    GENERATED_BODY()
+
+public:
+    UAsteroidCacheCommandlet();
+
+    /**
+     * Main - Commandlet Entry Point
+     *
+     * @param Params - Command line (-Map=A+B, -Clean)
+     * @return 0 on success, 1 on failure
+     */
+    virtual int32 Main(const FString& Params) override;
+};
@@ -0,0 +1,246 @@
+/**
+ * AsteroidCollisionCache - Shared Cooked Collision
+ *
+ * This file defines a process-wide cache of cooked convex collision, so an
+ * asteroid shape is cooked once and every asteroid with that shape and
+ * size reuses the result.
+ *
+ * Key Features:
+ * - Keyed by shape (FAsteroidShapeKey, which carries the seeds) and a
+ *   logarithmic radius bucket
+ * - Bounded hulls: at most N vertices, built from the star-shaped mesh by
+ *   an icosahedron-seeded incremental hull that culls interior points by
+ *   radius and stops once the remaining error is under a tolerance
+ * - Optional decomposition into a few convex pieces, one cone-shaped
+ *   region of the surface each, so concavities between them stay open
+ * - Cooking builds the Chaos convexes directly, pieces in parallel, and is
+ *   safe on worker threads
+ * - Reference counted: an entry lives exactly as long as someone holds it
+ * - Hit/miss and cook time counters (Asteroid.CollisionCacheStats)
+ *
+ * Shared geometry always cooks at FAsteroidMeshRegistry::ReferenceRadius
+ * and scales with the actor, so it needs one entry per shape. Private
+ * geometry is cooked at its bucket's radius, which differs from the actual
+ * radius by at most half a bucket step.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AsteroidMeshRegistry.h"
+
+namespace Chaos
+{
+    class FConvex;
+}
+
+/**
+ * FAsteroidCollisionKey - Cooked Collision Identity
+ */
+struct SPAAAAAACE_API FAsteroidCollisionKey
+{
+    /** Shape the convex was cooked from */
+    FAsteroidShapeKey Shape;
+
+    /** Radius bucket, see FAsteroidCollisionCache::GetRadiusBucket */
+    int32 RadiusBucket = 0;
+
+    /** Hull vertex budget (0 = every hull vertex of the mesh) */
+    int32 MaxHullVertices = 0;
+
+    /** Allowed hull error as a fraction of the radius */
+    float HullTolerance = 0.0f;
+
+    /** Convex pieces to decompose into (1 = a single hull) */
+    int32 PieceCount = 1;
+
+    FAsteroidCollisionKey() = default;
+    FAsteroidCollisionKey(const FAsteroidShapeKey& InShape, int32 InRadiusBucket, int32 InMaxHullVertices = 0, float InHullTolerance = 0.0f, int32 InPieceCount = 1)
+        : Shape(InShape), RadiusBucket(InRadiusBucket), MaxHullVertices(InMaxHullVertices), HullTolerance(InHullTolerance), PieceCount(InPieceCount)
+    {
+    }
+
+    bool operator==(const FAsteroidCollisionKey& Other) const
+    {
+        return RadiusBucket == Other.RadiusBucket && MaxHullVertices == Other.MaxHullVertices
+            && HullTolerance == Other.HullTolerance && PieceCount == Other.PieceCount && Shape == Other.Shape;
+    }
+
+    friend uint32 GetTypeHash(const FAsteroidCollisionKey& Key)
+    {
+        uint32 Hash = HashCombineFast(GetTypeHash(Key.Shape), GetTypeHash(Key.RadiusBucket));
+        Hash = HashCombineFast(Hash, GetTypeHash(Key.MaxHullVertices));
+        Hash = HashCombineFast(Hash, GetTypeHash(Key.HullTolerance));
+        return HashCombineFast(Hash, GetTypeHash(Key.PieceCount));
+    }
+};
+
+/**
+ * FAsteroidCollisionPiece - One Cooked Convex
+ */
+struct FAsteroidCollisionPiece
+{
+    /** Cooked convex hull */
+    TSharedPtr<Chaos::FConvex, ESPMode::ThreadSafe> Convex;
+
+    /** Hull vertices, for the body setup's bounds and debug drawing */
+    TArray<FVector> HullVertices;
+};
+
+/**
+ * FAsteroidCollisionShape - Cache Entry
+ *
+ * Immutable cooked collision: one convex, or several when decomposed. The
+ * Chaos convexes are shared with every body created from this entry.
+ */
+struct FAsteroidCollisionShape
+{
+    /** Shape, bucket and budget this collision was cooked for */
+    FAsteroidCollisionKey Key;
+
+    /** Convex pieces; never empty */
+    TArray<FAsteroidCollisionPiece> Pieces;
+};
+
+typedef TSharedPtr<const FAsteroidCollisionShape, ESPMode::ThreadSafe> FAsteroidCollisionShapePtr;
+
+/**
+ * FAsteroidCollisionCacheStats - Cache Counters
+ */
+struct FAsteroidCollisionCacheStats
+{
+    /** Lookups satisfied by an existing entry */
+    int64 Hits = 0;
+
+    /** Lookups that had to cook */
+    int64 Misses = 0;
+
+    /** Total time spent cooking, in seconds */
+    double CookSeconds = 0.0;
+
+    /** Entries currently referenced by at least one user */
+    int32 LiveEntries = 0;
+
+    /** Hull vertices summed over every piece of the live entries */
+    int32 LiveHullVertices = 0;
+};
+
+/**
+ * FAsteroidCollisionCache - Cooked Collision Cache
+ *
+ * Static cache mapping FAsteroidCollisionKey to cooked convex collision.
+ * Like FAsteroidMeshRegistry it only holds weak references.
+ */
+class SPAAAAAACE_API FAsteroidCollisionCache
+{
+public:
+    /** Relative width of one radius bucket (2% per step) */
+    static constexpr float RadiusBucketStep = 0.02f;
+
+    /**
+     * GetRadiusBucket - Bucket For A Radius
+     *
+     * Buckets are logarithmic and bucket 0 is exactly
+     * FAsteroidMeshRegistry::ReferenceRadius.
+     *
+     * @param Radius - Mesh-space radius in centimeters
+     * @return Bucket index
+     */
+    static int32 GetRadiusBucket(float Radius);
+
+    /**
+     * GetBucketRadius - Radius A Bucket Is Cooked At
+     *
+     * @param Bucket - Bucket index
+     * @return Radius in centimeters
+     */
+    static float GetBucketRadius(int32 Bucket);
+
+    /**
+     * Find - Look Up Cooked Collision
+     *
+     * Never cooks. Safe to call from any thread.
+     *
+     * @param Key - Shape and bucket to look up
+     * @return Cooked collision, or null if nobody currently holds it
+     */
+    static FAsteroidCollisionShapePtr Find(const FAsteroidCollisionKey& Key);
+
+    /**
+     * FindOrCook - Look Up Or Cook Collision
+     *
+     * Returns the live entry for Key, cooking one from Vertices if there
+     * is none. Vertices are rescaled from VertexRadius to the bucket's
+     * radius first, split by DecomposeStarShaped when the key asks for
+     * more than one piece, and each piece is reduced by BuildBoundedHull
+     * when the key sets a vertex budget or tolerance. Racing cooks of the
+     * same key are resolved on insert. Intended for worker threads.
+     *
+     * @param Key - Shape, bucket, hull budget and piece count
+     * @param Vertices - Mesh vertices to build the hull from
+     * @param Triangles - Mesh triangle indices; only needed for more than one piece
+     * @param VertexRadius - Radius Vertices were generated at
+     * @return Cooked collision, or null if the hull was degenerate
+     */
+    static FAsteroidCollisionShapePtr FindOrCook(const FAsteroidCollisionKey& Key, TConstArrayView<FVector> Vertices, TConstArrayView<int32> Triangles, float VertexRadius);
+
+    /**
+     * CookUncached - Cook Collision For One-Off Geometry
+     *
+     * Cooks exactly like FindOrCook but at the vertices' own scale and
+     * without touching the cache, for geometry no other asteroid shares
+     * (deformed asteroids, fracture fragments). The result's Key is left
+     * default. Intended for worker threads.
+     *
+     * @param Vertices - Mesh vertices to build the hull from
+     * @param Triangles - Mesh triangle indices; only needed for more than one piece
+     * @param Radius - Radius HullTolerance is relative to
+     * @param MaxHullVertices - Hull vertex budget per piece (0 = unlimited)
+     * @param HullTolerance - Allowed hull error as a fraction of Radius
+     * @param PieceCount - Convex pieces to decompose into
+     * @return Cooked collision, or null if the hull was degenerate
+     */
+    static FAsteroidCollisionShapePtr CookUncached(TConstArrayView<FVector> Vertices, TConstArrayView<int32> Triangles, float Radius, int32 MaxHullVertices, float HullTolerance, int32 PieceCount = 1);
+
+    /**
+     * DecomposeStarShaped - Split A Star-Shaped Mesh Into Convex Pieces
+     *
+     * Clusters vertex directions into PieceCount cones around the center
+     * (spherical k-means from evenly spread seeds). Each piece is the
+     * center plus every vertex of a triangle touching its cone, so
+     * neighbouring pieces overlap along their seams and their union covers
+     * the whole solid. A concavity is kept wherever it falls between
+     * pieces, so more pieces keep smaller features.
+     *
+     * @param Vertices - Mesh vertices, star-shaped around the origin
+     * @param Triangles - Mesh triangle indices
+     * @param PieceCount - Number of cones
+     * @param OutPieces - Point set of each non-empty piece
+     */
+    static void DecomposeStarShaped(TConstArrayView<FVector> Vertices, TConstArrayView<int32> Triangles, int32 PieceCount, TArray<TArray<FVector>>& OutPieces);
+
+    /**
+     * BuildBoundedHull - Pick Hull Points From A Star-Shaped Mesh
+     *
+     * The mesh must be star-shaped around the origin, as every asteroid
+     * is. The hull starts from the extreme points in the 12 icosahedron
+     * directions; every point whose radius is within the hull's inner
+     * radius is discarded without a plane test, and the rest are added
+     * farthest-first until the farthest remaining point is within
+     * Tolerance of the hull or MaxVertices is reached. A hull of N
+     * vertices has at most 2N - 4 faces.
+     *
+     * @param Vertices - Mesh vertices
+     * @param MaxVertices - Vertex budget (0 = unlimited)
+     * @param Tolerance - Largest distance a point may be left outside the hull
+     * @param OutPoints - Hull vertices
+     */
+    static void BuildBoundedHull(TConstArrayView<FVector> Vertices, int32 MaxVertices, double Tolerance, TArray<FVector>& OutPoints);
+
+    /**
+     * GetStats - Read Cache Counters
+     *
+     * @return Hit/miss counters, cook time and live entry count
+     */
+    static FAsteroidCollisionCacheStats GetStats();
+};
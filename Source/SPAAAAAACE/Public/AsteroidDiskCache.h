@@ -0,0 +1,185 @@
+/**
+ * AsteroidDiskCache - Persistent Asteroid Geometry Cache
+ *
+ * This file defines a versioned binary file of pre-generated asteroid
+ * geometry and the memory-mapped reader used at runtime.
+ *
+ * Key Features:
+ * - One file holding many shapes, addressed by FAsteroidShapeKey::GetStableHash
+ * - Memory-mapped on first use; lookups are a binary search over the mapped table
+ * - Whole-file invalidation when the format or FAsteroidGenerator::AlgorithmVersion changes
+ * - Writer used by UAsteroidCacheCommandlet to pre-populate the file offline
+ *
+ * File Layout (little-endian):
+ * - FAsteroidDiskCacheHeader
+ * - EntryCount x FAsteroidDiskCacheEntry, sorted by KeyHash
+ * - Per entry, 16-byte aligned: VertexCount float3 positions, then VertexCount float3 normals
+ *
+ * Geometry is stored at FAsteroidMeshRegistry::ReferenceRadius. Triangle
+ * indices are not stored: they depend only on the geodesic frequency and
+ * come from the shared topology cache. Cooked collision is not stored
+ * either: it is keyed by radius bucket and hull settings as well as shape
+ * (FAsteroidCollisionKey), and FAsteroidCollisionCache rebuilds its bounded
+ * hulls from these vertices on a worker, off the game thread.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AsteroidGenerator.h"
+
+class IMappedFileHandle;
+class IMappedFileRegion;
+struct FAsteroidShapeKey;
+
+/**
+ * FAsteroidDiskCacheHeader - File Header
+ */
+struct FAsteroidDiskCacheHeader
+{
+    uint32 Magic = 0;
+    uint32 FormatVersion = 0;
+    uint32 GeneratorVersion = 0;
+    uint32 EntryCount = 0;
+    float ReferenceRadius = 0.0f;
+    uint32 Reserved = 0;
+};
+
+/**
+ * FAsteroidDiskCacheEntry - Table Entry
+ */
+struct FAsteroidDiskCacheEntry
+{
+    /** FAsteroidShapeKey::GetStableHash of the stored shape */
+    uint64 KeyHash = 0;
+
+    /** Byte offset of the position block from the start of the file */
+    uint64 DataOffset = 0;
+
+    /** Geodesic frequency of the stored mesh */
+    int32 Frequency = 0;
+
+    /** Number of vertices (10F² + 2) */
+    int32 VertexCount = 0;
+};
+
+/**
+ * FAsteroidDiskCacheRecord - In-Memory Record For Writing
+ */
+struct FAsteroidDiskCacheRecord
+{
+    uint64 KeyHash = 0;
+    int32 Frequency = 0;
+    TArray<FVector3f> Positions;
+    TArray<FVector3f> Normals;
+};
+
+/**
+ * FAsteroidDiskCacheFile - Mapped Cache File
+ *
+ * Read-only view of one cache file. A file with the wrong magic, format,
+ * generator version or reference radius, or with entries that point
+ * outside the file, is treated as empty.
+ */
+class SPAAAAAACE_API FAsteroidDiskCacheFile
+{
+public:
+    /**
+     * Constructor - Map A Cache File
+     *
+     * @param Path - File to map; a missing file gives an empty cache
+     */
+    explicit FAsteroidDiskCacheFile(const FString& Path);
+    ~FAsteroidDiskCacheFile();
+
+    /** @return True if the file was mapped and passed validation */
+    bool IsValid() const { return Entries != nullptr; }
+
+    /** @return Number of shapes in the file */
+    int32 Num() const { return EntryCount; }
+
+    /**
+     * Find - Look Up One Shape
+     *
+     * @param KeyHash - FAsteroidShapeKey::GetStableHash of the shape
+     * @return Table entry, or null if the shape is not in the file
+     */
+    const FAsteroidDiskCacheEntry* Find(uint64 KeyHash) const;
+
+    /** @return Mapped positions of an entry (VertexCount * 3 floats) */
+    const float* GetPositions(const FAsteroidDiskCacheEntry& Entry) const;
+
+    /** @return Mapped normals of an entry (VertexCount * 3 floats) */
+    const float* GetNormals(const FAsteroidDiskCacheEntry& Entry) const;
+
+    /** @return All table entries, sorted by KeyHash */
+    TConstArrayView<FAsteroidDiskCacheEntry> GetEntries() const { return TConstArrayView<FAsteroidDiskCacheEntry>(Entries, EntryCount); }
+
+private:
+    TUniquePtr<IMappedFileHandle> Handle;
+    TUniquePtr<IMappedFileRegion> Region;
+    const uint8* Data = nullptr;
+    const FAsteroidDiskCacheEntry* Entries = nullptr;
+    int32 EntryCount = 0;
+};
+
+/**
+ * FAsteroidDiskCache - Runtime Cache Access
+ *
+ * Static entry points used by the mesh registry and the commandlet. The
+ * runtime file is mapped once, on the first lookup, and stays mapped for
+ * the life of the process.
+ */
+class SPAAAAAACE_API FAsteroidDiskCache
+{
+public:
+    /** File identifier ('ASTC') */
+    static constexpr uint32 Magic = 0x43545341;
+
+    /** Bump when the file layout changes */
+    static constexpr uint32 FormatVersion = 1;
+
+    /**
+     * GetCacheFilePath - Cache File Location
+     *
+     * The file lives under Content/AsteroidCache, which is staged as a
+     * loose (non-UFS) directory so it can be memory-mapped in packaged builds.
+     *
+     * @return Absolute path of the cache file
+     */
+    static FString GetCacheFilePath();
+
+    /**
+     * Load - Read Geometry From The Runtime Cache
+     *
+     * Fills Vertices, Normals and Topology of OutData from the mapped file.
+     * Stats are left untouched. Thread-safe. Always fails when the
+     * Asteroid.DiskCache console variable is 0.
+     *
+     * @param Key - Shape to load
+     * @param OutData - Output geometry at the reference radius
+     * @return True on a cache hit
+     */
+    static bool Load(const FAsteroidShapeKey& Key, FAsteroidMeshData& OutData);
+
+    /**
+     * Write - Write A Cache File
+     *
+     * Writes Records to a temporary file and moves it over Path.
+     *
+     * @param Path - Destination file
+     * @param Records - Shapes to store (sorted by hash on write)
+     * @return True if the file was written
+     */
+    static bool Write(const FString& Path, TArray<FAsteroidDiskCacheRecord>& Records);
+
+    /**
+     * MakeRecord - Convert Generated Geometry For Writing
+     *
+     * @param KeyHash - Stable hash of the shape
+     * @param Frequency - Geodesic frequency
+     * @param MeshData - Geometry generated at the reference radius
+     * @return Record ready for Write
+     */
+    static FAsteroidDiskCacheRecord MakeRecord(uint64 KeyHash, int32 Frequency, const FAsteroidMeshData& MeshData);
+};
@@ -0,0 +1,416 @@
+/**
+ * AsteroidFieldActor - Instanced Asteroid Field
+ *
+ * This file defines an actor that fills a volume with thousands of asteroids
+ * rendered through hierarchical instanced static meshes (HISM), and promotes
+ * individual rocks to full physics-simulating AAsteroidActors only when
+ * something gets close to them.
+ *
+ * Key Features:
+ * - A bounded palette of shape variants built with the normal asteroid pipeline
+ * - Thousands of instances with per-instance position, rotation and scale
+ * - Deterministic placement from a single field seed
+ * - Proximity promotion to AAsteroidActor and demotion back to an instance
+ *
+ * Each variant is fetched from FAsteroidMeshRegistry at its reference radius
+ * and converted into a transient UStaticMesh. Instances scale that mesh to their own radius. A
+ * promoted actor regenerates the same seed at the instance radius, so the
+ * swap is visually seamless.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/Actor.h"
+#include "AsteroidGenerator.h"
+#include "AsteroidMeshRegistry.h"
+#include "AsteroidFieldActor.generated.h"
+
+class AAsteroidActor;
+class UHierarchicalInstancedStaticMeshComponent;
+class UMaterialInterface;
+class UStaticMesh;
+
+/**
+ * EAsteroidFieldInstanceState - Instance Representation
+ *
+ * Tracks whether an asteroid in the field is drawn as an HISM instance,
+ * is waiting for its promoted actor to finish generating, is fully
+ * represented by a physics-simulating actor, or has left the field for good
+ * (broken up or destroyed) and is never shown or promoted again.
+ */
+enum class EAsteroidFieldInstanceState : uint8
+{
+    Instanced,
+    Promoting,
+    Promoted,
+    Gone
+};
+
+/**
+ * FAsteroidFieldInstance - Per-Instance Bookkeeping
+ *
+ * Everything the field needs to know about one asteroid, whether it is
+ * currently an instance or a promoted actor.
+ */
+struct FAsteroidFieldInstance
+{
+    /** Transform relative to the field actor (scale = radius / FAsteroidMeshRegistry::ReferenceRadius) */
+    FTransform LocalTransform;
+
+    /** Asteroid radius in centimeters */
+    float Radius = 0.0f;
+
+    /** Index into the variant palette */
+    int32 Variant = 0;
+
+    /** Index of this asteroid inside its variant's HISM component (stable for the field's lifetime) */
+    int32 InstanceIndex = INDEX_NONE;
+
+    /** Current representation */
+    EAsteroidFieldInstanceState State = EAsteroidFieldInstanceState::Instanced;
+
+    /** Promoted actor while Promoting or Promoted */
+    TWeakObjectPtr<AAsteroidActor> PromotedActor;
+};
+
+/**
+ * AAsteroidFieldActor - Instanced Asteroid Field Actor
+ *
+ * Generates VariantCount asteroid shapes on worker threads, then scatters
+ * InstanceCount instances of them through the field volume. Instances near
+ * a trigger actor (the player ship by default) are replaced by
+ * AAsteroidActors so they can collide and move; promoted actors that drift
+ * far enough away are turned back into instances.
+ */
+UCLASS()
+class SPAAAAAACE_API AAsteroidFieldActor : public AActor
+{
+    GENERATED_BODY()
+
+public:
+    /**
+     * Constructor
+     *
+     * Creates the field root component and enables a low-rate tick for
+     * promotion checks.
+     */
+    AAsteroidFieldActor();
+
+protected:
+    /**
+     * BeginPlay - Field Initialization
+     *
+     * Lays out all instances and starts background generation of the
+     * shape variants.
+     */
+    virtual void BeginPlay() override;
+
+    /**
+     * EndPlay - Field Shutdown
+     *
+     * Cancels variant generation and destroys promoted actors.
+     *
+     * @param EndPlayReason - Why the actor is leaving play
+     */
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+public:
+    /**
+     * Tick - Promotion Update
+     *
+     * Runs promotion and demotion checks every PromotionCheckInterval seconds.
+     *
+     * @param DeltaSeconds - Frame time
+     */
+    virtual void Tick(float DeltaSeconds) override;
+
+    // ============================================================================
+    // FIELD LAYOUT
+    // ============================================================================
+
+    /**
+     * InstanceCount - Number Of Asteroids
+     *
+     * Total number of asteroids scattered through the field.
+     *
+     * Default: 2000
+     */
+    UPROPERTY(EditAnywhere, Category = "Asteroid Field", meta = (ClampMin = "0"))
+    int32 InstanceCount = 2000;
+
+    /**
+     * VariantCount - Number Of Distinct Shapes
+     *
+     * How many different asteroid meshes are generated. Each gets its own
+     * HISM component; instances pick one at random.
+     *
+     * Default: 8
+     */
+    UPROPERTY(EditAnywhere, Category = "Asteroid Field", meta = (ClampMin = "1", ClampMax = "64"))
+    int32 VariantCount = 8;
+
+    /**
+     * FieldExtent - Field Half-Size
+     *
+     * Half-size of the box (in the actor's local space) that instances are
+     * scattered through, in centimeters.
+     *
+     * Default: 100000cm (a 2km cube)
+     */
+    UPROPERTY(EditAnywhere, Category = "Asteroid Field")
+    FVector FieldExtent = FVector(100000.0f);
+
+    /**
+     * FieldSeed - Placement And Shape Seed
+     *
+     * Seed for instance placement and variant shapes.
+     *
+     * -1 = Use random seed (different each time)
+     * Any other value = Use this specific seed (reproducible)
+     */
+    UPROPERTY(EditAnywhere, Category = "Asteroid Field")
+    int32 FieldSeed = -1;
+
+    /**
+     * MinRadius / MaxRadius - Instance Radius Range
+     *
+     * Radius range for instances in centimeters.
+     */
+    UPROPERTY(EditAnywhere, Category = "Asteroid Field")
+    float MinRadius = 250.0f;
+
+    UPROPERTY(EditAnywhere, Category = "Asteroid Field")
+    float MaxRadius = 1000.0f;
+
+    /**
+     * Material - Asteroid Material
+     *
+     * Material applied to instances and promoted actors.
+     */
+    UPROPERTY(EditAnywhere, Category = "Asteroid Field")
+    TObjectPtr<UMaterialInterface> Material;
+
+    // ============================================================================
+    // SHAPE GENERATION
+    // ============================================================================
+
+    /**
+     * Subdivisions / GeodesicFrequency - Variant Detail
+     *
+     * Same meaning as on AAsteroidActor. Promoted actors use these values too.
+     */
+    UPROPERTY(EditAnywhere, Category = "Asteroid Field|Shape")
+    int32 Subdivisions = 2;
+
+    UPROPERTY(EditAnywhere, Category = "Asteroid Field|Shape", meta = (ClampMin = "0", ClampMax = "128"))
+    int32 GeodesicFrequency = 0;
+
+    /**
+     * NoiseLayers - Variant Noise Layers
+     *
+     * Noise configuration shared by all variants. Layers with Seed = -1 get
+     * a distinct seed per variant.
+     */
+    UPROPERTY(EditAnywhere, Category = "Asteroid Field|Shape")
+    TArray<FNoiseLayer> NoiseLayers;
+
+    UPROPERTY(EditAnywhere, Category = "Asteroid Field|Shape", meta = (ClampMin = "0.0"))
+    float MaxDisplacementFraction = 0.5f;
+
+    UPROPERTY(EditAnywhere, Category = "Asteroid Field|Shape")
+    EAsteroidNoiseMode NoiseMode = EAsteroidNoiseMode::ScalarField;
+
+    UPROPERTY(EditAnywhere, Category = "Asteroid Field|Shape")
+    EAsteroidNormalWeighting NormalWeighting = EAsteroidNormalWeighting::Area;
+
+    /**
+     * Density - Material Density
+     *
+     * Density in kg/m³ given to promoted actors.
+     */
+    UPROPERTY(EditAnywhere, Category = "Asteroid Field|Shape")
+    float Density = 7874.0f;
+
+    // ============================================================================
+    // PROMOTION
+    // ============================================================================
+
+    /**
+     * AsteroidClass - Promoted Actor Class
+     *
+     * Class spawned when an instance is promoted. Must be AAsteroidActor
+     * or a subclass.
+     */
+    UPROPERTY(EditAnywhere, Category = "Asteroid Field|Promotion")
+    TSubclassOf<AAsteroidActor> AsteroidClass;
+
+    /**
+     * TriggerClass - Promotion Trigger
+     *
+     * Actors of this class promote nearby instances. Defaults to AShipPawn.
+     */
+    UPROPERTY(EditAnywhere, Category = "Asteroid Field|Promotion")
+    TSubclassOf<AActor> TriggerClass;
+
+    /**
+     * PromotionRadius - Promotion Distance
+     *
+     * An instance is promoted once a trigger is within this distance of its
+     * surface, in centimeters.
+     *
+     * Default: 5000cm (50 meters)
+     */
+    UPROPERTY(EditAnywhere, Category = "Asteroid Field|Promotion", meta = (ClampMin = "0.0"))
+    float PromotionRadius = 5000.0f;
+
+    /**
+     * bAllowDemotion - Demote Distant Actors
+     *
+     * When enabled, promoted actors that end up farther than DemotionRadius
+     * from every trigger are turned back into instances at their current
+     * transform. Their velocity is discarded.
+     */
+    UPROPERTY(EditAnywhere, Category = "Asteroid Field|Promotion")
+    bool bAllowDemotion = true;
+
+    /**
+     * DemotionRadius - Demotion Distance
+     *
+     * Must be larger than PromotionRadius so asteroids do not flip back and
+     * forth at the boundary.
+     *
+     * Default: 8000cm (80 meters)
+     */
+    UPROPERTY(EditAnywhere, Category = "Asteroid Field|Promotion", meta = (ClampMin = "0.0", EditCondition = "bAllowDemotion"))
+    float DemotionRadius = 8000.0f;
+
+    /**
+     * PromotionCheckInterval - Check Rate
+     *
+     * Seconds between promotion/demotion passes.
+     *
+     * Default: 0.2 seconds
+     */
+    UPROPERTY(EditAnywhere, Category = "Asteroid Field|Promotion", meta = (ClampMin = "0.0"))
+    float PromotionCheckInterval = 0.2f;
+
+    // ============================================================================
+    // PUBLIC INTERFACE
+    // ============================================================================
+
+    /**
+     * PromoteInstance - Replace An Instance With An Actor
+     *
+     * Acquires an AAsteroidActor from the pool for the given instance. The
+     * instance stays visible until the actor's mesh is ready.
+     *
+     * @param Index - Field instance index
+     * @return The spawned actor, or nullptr if the index is invalid or already promoted
+     */
+    UFUNCTION(BlueprintCallable, Category = "Asteroid Field")
+    AAsteroidActor* PromoteInstance(int32 Index);
+
+    /**
+     * DemoteInstance - Replace An Actor With An Instance
+     *
+     * Moves the instance to the promoted actor's current transform, shows
+     * it again and releases the actor to the pool.
+     *
+     * @param Index - Field instance index
+     */
+    UFUNCTION(BlueprintCallable, Category = "Asteroid Field")
+    void DemoteInstance(int32 Index);
+
+    /**
+     * GetNumPromoted - Count Promoted Asteroids
+     *
+     * @return Number of asteroids currently represented by actors
+     */
+    UFUNCTION(BlueprintCallable, Category = "Asteroid Field")
+    int32 GetNumPromoted() const { return NumPromoted; }
+
+    /**
+     * AreVariantsReady - Check Variant Generation
+     *
+     * @return True once all variant meshes are built and instances are visible
+     */
+    UFUNCTION(BlueprintCallable, Category = "Asteroid Field")
+    bool AreVariantsReady() const { return bVariantsReady; }
+
+    /**
+     * GetVariantGenerationParams - Params For Offline Caching
+     *
+     * Returns the generation params of every variant, for tools that
+     * pre-generate geometry. Only fields with a fixed FieldSeed have
+     * reproducible variants.
+     *
+     * @param OutParams - One entry per variant, at the reference radius
+     * @return False if FieldSeed is random
+     */
+    bool GetVariantGenerationParams(TArray<FAsteroidGenerationParams>& OutParams) const;
+
+private:
+    /** Field root */
+    UPROPERTY(VisibleAnywhere, Category = "Components")
+    TObjectPtr<USceneComponent> FieldRoot;
+
+    /** One HISM per variant */
+    UPROPERTY(Transient)
+    TArray<TObjectPtr<UHierarchicalInstancedStaticMeshComponent>> VariantComponents;
+
+    /** Transient meshes built from the generated variants */
+    UPROPERTY(Transient)
+    TArray<TObjectPtr<UStaticMesh>> VariantMeshes;
+
+    /** Registry geometry of each variant, held so promoted actors reuse it */
+    TArray<FAsteroidSharedMeshPtr> VariantGeometry;
+
+    /** Global seed of each variant (fed to promoted actors) */
+    TArray<int32> VariantSeeds;
+
+    /** All asteroids in the field */
+    TArray<FAsteroidFieldInstance> Instances;
+
+    /** Cancels variant generation if the field goes away first */
+    TSharedPtr<std::atomic<bool>, ESPMode::ThreadSafe> GenerationCancelFlag;
+
+    /** Time accumulated toward the next promotion pass */
+    float TimeSinceCheck = 0.0f;
+
+    /** Number of instances not in the Instanced state */
+    int32 NumPromoted = 0;
+
+    /** True once variant meshes exist */
+    bool bVariantsReady = false;
+
+    /** Resolved FieldSeed */
+    int32 UsedFieldSeed = 0;
+
+    /** Builds FAsteroidGenerationParams for a variant seed at the given radius */
+    FAsteroidGenerationParams MakeVariantParams(int32 VariantSeed, float Radius) const;
+
+    /** Draws VariantCount variant seeds; must be the first use of the field stream */
+    void DrawVariantSeeds(FRandomStream& Rand, TArray<int32>& OutSeeds) const;
+
+    /** Places all instances deterministically from the field seed */
+    void LayoutInstances();
+
+    /** Launches variant generation on worker threads */
+    void GenerateVariants();
+
+    /** Game-thread hand-off: builds static meshes and HISM components */
+    void OnVariantsGenerated(TArray<FAsteroidSharedMeshPtr>& VariantData);
+
+    /** Promotion and demotion pass */
+    void UpdatePromotion();
+
+    /** Instance transform with zero scale, used to hide promoted instances */
+    void SetInstanceHidden(const FAsteroidFieldInstance& Instance, bool bHidden);
+
+    /** Returns a promoted actor to the pool (destroys it if there is none) */
+    void ReleasePromotedActor(AAsteroidActor* Actor);
+
+    /** Builds a transient static mesh from generated geometry */
+    UStaticMesh* BuildVariantMesh(const FAsteroidMeshData& MeshData);
+};
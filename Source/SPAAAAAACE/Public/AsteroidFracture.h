@@ -0,0 +1,155 @@
+/**
+ * AsteroidFracture - Precomputed Asteroid Fragment Sets
+ *
+ * This file defines the geometry half of asteroid fracture: splitting a
+ * generated asteroid into closed fragments ahead of time, so breaking it
+ * on impact only has to swap actors.
+ *
+ * Key Features:
+ * - Built from the asteroid's own icosphere and displaced vertices
+ * - Surface split into seed-driven Voronoi cells on the unit sphere; each
+ *   fragment is its surface patch closed off with walls to the centre
+ * - Fragment volumes partition the asteroid exactly, so mass fractions
+ *   add up to one
+ * - Sets stored at FAsteroidMeshRegistry::ReferenceRadius and cached per
+ *   shape and fragment count, shared by every asteroid of that shape
+ * - Each fragment carries a bounded convex hull cooked with the set, so
+ *   spawning debris never cooks collision
+ *
+ * Plain data and static functions only; safe to build on worker threads.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AsteroidGenerator.h"
+#include "AsteroidMeshRegistry.h"
+#include "AsteroidCollisionCache.h"
+
+/**
+ * FAsteroidFragment - One Fragment Of A Fracture Set
+ *
+ * Geometry is relative to the fragment's centre of mass, so a fragment
+ * actor placed at Center has its pivot where physics expects it.
+ */
+struct FAsteroidFragment
+{
+    /** Centre of mass in reference-radius mesh space */
+    FVector Center = FVector::ZeroVector;
+
+    /** Vertices relative to Center (ProcMesh upload format) */
+    TArray<FVector> Vertices;
+
+    /** Per-vertex normals; surface vertices keep the asteroid's, walls are flat */
+    TArray<FVector> Normals;
+
+    /** Triangle index list (three indices per triangle) */
+    TArray<int32> Triangles;
+
+    /** Share of the asteroid's volume, and so of its mass */
+    double MassFraction = 0.0;
+
+    /** Distance from Center to the farthest vertex, in reference-radius units */
+    float BoundingRadius = 0.0f;
+
+    /** Bounded convex hull around Vertices, or null if it was degenerate */
+    FAsteroidCollisionShapePtr Collision;
+};
+
+/**
+ * FAsteroidFractureSet - Fragments For One Shape
+ */
+struct FAsteroidFractureSet
+{
+    /** Shape this set was built for */
+    FAsteroidShapeKey Key;
+
+    /** Requested fragment count (empty cells are dropped, so Fragments may hold fewer) */
+    int32 FragmentCount = 0;
+
+    /** Fragments; MassFraction sums to one */
+    TArray<FAsteroidFragment> Fragments;
+
+    /** Heap bytes held by the fragments' buffers */
+    SIZE_T GetAllocatedSize() const;
+};
+
+typedef TSharedPtr<const FAsteroidFractureSet, ESPMode::ThreadSafe> FAsteroidFractureSetPtr;
+
+/**
+ * FAsteroidFracture - Fracture Set Builder And Cache
+ *
+ * Static builder plus a process-wide weak cache keyed by shape and
+ * fragment count. As with FAsteroidMeshRegistry, the pointers handed out
+ * are the reference count.
+ */
+class SPAAAAAACE_API FAsteroidFracture
+{
+public:
+    /** Largest fragment count a set may be built with */
+    static constexpr int32 MaxFragments = 32;
+
+    /** Hull vertex budget of a fragment's collision */
+    static constexpr int32 FragmentHullVertices = 24;
+
+    /** Allowed hull error of a fragment's collision, as a fraction of its bounding radius */
+    static constexpr float FragmentHullTolerance = 0.02f;
+
+    /**
+     * BuildFractureSet - Split A Mesh Into Fragments
+     *
+     * Voronoi sites are drawn from Seed; each triangle goes to the site
+     * nearest its unit-sphere centroid. Each fragment is its patch plus one
+     * wall triangle to the mesh origin per boundary edge, which is closed
+     * because the generator only displaces vertices radially. Every
+     * fragment's collision hull is cooked here as well.
+     *
+     * @param Vertices - Asteroid vertices in mesh space
+     * @param Normals - Asteroid vertex normals
+     * @param Topology - Triangles and adjacency of the mesh
+     * @param ToReference - Scale from mesh space to reference-radius space
+     * @param FragmentCount - Number of Voronoi sites, clamped to [2, MaxFragments]
+     * @param Seed - Site seed
+     * @param OutSet - Set to fill (Key is left to the caller)
+     * @param CancelFlag - Optional flag that aborts the build when set
+     * @return False if cancelled or the mesh is empty
+     */
+    static bool BuildFractureSet(TConstArrayView<FVector> Vertices, TConstArrayView<FVector> Normals, const FAsteroidIcosphereTopology& Topology, float ToReference, int32 FragmentCount, int32 Seed, FAsteroidFractureSet& OutSet, const std::atomic<bool>* CancelFlag = nullptr);
+
+    /**
+     * Find - Look Up A Cached Set
+     *
+     * Never builds. Safe to call from any thread.
+     *
+     * @param Key - Asteroid shape
+     * @param FragmentCount - Requested fragment count
+     * @return Cached set, or null if nobody currently holds one
+     */
+    static FAsteroidFractureSetPtr Find(const FAsteroidShapeKey& Key, int32 FragmentCount);
+
+    /**
+     * FindOrBuild - Look Up Or Build A Set
+     *
+     * Builds from the given mesh on a miss. The site seed is derived from
+     * the key, so every asteroid of a shape breaks the same way. Intended
+     * for worker threads.
+     *
+     * @param Key - Asteroid shape
+     * @param FragmentCount - Requested fragment count
+     * @param Vertices - Asteroid vertices in mesh space
+     * @param Normals - Asteroid vertex normals
+     * @param Topology - Triangles and adjacency of the mesh
+     * @param ToReference - Scale from mesh space to reference-radius space
+     * @param CancelFlag - Optional flag that aborts the build when set
+     * @return Shared set, or null if cancelled
+     */
+    static FAsteroidFractureSetPtr FindOrBuild(const FAsteroidShapeKey& Key, int32 FragmentCount, TConstArrayView<FVector> Vertices, TConstArrayView<FVector> Normals, const FAsteroidIcosphereTopology& Topology, float ToReference, const std::atomic<bool>* CancelFlag = nullptr);
+
+    /**
+     * GetCacheStats - Live Cache Contents
+     *
+     * @param OutLiveSets - Sets currently held by at least one asteroid
+     * @param OutLiveBytes - Heap bytes held by those sets
+     */
+    static void GetCacheStats(int32& OutLiveSets, SIZE_T& OutLiveBytes);
+};
@@ -0,0 +1,179 @@
+/**
+ * AsteroidFractureSubsystem - Asteroid Break-Up
+ *
+ * This file defines a world subsystem that breaks asteroids into their
+ * precomputed fragment sets and owns the fragment actors.
+ *
+ * Key Features:
+ * - Break requests (from impacts or gameplay) are queued and handled at
+ *   the next tick, outside the physics callback that raised them
+ * - Fragments come from a pool of parked AAsteroidFragmentActors; nothing
+ *   is generated on the impact frame
+ * - Fragment masses add up to the asteroid's mass, and fragments inherit
+ *   its linear and angular velocity plus a small separation speed
+ * - Global fragment budget: the oldest fragments are recycled to make
+ *   room, and breaks are capped per frame, so chain reactions stay bounded
+ * - Fragments expire after FragmentLifetime seconds
+ *
+ * Only asteroids with bFracturable set build fracture sets. Settings are
+ * read from the [/Script/SPAAAAAACE.AsteroidFractureSubsystem] section of
+ * DefaultGame.ini.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "AsteroidFractureSubsystem.generated.h"
+
+class AAsteroidActor;
+class AAsteroidFragmentActor;
+
+/**
+ * UAsteroidFractureSubsystem - Fracture And Fragment Pool Subsystem
+ */
+UCLASS(Config = Game)
+class SPAAAAAACE_API UAsteroidFractureSubsystem : public UTickableWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    // ============================================================================
+    // LIFECYCLE MANAGEMENT
+    // ============================================================================
+
+    /**
+     * Deinitialize - Subsystem Cleanup
+     *
+     * Forgets pending breaks, active and parked fragments; the world
+     * destroys the actors.
+     */
+    virtual void Deinitialize() override;
+
+    /**
+     * Tick - Break Queue And Fragment Expiry
+     *
+     * Handles up to MaxFracturesPerFrame queued breaks and parks fragments
+     * that have outlived FragmentLifetime.
+     *
+     * @param DeltaTime - Frame time
+     */
+    virtual void Tick(float DeltaTime) override;
+
+    virtual TStatId GetStatId() const override;
+    virtual bool IsTickable() const override { return PendingFractures.Num() > 0 || ActiveFragments.Num() > 0; }
+
+    // ============================================================================
+    // ACCESS AND FRACTURE
+    // ============================================================================
+
+    /**
+     * Get - Get Fracture Subsystem Instance
+     *
+     * @param WorldContext - Any object with world context
+     * @return Pointer to the fracture subsystem, or nullptr if not found
+     */
+    UFUNCTION(BlueprintPure, Category = "Asteroid Fracture")
+    static UAsteroidFractureSubsystem* Get(const UObject* WorldContext);
+
+    /**
+     * RequestFracture - Queue A Break
+     *
+     * Safe to call from hit callbacks. Duplicate requests for the same
+     * asteroid are merged.
+     *
+     * @param Asteroid - Asteroid to break
+     * @param ImpactPoint - World-space impact location
+     */
+    void RequestFracture(AAsteroidActor* Asteroid, const FVector& ImpactPoint);
+
+    /**
+     * FractureAsteroid - Break An Asteroid Now
+     *
+     * Swaps the asteroid for its fragments. Fails if the asteroid has no
+     * fracture set yet, is already broken, or its fragments do not fit in
+     * MaxActiveFragments even after recycling every older fragment.
+     *
+     * @param Asteroid - Asteroid to break
+     * @param ImpactPoint - World-space impact location
+     * @return True if the asteroid was broken
+     */
+    UFUNCTION(BlueprintCallable, Category = "Asteroid Fracture")
+    bool FractureAsteroid(AAsteroidActor* Asteroid, FVector ImpactPoint);
+
+    /** @return Number of fragments in play */
+    UFUNCTION(BlueprintPure, Category = "Asteroid Fracture")
+    int32 GetNumActiveFragments() const { return ActiveFragments.Num(); }
+
+    /** @return Number of parked fragment actors */
+    UFUNCTION(BlueprintPure, Category = "Asteroid Fracture")
+    int32 GetNumPooledFragments() const { return PooledFragments.Num(); }
+
+    /** @return Breaks refused because the budget or per-frame cap was hit */
+    int32 GetNumRefused() const { return NumRefused; }
+
+    // ============================================================================
+    // SETTINGS
+    // ============================================================================
+
+    /** Allows asteroids to break */
+    UPROPERTY(Config)
+    bool bEnabled = true;
+
+    /** Most fragments in play at once, across all broken asteroids */
+    UPROPERTY(Config)
+    int32 MaxActiveFragments = 96;
+
+    /** Most queued breaks handled per frame; the rest are dropped */
+    UPROPERTY(Config)
+    int32 MaxFracturesPerFrame = 2;
+
+    /** Seconds a fragment stays in play (0 keeps it until recycled for budget) */
+    UPROPERTY(Config)
+    float FragmentLifetime = 30.0f;
+
+    /** Outward speed added to each fragment, in cm/s */
+    UPROPERTY(Config)
+    float SeparationSpeed = 150.0f;
+
+    /** Most parked fragment actors kept for reuse */
+    UPROPERTY(Config)
+    int32 MaxPooledFragments = 128;
+
+protected:
+    virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+    struct FPendingFracture
+    {
+        TWeakObjectPtr<AAsteroidActor> Asteroid;
+        FVector ImpactPoint = FVector::ZeroVector;
+    };
+
+    struct FActiveFragment
+    {
+        TWeakObjectPtr<AAsteroidFragmentActor> Actor;
+        double ExpireTime = 0.0;
+    };
+
+    /** Breaks waiting for the next tick */
+    TArray<FPendingFracture> PendingFractures;
+
+    /** Fragments in play, oldest first */
+    TArray<FActiveFragment> ActiveFragments;
+
+    /** Parked fragment actors */
+    TArray<TWeakObjectPtr<AAsteroidFragmentActor>> PooledFragments;
+
+    /** Breaks refused by the budget or the per-frame cap */
+    int32 NumRefused = 0;
+
+    /** Takes a parked fragment actor or spawns one */
+    AAsteroidFragmentActor* AcquireFragment();
+
+    /** Parks a fragment actor, or destroys it if the pool is full */
+    void ReleaseFragment(AAsteroidFragmentActor* Fragment);
+
+    /** Releases the oldest active fragments */
+    void ReleaseOldestFragments(int32 Count);
+};
@@ -0,0 +1,83 @@
+/**
+ * AsteroidFragmentActor - Asteroid Debris Piece
+ *
+ * This file defines the actor that stands in for one fragment of a broken
+ * asteroid. Fragment actors are owned and recycled by
+ * UAsteroidFractureSubsystem; nothing else should spawn or destroy them.
+ *
+ * Key Features:
+ * - Procedural mesh filled from a precomputed FAsteroidFragment
+ * - Collision from the fragment's precooked hull, mass from the fragment,
+ *   velocity from the parent asteroid
+ * - Park / reuse without destroying the actor
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/Actor.h"
+#include "AsteroidMeshComponent.h"
+#include "AsteroidFragmentActor.generated.h"
+
+struct FAsteroidFragment;
+
+/**
+ * AAsteroidFragmentActor - Pooled Fragment Actor
+ */
+UCLASS()
+class SPAAAAAACE_API AAsteroidFragmentActor : public AActor
+{
+    GENERATED_BODY()
+
+public:
+    /**
+     * Constructor
+     *
+     * Creates the procedural mesh component with convex, simulated collision.
+     */
+    AAsteroidFragmentActor();
+
+    // ============================================================================
+    // COMPONENTS
+    // ============================================================================
+
+    /** Fragment geometry, collision and physics body */
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Components")
+    UAsteroidMeshComponent* ProcMesh;
+
+    // ============================================================================
+    // FRAGMENT LIFECYCLE
+    // ============================================================================
+
+    /**
+     * ActivateFragment - Show A Fragment
+     *
+     * Uploads the fragment geometry, places the actor and starts simulating
+     * with the given mass and velocity. Collision wraps the hull cooked
+     * with the fracture set; nothing is cooked here.
+     *
+     * @param Fragment - Fragment geometry, in reference-radius units
+     * @param Transform - World transform; scale maps reference units to world
+     * @param Mass - Mass in kg
+     * @param LinearVelocity - Initial velocity in cm/s
+     * @param AngularVelocity - Initial angular velocity in rad/s
+     * @param Material - Material copied from the parent asteroid
+     */
+    void ActivateFragment(const FAsteroidFragment& Fragment, const FTransform& Transform, double Mass, const FVector& LinearVelocity, const FVector& AngularVelocity, UMaterialInterface* Material);
+
+    /**
+     * DeactivateFragment - Park The Fragment
+     *
+     * Stops physics, hides the actor and disables collision. The mesh
+     * section is kept so the next activation can reuse its buffers.
+     */
+    void DeactivateFragment();
+
+    /** @return True while the fragment is in play */
+    UFUNCTION(BlueprintCallable, Category = "Asteroid Fragment")
+    bool IsFragmentActive() const { return bActive; }
+
+private:
+    /** In play (not parked) */
+    bool bActive = false;
+};
@@ -0,0 +1,628 @@
+/**
+ * AsteroidGenerator - Thread-Safe Asteroid Geometry Pipeline
+ *
+ * This file defines the geometry half of the procedural asteroid system.
+ * Everything in here is plain data and static functions with no UObject
+ * access, so it can run on worker threads while the game thread keeps going.
+ *
+ * Key Features:
+ * - Direct geodesic sphere construction at any frequency
+ * - Multi-layer noise deformation
+ * - Vertex normal calculation
+ * - Statistics calculation (radius, volume, mass)
+ * - Cooperative cancellation between pipeline stages
+ *
+ * AAsteroidActor snapshots its settings into FAsteroidGenerationParams on the
+ * game thread, runs FAsteroidGenerator::Generate on a worker task and only
+ * hands the finished FAsteroidMeshData to its mesh component on the game thread.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include <atomic>
+#include "AsteroidGenerator.generated.h"
+
+/**
+ * FAsteroidStats - Asteroid Statistics Structure
+ *
+ * Contains calculated statistics for a generated asteroid.
+ * These values are computed during generation and stored for
+ * physics simulation and gameplay purposes.
+ */
+USTRUCT(BlueprintType)
+struct FAsteroidStats
+{
+    GENERATED_BODY()
+
+    /**
+     * Radius - Asteroid Radius
+     *
+     * The radius chosen for this asteroid in centimeters, drawn from
+     * [MinRadius, MaxRadius] with GlobalSeed and AsteroidId below.
+     */
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+    float Radius = 0.0f;
+
+    /**
+     * Volume - Asteroid Volume
+     *
+     * The calculated volume of the asteroid in cubic centimeters.
+     * This is used for mass calculations and physics simulation.
+     */
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+    double Volume = 0.0;
+
+    /**
+     * Mass - Asteroid Mass
+     *
+     * The calculated mass of the asteroid in kilograms.
+     * This is computed from volume and density for physics simulation.
+     */
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+    double Mass = 0.0;
+
+    /**
+     * NoiseLayerSeeds - Noise Layer Seeds
+     *
+     * The random seeds used for each noise layer during generation.
+     * These are stored for reproducibility - the same seeds will
+     * generate the same asteroid shape.
+     */
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+    TArray<int32> NoiseLayerSeeds;
+
+    /**
+     * GlobalSeed - Resolved Global Seed
+     *
+     * The seed actually used, also when the asteroid asked for a random
+     * one. Together with AsteroidId it reproduces the radius choice.
+     */
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+    int32 GlobalSeed = 0;
+
+    /**
+     * AsteroidId - Asteroid Identifier
+     *
+     * The identifier the radius was drawn with.
+     */
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+    int32 AsteroidId = 0;
+};
+
+/**
+ * FNoiseLayer - Noise Layer Configuration
+ *
+ * Defines a single layer of noise deformation for asteroid generation.
+ * Multiple layers can be combined to create complex, realistic asteroid shapes.
+ */
+USTRUCT(BlueprintType)
+struct FNoiseLayer
+{
+    GENERATED_BODY()
+
+    /**
+     * Scale - Noise Scale
+     *
+     * Controls the frequency/wavelength of the noise.
+     * Higher values create smaller, more detailed features.
+     * Lower values create larger, smoother features.
+     *
+     * Default: 0.1 (creates medium-scale surface features)
+     */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Noise")
+    float Scale = 0.1f;
+
+    /**
+     * Intensity - Noise Intensity
+     *
+     * Controls how much the noise affects the asteroid shape.
+     * Higher values create more dramatic surface variations.
+     * Lower values create subtle surface details.
+     *
+     * Default: 1.0 (moderate surface variation)
+     */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Noise")
+    float Intensity = 1.0f;
+
+    /**
+     * Seed - Layer-Specific Seed
+     *
+     * Random seed for this noise layer. This allows for reproducible
+     * asteroid generation while maintaining variation between layers.
+     *
+     * -1 = Use global seed + random offset
+     * Any other value = Use this specific seed
+     */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Noise")
+    int32 Seed = -1;
+};
+
+/**
+ * EAsteroidGenerationPriority - Worker Task Priority
+ *
+ * Priority of the background task that builds an asteroid's geometry.
+ * Rocks close to the player should use High so they appear first;
+ * background field filler can use Low.
+ */
+UENUM(BlueprintType)
+enum class EAsteroidGenerationPriority : uint8
+{
+    Low     UMETA(DisplayName = "Low"),
+    Normal  UMETA(DisplayName = "Normal"),
+    High    UMETA(DisplayName = "High")
+};
+
+/**
+ * EAsteroidNoiseMode - Noise Displacement Mode
+ *
+ * How each noise layer turns noise samples into radial displacement.
+ */
+UENUM(BlueprintType)
+enum class EAsteroidNoiseMode : uint8
+{
+    /** Samples a single seeded scalar field with the batched SIMD kernel and displaces along the normal */
+    ScalarField         UMETA(DisplayName = "Scalar Field (Fast)"),
+
+    /** Original behaviour: three FMath::PerlinNoise3D samples projected onto the normal */
+    LegacyVectorProject UMETA(DisplayName = "Legacy Vector Projection")
+};
+
+/**
+ * EAsteroidNormalWeighting - Vertex Normal Weighting
+ *
+ * How the faces around a vertex contribute to its normal.
+ */
+UENUM(BlueprintType)
+enum class EAsteroidNormalWeighting : uint8
+{
+    /** Every adjacent face counts the same (the original behaviour) */
+    Uniform UMETA(DisplayName = "Uniform"),
+
+    /** Larger faces count more; cheapest, since it skips normalizing face normals */
+    Area    UMETA(DisplayName = "Area Weighted"),
+
+    /** Each face counts by its corner angle at the vertex; least sensitive to tessellation */
+    Angle   UMETA(DisplayName = "Angle Weighted")
+};
+
+/**
+ * FAsteroidGenerationParams - Generation Input Snapshot
+ *
+ * Everything the geometry pipeline needs, copied out of the actor on the
+ * game thread. Seeds and the chosen radius are resolved before the snapshot
+ * is taken so the worker never touches global random state.
+ */
+struct FAsteroidGenerationParams
+{
+    /** Geodesic frequency (segments per icosahedron edge) */
+    int32 Frequency = 4;
+
+    /** Resolved global seed (recorded in the stats only; the shape comes from LayerSeeds) */
+    int32 GlobalSeed = 0;
+
+    /** Asteroid identifier the radius was drawn with (recorded in the stats only) */
+    int32 AsteroidId = 0;
+
+    /** Noise layer configuration */
+    TArray<FNoiseLayer> NoiseLayers;
+
+    /** Resolved seed for each noise layer (same length as NoiseLayers) */
+    TArray<int32> LayerSeeds;
+
+    /** How noise samples become displacement */
+    EAsteroidNoiseMode NoiseMode = EAsteroidNoiseMode::ScalarField;
+
+    /** Maximum displacement per layer, as a fraction of the unit radius */
+    float MaxDisplacementFraction = 0.5f;
+
+    /** How face normals are combined into vertex normals */
+    EAsteroidNormalWeighting NormalWeighting = EAsteroidNormalWeighting::Area;
+
+    /** Final radius in centimeters */
+    float Radius = 1.0f;
+
+    /** Material density in kg/m³ */
+    float Density = 7874.0f;
+};
+
+/**
+ * FAsteroidVertexWorkspace - Float Structure-of-Arrays Vertex Buffer
+ *
+ * Internal working format of the generation pipeline. Positions (or
+ * normals) are stored as separate single-precision X/Y/Z arrays so each
+ * pass touches half the bytes of a double-precision TArray<FVector> and
+ * the inner loops vectorize. Converted to ProcMesh format only at upload.
+ */
+struct FAsteroidVertexWorkspace
+{
+    TArray<float> X;
+    TArray<float> Y;
+    TArray<float> Z;
+
+    /** Number of vertices */
+    int32 Num() const { return X.Num(); }
+
+    /** Resizes all three arrays without initializing new entries */
+    void SetNumUninitialized(int32 Count)
+    {
+        X.SetNumUninitialized(Count);
+        Y.SetNumUninitialized(Count);
+        Z.SetNumUninitialized(Count);
+    }
+
+    /** Resizes all three arrays and zeroes every entry */
+    void SetNumZeroed(int32 Count)
+    {
+        X.Reset(); Y.Reset(); Z.Reset();
+        X.SetNumZeroed(Count);
+        Y.SetNumZeroed(Count);
+        Z.SetNumZeroed(Count);
+    }
+
+    /** Reads one vertex */
+    FVector3f Get(int32 Index) const { return FVector3f(X[Index], Y[Index], Z[Index]); }
+
+    /** Writes one vertex */
+    void Set(int32 Index, const FVector3f& V) { X[Index] = V.X; Y[Index] = V.Y; Z[Index] = V.Z; }
+
+    /** Heap bytes held by the three arrays */
+    SIZE_T GetAllocatedSize() const { return X.GetAllocatedSize() + Y.GetAllocatedSize() + Z.GetAllocatedSize(); }
+};
+
+/**
+ * FAsteroidIcosphereTopology - Shared Base Icosphere
+ *
+ * Unit-sphere vertex positions and triangle list for one geodesic frequency.
+ * Both depend only on the frequency, so a single immutable instance per
+ * frequency is built on first use and shared read-only by every asteroid.
+ */
+struct FAsteroidIcosphereTopology
+{
+    /** Geodesic frequency this topology was built for */
+    int32 Frequency = 1;
+
+    /** Normalized vertex positions on the unit sphere */
+    FAsteroidVertexWorkspace UnitPositions;
+
+    /** Triangle index list (three indices per triangle) */
+    TArray<int32> Triangles;
+
+    /**
+     * Vertex-to-corner adjacency in compressed rows: the corners (indices
+     * into Triangles) that reference vertex V are
+     * VertexCorners[VertexCornerOffsets[V] .. VertexCornerOffsets[V + 1])
+     */
+    TArray<int32> VertexCornerOffsets;
+    TArray<int32> VertexCorners;
+
+    /**
+     * Cube-map index over UnitPositions, DirectionGridSize cells per face
+     * edge: the vertices whose direction falls in cell C are
+     * DirectionCellVertices[DirectionCellOffsets[C] .. DirectionCellOffsets[C + 1])
+     */
+    int32 DirectionGridSize = 0;
+    TArray<int32> DirectionCellOffsets;
+    TArray<int32> DirectionCellVertices;
+};
+
+typedef TSharedRef<const FAsteroidIcosphereTopology, ESPMode::ThreadSafe> FAsteroidIcosphereTopologyRef;
+
+/**
+ * FAsteroidMeshData - Generation Output
+ *
+ * The finished geometry and statistics for one asteroid, ready to be
+ * handed to a procedural mesh component on the game thread.
+ */
+struct FAsteroidMeshData
+{
+    /** Vertex positions, scaled to the final radius (ProcMesh upload format) */
+    TArray<FVector> Vertices;
+
+    /** Shared base topology; its triangle list is the mesh index buffer */
+    TSharedPtr<const FAsteroidIcosphereTopology, ESPMode::ThreadSafe> Topology;
+
+    /** Per-vertex normals (ProcMesh upload format) */
+    TArray<FVector> Normals;
+
+    /** Radius, volume, mass and seeds */
+    FAsteroidStats Stats;
+
+    /** Triangle index list (three indices per triangle), shared with the topology cache */
+    const TArray<int32>& GetTriangles() const
+    {
+        static const TArray<int32> Empty;
+        return Topology.IsValid() ? Topology->Triangles : Empty;
+    }
+};
+
+/**
+ * FAsteroidGenerator - Asteroid Geometry Pipeline
+ *
+ * Static, stateless geometry functions used by AAsteroidActor.
+ * None of these touch UObjects or global random state, so they are safe
+ * to call from any thread.
+ *
+ * Generation Process:
+ * 1. Fetch cached geodesic sphere for the requested frequency
+ * 2. Apply noise layers for shape variation
+ * 3. Scale to desired size
+ * 4. Calculate normals
+ * 5. Calculate physics properties
+ */
+class SPAAAAAACE_API FAsteroidGenerator
+{
+public:
+    /**
+     * Generate - Run The Full Geometry Pipeline
+     *
+     * Builds the asteroid described by Params into OutData.
+     * The cancel flag is polled between stages; once it is set the
+     * pipeline stops early and returns false.
+     *
+     * Frequencies 2, 4 and 8 (subdivision levels 1-3) with up to
+     * MaxFixedKernelLayers scalar-field layers run a kernel specialized at
+     * compile time: vertex counts are constants, all layers are applied
+     * in one pass, and scratch lives on the stack. Its only heap
+     * allocations are OutData's arrays, and none when OutData is reused.
+     * Output is bit-identical to the generic path.
+     *
+     * @param Params - Generation input snapshot
+     * @param OutData - Output geometry and statistics
+     * @param CancelFlag - Optional flag that aborts generation when set
+     * @return True if generation finished, false if it was cancelled
+     */
+    static bool Generate(const FAsteroidGenerationParams& Params, FAsteroidMeshData& OutData, const std::atomic<bool>* CancelFlag = nullptr);
+
+    /** Most noise layers handled by the specialized Generate kernels */
+    static constexpr int32 MaxFixedKernelLayers = 3;
+
+    /**
+     * HasFixedKernel - Specialized Kernel Check
+     *
+     * @param Params - Generation input snapshot
+     * @return True if Generate runs a specialized kernel for these params
+     */
+    static bool HasFixedKernel(const FAsteroidGenerationParams& Params);
+
+    /**
+     * ResolveLayerSeeds - Derive Per-Layer Seeds
+     *
+     * Layers with an explicit Seed keep it; layers with Seed < 0 get a
+     * deterministic seed from FAsteroidRandom keyed by (GlobalSeed, layer
+     * index), independent of the other layers. Anything that needs to
+     * reproduce an asteroid's shape (fields, caches) must use this so it
+     * matches AAsteroidActor exactly.
+     *
+     * @param GlobalSeed - Resolved (non-negative) global seed
+     * @param NoiseLayers - Noise layer configuration
+     * @param OutLayerSeeds - One seed per noise layer
+     */
+    static void ResolveLayerSeeds(int32 GlobalSeed, const TArray<FNoiseLayer>& NoiseLayers, TArray<int32>& OutLayerSeeds);
+
+    // ============================================================================
+    // MESH GENERATION
+    // ============================================================================
+
+    /**
+     * GetIcosphereTopology - Get Cached Base Icosphere
+     *
+     * Returns the shared unit geodesic sphere for the given frequency,
+     * building it on first request. The returned data is immutable and
+     * may be read from any thread. Frequencies are clamped to
+     * [1, MaxFrequency].
+     *
+     * @param Frequency - Number of segments each icosahedron edge is split into
+     * @return Shared, read-only topology for that frequency
+     */
+    static FAsteroidIcosphereTopologyRef GetIcosphereTopology(int32 Frequency);
+
+    /** Highest frequency the topology cache will build (163,842 vertices) */
+    static constexpr int32 MaxFrequency = 128;
+
+    /** Vertex count of the geodesic sphere at a frequency */
+    static constexpr int32 GetVertexCount(int32 Frequency) { return 10 * Frequency * Frequency + 2; }
+
+    /** Triangle count of the geodesic sphere at a frequency */
+    static constexpr int32 GetTriangleCount(int32 Frequency) { return 20 * Frequency * Frequency; }
+
+    /**
+     * AlgorithmVersion - Generator Output Version
+     *
+     * Identifies the exact output of Generate for a given set of params.
+     * Bump it whenever a change alters generated positions or normals, so
+     * persisted geometry (FAsteroidDiskCache) is invalidated.
+     */
+    static constexpr uint32 AlgorithmVersion = 3;
+
+    /**
+     * GetFrequencyForSubdivisions - Convert Subdivision Level To Frequency
+     *
+     * Each recursive subdivision doubles the edge frequency, so level N
+     * corresponds to frequency 2^N.
+     *
+     * @param SubdivisionsLevel - Number of subdivision levels
+     * @return Equivalent geodesic frequency
+     */
+    static constexpr int32 GetFrequencyForSubdivisions(int32 SubdivisionsLevel)
+    {
+        // Level 7 is frequency 128, the largest the cache builds
+        return 1 << FMath::Clamp(SubdivisionsLevel, 0, 7);
+    }
+
+    /**
+     * BuildGeodesicSphere - Create Geodesic Sphere Mesh
+     *
+     * Builds a unit geodesic sphere in a single pass by splitting every
+     * edge of the 20 icosahedron faces into Frequency segments. Vertex
+     * indices are derived arithmetically from (face, row, column), so no
+     * edge hashing or intermediate triangle arrays are needed.
+     *
+     * Vertex layout:
+     * - [0, 12): icosahedron corners
+     * - next 30 * (F - 1): edge vertices, F - 1 per edge
+     * - next 20 * (F - 1)(F - 2) / 2: face interior vertices
+     *
+     * Produces 10F² + 2 vertices and 20F² triangles.
+     *
+     * @param Frequency - Number of segments per icosahedron edge (>= 1)
+     * @param Vertices - Output array for mesh vertices
+     * @param Triangles - Output array for mesh triangles
+     */
+    static void BuildGeodesicSphere(int32 Frequency, TArray<FVector>& Vertices, TArray<int32>& Triangles);
+
+    // ============================================================================
+    // NOISE AND DEFORMATION
+    // ============================================================================
+
+    /**
+     * ApplyNoiseLayers - Apply Noise Deformation
+     *
+     * Applies multiple layers of noise to deform the asteroid shape.
+     * Each layer adds different scales and types of surface variation.
+     * ScalarField mode evaluates one noise value per vertex with the batched
+     * FAsteroidNoise kernel; LegacyVectorProject keeps the original
+     * three-sample projection for content that depends on it.
+     *
+     * @param Positions - Mesh vertices (modified in place)
+     * @param NoiseLayers - Noise layer configuration
+     * @param LayerSeeds - Random seeds for each noise layer
+     * @param MaxDisplacementFrac - Maximum displacement limit
+     * @param NoiseMode - How noise samples become displacement
+     */
+    static void ApplyNoiseLayers(FAsteroidVertexWorkspace& Positions, const TArray<FNoiseLayer>& NoiseLayers, const TArray<int32>& LayerSeeds, float MaxDisplacementFrac, EAsteroidNoiseMode NoiseMode = EAsteroidNoiseMode::ScalarField);
+
+    // ============================================================================
+    // UTILITIES
+    // ============================================================================
+
+    /**
+     * NormalizeVertices - Normalize Vertex Positions
+     *
+     * Normalizes all vertices to unit length, creating a perfect sphere.
+     * This is done before applying noise deformation.
+     *
+     * @param Positions - Mesh vertices (modified in place)
+     */
+    static void NormalizeVertices(FAsteroidVertexWorkspace& Positions);
+
+    /**
+     * NormalizeMeanRadius - Normalize Mean Vertex Radius
+     *
+     * Uniformly scales the mesh so the average vertex distance from the
+     * center is 1. Done after noise deformation, which it preserves.
+     *
+     * @param Positions - Mesh vertices (modified in place)
+     */
+    static void NormalizeMeanRadius(FAsteroidVertexWorkspace& Positions);
+
+    /**
+     * ScaleVertices - Uniformly Scale Vertex Positions
+     *
+     * @param Positions - Mesh vertices (modified in place)
+     * @param Scale - Scale factor
+     */
+    static void ScaleVertices(FAsteroidVertexWorkspace& Positions, float Scale);
+
+    /**
+     * BuildVertexAdjacency - Vertex-To-Corner Table
+     *
+     * Fills the topology's VertexCornerOffsets / VertexCorners from its
+     * triangle list. Done once per cached frequency.
+     *
+     * @param Topology - Topology with UnitPositions and Triangles set
+     */
+    static void BuildVertexAdjacency(FAsteroidIcosphereTopology& Topology);
+
+    /**
+     * BuildDirectionIndex - Direction-To-Vertex Lookup
+     *
+     * Buckets the unit positions into a cube map so FindNearestVertex can
+     * start close to its answer. Done once per cached frequency.
+     *
+     * @param Topology - Topology with UnitPositions set
+     */
+    static void BuildDirectionIndex(FAsteroidIcosphereTopology& Topology);
+
+    /**
+     * FindNearestVertex - Vertex Closest To A Direction
+     *
+     * Scans one cube-map cell, then walks the vertex adjacency uphill until
+     * no neighbour is closer. Cost does not grow with the vertex count.
+     *
+     * @param Topology - Topology with adjacency and direction index
+     * @param Direction - Unit direction from the mesh origin
+     * @return Vertex whose unit position is closest to Direction
+     */
+    static int32 FindNearestVertex(const FAsteroidIcosphereTopology& Topology, const FVector3f& Direction);
+
+    /**
+     * ComputeNormals - Calculate Vertex Normals
+     *
+     * Two parallel passes with no shared writes: the first computes a
+     * weighted normal per triangle corner over chunks of triangles, the
+     * second gathers each vertex's corners through the topology adjacency
+     * and normalizes in the same loop.
+     *
+     * @param Positions - Mesh vertices
+     * @param Topology - Mesh triangles and vertex adjacency
+     * @param Weighting - How faces contribute to vertex normals
+     * @param OutNormals - Output per-vertex normals
+     */
+    static void ComputeNormals(const FAsteroidVertexWorkspace& Positions, const FAsteroidIcosphereTopology& Topology, EAsteroidNormalWeighting Weighting, FAsteroidVertexWorkspace& OutNormals);
+
+    /**
+     * ComputeVertexNormal - Recalculate One Vertex Normal
+     *
+     * Same weighting as ComputeNormals, for a single vertex of an edited
+     * upload-format mesh. Touches only the vertex's one-ring.
+     *
+     * @param Positions - Mesh vertices
+     * @param Topology - Mesh triangles and vertex adjacency
+     * @param Weighting - How faces contribute to vertex normals
+     * @param Vertex - Vertex to compute
+     * @return Unit normal (zero if every adjacent face is degenerate)
+     */
+    static FVector ComputeVertexNormal(TConstArrayView<FVector> Positions, const FAsteroidIcosphereTopology& Topology, EAsteroidNormalWeighting Weighting, int32 Vertex);
+
+    /**
+     * WriteProcMeshBuffers - Convert Workspace To Upload Format
+     *
+     * Expands float SoA positions and normals into the TArray<FVector>
+     * buffers UProceduralMeshComponent expects. This is the only place the
+     * pipeline produces double-precision array-of-structs data.
+     *
+     * @param Positions - Final vertex positions
+     * @param Normals - Final vertex normals
+     * @param OutVertices - Output ProcMesh vertex buffer
+     * @param OutNormals - Output ProcMesh normal buffer
+     */
+    static void WriteProcMeshBuffers(const FAsteroidVertexWorkspace& Positions, const FAsteroidVertexWorkspace& Normals, TArray<FVector>& OutVertices, TArray<FVector>& OutNormals);
+
+    // ============================================================================
+    // STATISTICS CALCULATION
+    // ============================================================================
+
+    /**
+     * CalculateStats - Calculate Asteroid Statistics
+     *
+     * Calculates the final statistics for the generated asteroid.
+     * This includes radius, volume, and mass calculations.
+     *
+     * @param ChosenRadius - The selected radius for the asteroid
+     * @param Density - Material density in kg/m³
+     * @param OutStats - Statistics to fill in
+     */
+    static void CalculateStats(float ChosenRadius, float Density, FAsteroidStats& OutStats);
+
+    /**
+     * CalculateVolumeFromRadius - Calculate Volume from Radius
+     *
+     * Calculates the volume of a sphere with the given radius.
+     * This is used for mass calculations.
+     *
+     * @param Radius - Sphere radius in centimeters
+     * @return Volume in cubic centimeters
+     */
+    static double CalculateVolumeFromRadius(double Radius);
+};
@@ -0,0 +1,235 @@
+/**
+ * AsteroidGravitySubsystem - Barnes-Hut N-Body Gravity
+ *
+ * This file defines an optional world subsystem that applies mutual
+ * gravitational attraction between asteroids and ships.
+ *
+ * Key Features:
+ * - Barnes-Hut octree rebuilt every step: O(n log n) instead of O(n^2)
+ * - Opening angle (theta) trades accuracy for speed
+ * - Octree build and force evaluation run on worker threads; the game
+ *   thread only gathers positions and applies the previous step's result
+ * - Forces applied in one batch as acceleration changes, so the result
+ *   does not depend on how each body's mass override was set up
+ * - Dormant asteroids (see UAsteroidPhysicsSubsystem) still attract and
+ *   are accelerated through their stored velocity
+ * - Softening distance and acceleration clamp keep close passes stable
+ * - All masses in kilograms: asteroid stats are converted from their
+ *   cm^3 * kg/m^3 scale, ships use their body mass
+ *
+ * Results are applied one step late: while a step is being solved the
+ * previous accelerations keep being applied. Gravity changes slowly
+ * compared to the frame rate, so the lag is not visible, and the game
+ * thread never waits on the solver.
+ *
+ * Disabled by default. Settings are read from the
+ * [/Script/SPAAAAAACE.AsteroidGravitySubsystem] section of DefaultGame.ini.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Tasks/Task.h"
+#include "AsteroidGravitySubsystem.generated.h"
+
+class AAsteroidActor;
+class UPrimitiveComponent;
+
+/**
+ * FAsteroidGravityOctree - Barnes-Hut Tree
+ *
+ * Point masses sorted into an octree whose nodes carry their total mass and
+ * centre of mass. Not tied to actors so it can be built and queried off the
+ * game thread.
+ */
+struct SPAAAAAACE_API FAsteroidGravityOctree
+{
+    struct FNode
+    {
+        FVector Center = FVector::ZeroVector;
+        double HalfSize = 0.0;
+
+        /** Centre of mass (mass-weighted sum while building) */
+        FVector MassCenter = FVector::ZeroVector;
+        double Mass = 0.0;
+
+        /** First of eight consecutive children, INDEX_NONE for a leaf */
+        int32 FirstChild = INDEX_NONE;
+
+        /** Body held by a single-body leaf, INDEX_NONE otherwise */
+        int32 Body = INDEX_NONE;
+    };
+
+    /** Deepest subdivision; bodies still sharing a cell at this depth are lumped together */
+    static constexpr int32 MaxDepth = 24;
+
+    /**
+     * Build - Sort Bodies Into The Tree
+     *
+     * @param Positions - Body positions
+     * @param Masses - Body masses, same count as Positions
+     */
+    void Build(TConstArrayView<FVector> Positions, TConstArrayView<double> Masses);
+
+    /**
+     * ComputeAcceleration - Barnes-Hut Field Evaluation
+     *
+     * @param Position - Where to evaluate
+     * @param Self - Body to skip (INDEX_NONE for none)
+     * @param Theta - Opening angle; a node is treated as a point mass when
+     *                its size / distance is below this
+     * @param GravitationalConstant - G in cm^3 / (kg s^2)
+     * @param SofteningSquared - Squared softening distance in cm^2
+     * @return Acceleration in cm/s^2
+     */
+    FVector ComputeAcceleration(const FVector& Position, int32 Self, double Theta, double GravitationalConstant, double SofteningSquared) const;
+
+    /** @return Number of nodes in the tree */
+    int32 GetNumNodes() const { return Nodes.Num(); }
+
+private:
+    TArray<FNode> Nodes;
+
+    void Insert(int32 Body, const FVector& Position, double Mass);
+
+    /** Creates the eight children of a leaf */
+    void Subdivide(int32 NodeIndex);
+
+    /** Child of an internal node whose octant contains Position */
+    int32 GetChildFor(int32 NodeIndex, const FVector& Position) const;
+};
+
+/**
+ * UAsteroidGravitySubsystem - N-Body Gravity Subsystem
+ *
+ * Gathers every asteroid and ship each step, solves gravity on a worker
+ * task and applies the result as forces.
+ */
+UCLASS(Config = Game)
+class SPAAAAAACE_API UAsteroidGravitySubsystem : public UTickableWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    // ============================================================================
+    // LIFECYCLE MANAGEMENT
+    // ============================================================================
+
+    /**
+     * Deinitialize - Subsystem Cleanup
+     *
+     * Waits for any in-flight solve and drops the results.
+     */
+    virtual void Deinitialize() override;
+
+    /**
+     * Tick - Gravity Step
+     *
+     * Picks up a finished solve, applies the newest accelerations to every
+     * body and launches the next solve.
+     *
+     * @param DeltaTime - Frame time
+     */
+    virtual void Tick(float DeltaTime) override;
+
+    virtual TStatId GetStatId() const override;
+    virtual bool IsTickable() const override { return bEnabled; }
+
+    // ============================================================================
+    // ACCESS
+    // ============================================================================
+
+    /**
+     * Get - Get Gravity Subsystem Instance
+     *
+     * @param WorldContext - Any object with world context
+     * @return Pointer to the gravity subsystem, or nullptr if not found
+     */
+    UFUNCTION(BlueprintPure, Category = "Asteroid Gravity")
+    static UAsteroidGravitySubsystem* Get(const UObject* WorldContext);
+
+    /** @return Number of bodies in the last solved step */
+    UFUNCTION(BlueprintPure, Category = "Asteroid Gravity")
+    int32 GetNumBodies() const;
+
+    /** @return Worker time of the last solved step in milliseconds */
+    UFUNCTION(BlueprintPure, Category = "Asteroid Gravity")
+    float GetLastSolveMs() const;
+
+    // ============================================================================
+    // SETTINGS
+    // ============================================================================
+
+    /** Enables mutual gravity */
+    UPROPERTY(Config)
+    bool bEnabled = false;
+
+    /** Ships attract and are attracted */
+    UPROPERTY(Config)
+    bool bAffectShips = true;
+
+    /**
+     * GravitationalConstant - G
+     *
+     * In cm^3 / (kg s^2); 6.674e-5 is the real value in these units.
+     * Every mass the solver sees is in kg, asteroids included.
+     */
+    UPROPERTY(Config)
+    float GravitationalConstant = 6.674e-5f;
+
+    /** Multiplier on GravitationalConstant for gameplay tuning */
+    UPROPERTY(Config)
+    float GravityScale = 1.0f;
+
+    /** Barnes-Hut opening angle; 0 is exact (O(n^2)), 0.5 - 1.0 is typical */
+    UPROPERTY(Config)
+    float OpeningAngle = 0.7f;
+
+    /** Softening distance in cm, removes the singularity on close passes */
+    UPROPERTY(Config)
+    float SofteningDistance = 500.0f;
+
+    /** Acceleration clamp in cm/s^2 (0 for none) */
+    UPROPERTY(Config)
+    float MaxAcceleration = 2000.0f;
+
+protected:
+    virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+    /**
+     * FStep - One Gravity Solve
+     *
+     * Inputs are captured on the game thread, Accelerations are written by
+     * the worker. Targets are only touched on the game thread.
+     */
+    struct FStep
+    {
+        TArray<FVector> Positions;
+        TArray<double> Masses;
+        TArray<FVector> Accelerations;
+
+        /** Body each entry applies to */
+        TArray<TWeakObjectPtr<UPrimitiveComponent>> Components;
+
+        /** Asteroid each entry belongs to, null for ships */
+        TArray<TWeakObjectPtr<AAsteroidActor>> Asteroids;
+
+        int32 NumNodes = 0;
+        double SolveMs = 0.0;
+    };
+
+    /** Step being solved on a worker */
+    TSharedPtr<FStep, ESPMode::ThreadSafe> PendingStep;
+    UE::Tasks::FTask PendingTask;
+
+    /** Newest solved step, applied every frame */
+    TSharedPtr<FStep, ESPMode::ThreadSafe> CurrentStep;
+
+    /** Captures bodies and starts a worker solve */
+    void LaunchStep();
+
+    /** Applies a solved step's accelerations for this frame */
+    void ApplyStep(const FStep& Step, float DeltaTime);
+};
@@ -0,0 +1,85 @@
+/**
+ * AsteroidMeshComponent - Procedural Mesh With Swappable Collision
+ *
+ * This file defines the procedural mesh component asteroids render and
+ * simulate with. It behaves exactly like UProceduralMeshComponent except
+ * that its physics body can come from a body setup supplied from outside,
+ * so cooked collision can be shared instead of cooked per component.
+ *
+ * Key Features:
+ * - Sphere proxy body that needs no cooking
+ * - Body built around a cached FAsteroidCollisionShape (one convex element
+ *   per piece) without recooking
+ * - Velocity carried across every collision swap
+ * - Falls back to the component's own convex collision when cleared
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ProceduralMeshComponent.h"
+#include "AsteroidCollisionCache.h"
+#include "AsteroidMeshComponent.generated.h"
+
+class UBodySetup;
+
+UCLASS(ClassGroup = Rendering, meta = (BlueprintSpawnableComponent))
+class SPAAAAAACE_API UAsteroidMeshComponent : public UProceduralMeshComponent
+{
+    GENERATED_BODY()
+
+public:
+    /**
+     * SetSphereCollision - Use A Sphere Proxy
+     *
+     * @param Radius - Sphere radius in component space
+     */
+    void SetSphereCollision(float Radius);
+
+    /**
+     * SetCookedCollision - Use Cached Convex Collision
+     *
+     * @param Shape - Cooked hull or pieces in component space; must not be null
+     */
+    void SetCookedCollision(const FAsteroidCollisionShapePtr& Shape);
+
+    /**
+     * ClearCollisionOverride - Use The Component's Own Collision
+     *
+     * Does not touch the physics state; call it right before
+     * SetCollisionConvexMeshes or AddCollisionConvexMesh, which rebuild it.
+     */
+    void ClearCollisionOverride();
+
+    /** @return True while the body is the sphere proxy */
+    bool IsUsingSphereCollision() const { return CollisionOverride != nullptr && CollisionOverride == SphereBodySetup; }
+
+    //~ Begin UPrimitiveComponent Interface
+    virtual UBodySetup* GetBodySetup() override;
+    //~ End UPrimitiveComponent Interface
+
+private:
+    /** Body used instead of the procedural mesh's own, or null */
+    UPROPERTY(Transient)
+    UBodySetup* CollisionOverride = nullptr;
+
+    /** Reused for every sphere proxy */
+    UPROPERTY(Transient)
+    UBodySetup* SphereBodySetup = nullptr;
+
+    /** Reused for every cooked hull; its elements are replaced per swap */
+    UPROPERTY(Transient)
+    UBodySetup* ConvexBodySetup = nullptr;
+
+    /** Keeps the cached hull alive while a body uses it */
+    FAsteroidCollisionShapePtr CookedShape;
+
+    /** Body setup with the settings UProceduralMeshComponent uses for its own */
+    UBodySetup* CreateOverrideBodySetup();
+
+    /** Drops the cached convexes the reused hull body setup still points at */
+    void ReleaseConvexElems();
+
+    /** Swaps the body setup and rebuilds the physics body, keeping its motion */
+    void ApplyCollisionOverride(UBodySetup* BodySetup);
+};
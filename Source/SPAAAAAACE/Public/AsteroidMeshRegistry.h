@@ -0,0 +1,158 @@
+/**
+ * AsteroidMeshRegistry - Shared Asteroid Geometry
+ *
+ * This file defines a process-wide registry that lets asteroids with the
+ * same shape parameters share one copy of their generated geometry.
+ *
+ * Key Features:
+ * - Content-addressed: entries are keyed by every parameter that affects shape
+ * - Geometry stored once at a reference radius; users apply radius as scale
+ * - Reference counted: an entry lives exactly as long as someone holds it
+ * - Thread-safe lookup and insertion from worker tasks
+ *
+ * Radius and density are deliberately not part of the key. Shape is
+ * independent of size, so two asteroids with the same seed but different
+ * radii still share geometry and differ only in their transform scale.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AsteroidGenerator.h"
+
+/**
+ * FAsteroidShapeKey - Shape Identity
+ *
+ * Every generation input that changes the resulting unit-radius mesh.
+ * Layer seeds are stored already resolved, so a layer with Seed = -1 and a
+ * layer with the seed it resolved to produce the same key.
+ */
+struct SPAAAAAACE_API FAsteroidShapeKey
+{
+    /** Geodesic frequency */
+    int32 Frequency = 0;
+
+    /** Noise displacement mode */
+    EAsteroidNoiseMode NoiseMode = EAsteroidNoiseMode::ScalarField;
+
+    /** Maximum displacement fraction */
+    float MaxDisplacementFraction = 0.0f;
+
+    /** Vertex normal weighting */
+    EAsteroidNormalWeighting NormalWeighting = EAsteroidNormalWeighting::Area;
+
+    /** Noise layers with Seed replaced by the resolved layer seed */
+    TArray<FNoiseLayer> Layers;
+
+    /** Precomputed hash of all fields above */
+    uint32 Hash = 0;
+
+    /**
+     * FromParams - Build Key From Generation Params
+     *
+     * @param Params - Generation params with resolved LayerSeeds
+     * @return Key describing the params' shape
+     */
+    static FAsteroidShapeKey FromParams(const FAsteroidGenerationParams& Params);
+
+    /**
+     * GetStableHash - 64-bit Persistent Hash
+     *
+     * Hash of the key's contents that is identical across runs and
+     * platforms, used to address geometry stored on disk.
+     *
+     * @return 64-bit content hash
+     */
+    uint64 GetStableHash() const;
+
+    bool operator==(const FAsteroidShapeKey& Other) const;
+
+    friend uint32 GetTypeHash(const FAsteroidShapeKey& Key) { return Key.Hash; }
+};
+
+/**
+ * FAsteroidSharedMesh - Registry Entry
+ *
+ * Immutable geometry generated at FAsteroidMeshRegistry::ReferenceRadius.
+ * MeshData.Stats describe the reference-radius mesh, not any particular
+ * asteroid; callers compute their own stats for their radius.
+ */
+struct FAsteroidSharedMesh
+{
+    /** Shape this geometry was generated for */
+    FAsteroidShapeKey Key;
+
+    /** Vertices, normals and shared topology */
+    FAsteroidMeshData MeshData;
+};
+
+typedef TSharedPtr<const FAsteroidSharedMesh, ESPMode::ThreadSafe> FAsteroidSharedMeshPtr;
+
+/**
+ * FAsteroidMeshRegistryStats - Registry Counters
+ */
+struct FAsteroidMeshRegistryStats
+{
+    /** Lookups satisfied by an existing entry */
+    int64 Hits = 0;
+
+    /** Lookups that found no live entry */
+    int64 Misses = 0;
+
+    /** Misses satisfied by FAsteroidDiskCache instead of generation */
+    int64 DiskLoads = 0;
+
+    /** Entries currently referenced by at least one user */
+    int32 LiveEntries = 0;
+
+    /** Heap bytes held by live entries' vertex and normal buffers */
+    SIZE_T LiveBytes = 0;
+};
+
+/**
+ * FAsteroidMeshRegistry - Shared Geometry Registry
+ *
+ * Static registry mapping FAsteroidShapeKey to shared geometry. The
+ * registry itself only holds weak references; the TSharedPtrs handed out
+ * are the reference count, and an entry disappears when the last
+ * asteroid using it lets go.
+ */
+class SPAAAAAACE_API FAsteroidMeshRegistry
+{
+public:
+    /** Radius shared geometry is generated at, in centimeters */
+    static constexpr float ReferenceRadius = 100.0f;
+
+    /**
+     * Find - Look Up Existing Geometry
+     *
+     * Never generates. Safe to call from any thread.
+     *
+     * @param Key - Shape to look up
+     * @return Shared geometry, or null if nobody currently holds this shape
+     */
+    static FAsteroidSharedMeshPtr Find(const FAsteroidShapeKey& Key);
+
+    /**
+     * FindOrGenerate - Look Up Or Build Geometry
+     *
+     * Returns the live entry for Params' shape. If there is none, the
+     * shape is loaded from FAsteroidDiskCache or, failing that, generated
+     * at ReferenceRadius. Params.Radius and Params.Density
+     * are ignored. If two threads miss on the same shape at once, both
+     * generate but only the first result is kept and returned to both.
+     * Intended for worker threads.
+     *
+     * @param Params - Generation params with resolved LayerSeeds
+     * @param CancelFlag - Optional flag that aborts generation when set
+     * @return Shared geometry, or null if generation was cancelled
+     */
+    static FAsteroidSharedMeshPtr FindOrGenerate(const FAsteroidGenerationParams& Params, const std::atomic<bool>* CancelFlag = nullptr);
+
+    /**
+     * GetStats - Read Registry Counters
+     *
+     * @return Hit/miss counters and live entry totals
+     */
+    static FAsteroidMeshRegistryStats GetStats();
+};
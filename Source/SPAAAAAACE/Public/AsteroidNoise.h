@@ -0,0 +1,72 @@
+/**
+ * AsteroidNoise - Batched Gradient Noise For Asteroid Displacement
+ *
+ * This file defines the noise kernel used to displace asteroid vertices.
+ * It evaluates 3D gradient (Perlin-style) noise for many points at once,
+ * using the widest vector unit available on the target platform.
+ *
+ * Key Features:
+ * - Seeded, hash-based gradient noise (no shared permutation table)
+ * - AVX2 path evaluating 8 points per iteration
+ * - SSE / NEON path evaluating 4 points per iteration (via VectorRegister4)
+ * - Scalar reference path for tails and platforms without SIMD
+ * - Bit-for-bit identical results across all paths for a given seed
+ *
+ * Every path performs the same float operations in the same order with no
+ * fused multiply-add, so the shape of an asteroid does not depend on which
+ * CPU generated it or how the vertex count splits into batches.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * FAsteroidNoise - Gradient Noise Kernel
+ *
+ * Static, thread-safe noise sampling functions used by the asteroid
+ * generation pipeline. Output is roughly in the range [-1, 1].
+ */
+class SPAAAAAACE_API FAsteroidNoise
+{
+public:
+    /**
+     * Sample - Evaluate Noise At One Point
+     *
+     * Scalar reference implementation. All batched paths match it exactly.
+     *
+     * @param X - Sample X coordinate (already scaled and offset)
+     * @param Y - Sample Y coordinate
+     * @param Z - Sample Z coordinate
+     * @param Seed - Noise seed
+     * @return Noise value, roughly in [-1, 1]
+     */
+    static float Sample(float X, float Y, float Z, uint32 Seed);
+
+    /**
+     * SampleBatch - Evaluate Noise For Many Points
+     *
+     * Samples noise at (P * Scale + Offset) for Count points stored as
+     * separate X/Y/Z arrays, writing one value per point into OutNoise.
+     * Uses AVX2 when the build targets it, then 4-wide SIMD, then scalar
+     * for the remainder.
+     *
+     * @param X - Point X coordinates
+     * @param Y - Point Y coordinates
+     * @param Z - Point Z coordinates
+     * @param Count - Number of points
+     * @param Scale - Frequency multiplier applied to every point
+     * @param Offset - Offset added after scaling
+     * @param Seed - Noise seed
+     * @param OutNoise - Output noise values (Count entries)
+     */
+    static void SampleBatch(const float* X, const float* Y, const float* Z, int32 Count, float Scale, const FVector3f& Offset, uint32 Seed, float* OutNoise);
+
+    /**
+     * SampleBatchScalar - Evaluate Noise For Many Points Without SIMD
+     *
+     * Same contract as SampleBatch but always uses the scalar path.
+     * Used by the benchmark to verify the SIMD paths.
+     */
+    static void SampleBatchScalar(const float* X, const float* Y, const float* Z, int32 Count, float Scale, const FVector3f& Offset, uint32 Seed, float* OutNoise);
+};
@@ -0,0 +1,356 @@
+/**
+ * AsteroidPhysicsSubsystem - Proximity Physics Management
+ *
+ * This file defines a world subsystem that keeps only the asteroids near a
+ * ship simulating in the physics solver. Everything farther away is made
+ * kinematic and drifted along its last velocity by the subsystem.
+ *
+ * Key Features:
+ * - Asteroids beyond SleepRadius of every ship become dormant (kinematic)
+ * - Dormant asteroids keep their linear and angular velocity and keep
+ *   drifting, so nothing visibly stops or pops
+ * - Dormant drift is integrated from the point the asteroid went to sleep,
+ *   so its position is exact whenever it is read; the actors themselves
+ *   are moved in bounded round-robin batches, so per-frame cost does not
+ *   grow with the number of dormant asteroids
+ * - Asteroids wake when a ship is within WakeRadius, or will be within
+ *   WakeLookAheadSeconds at the current closing speed
+ * - Separate wake and sleep radii (hysteresis) to avoid thrashing
+ * - Waking restores the stored momentum on the rigid body
+ * - Collision detail by distance: a sphere far away, a reduced hull at mid
+ *   range and the full hull up close, with padded downgrade distances
+ *
+ * In zero gravity a drifting rigid body never goes to sleep on its own, so
+ * without this every physics asteroid in the level is an active body and
+ * solver cost grows with the total asteroid count. With it, solver cost
+ * grows with the number of asteroids near a ship.
+ *
+ * AAsteroidActor registers itself when its physics body is enabled and
+ * unregisters when it is pooled or leaves play. Settings are read from the
+ * [/Script/SPAAAAAACE.AsteroidPhysicsSubsystem] section of DefaultGame.ini.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+#include "AsteroidPhysicsSubsystem.generated.h"
+
+class AAsteroidActor;
+enum class EAsteroidCollisionLOD : uint8;
+
+/**
+ * FAsteroidPhysicsBody - Managed Asteroid
+ *
+ * Velocities are only meaningful while the body is dormant; an awake body
+ * reads them from the solver.
+ */
+struct FAsteroidPhysicsBody
+{
+    TWeakObjectPtr<AAsteroidActor> Actor;
+
+    /** Map key, still usable once Actor has gone stale */
+    TObjectKey<AAsteroidActor> Key;
+
+    /** Stored linear velocity in cm/s */
+    FVector LinearVelocity = FVector::ZeroVector;
+
+    /** Stored angular velocity in rad/s */
+    FVector AngularVelocity = FVector::ZeroVector;
+
+    /** Dormant: location at DormantTime, which drift is integrated from */
+    FVector DormantLocation = FVector::ZeroVector;
+
+    /** Dormant: rotation at DormantTime */
+    FQuat DormantRotation = FQuat::Identity;
+
+    /** Dormant: world time the anchor above was taken */
+    double DormantTime = 0.0;
+
+    /** Bounding radius used to pad the wake and sleep distances */
+    float Radius = 0.0f;
+
+    /** True while simulating in the solver */
+    bool bAwake = true;
+};
+
+/**
+ * UAsteroidPhysicsSubsystem - Asteroid Physics Sleep Manager
+ *
+ * Ticks every frame: a bounded batch of dormant asteroid actors is moved
+ * to where their drift has taken them, and every UpdateInterval seconds
+ * each asteroid's distance to the ships is checked to decide whether it
+ * should be awake.
+ */
+UCLASS(Config = Game)
+class SPAAAAAACE_API UAsteroidPhysicsSubsystem : public UTickableWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    // ============================================================================
+    // LIFECYCLE MANAGEMENT
+    // ============================================================================
+
+    /**
+     * Deinitialize - Subsystem Cleanup
+     *
+     * Forgets all managed asteroids; the world destroys them.
+     */
+    virtual void Deinitialize() override;
+
+    /**
+     * Tick - Drift And Proximity Update
+     *
+     * Moves up to MaxDormantMovesPerTick dormant asteroids along their
+     * stored velocities and, when UpdateInterval has elapsed, wakes and
+     * sleeps asteroids by ship proximity.
+     *
+     * @param DeltaTime - Frame time
+     */
+    virtual void Tick(float DeltaTime) override;
+
+    virtual TStatId GetStatId() const override;
+    virtual bool IsTickable() const override { return bEnabled && Bodies.Num() > 0; }
+
+    // ============================================================================
+    // ACCESS AND REGISTRATION
+    // ============================================================================
+
+    /**
+     * Get - Get Physics Subsystem Instance
+     *
+     * @param WorldContext - Any object with world context
+     * @return Pointer to the physics subsystem, or nullptr if not found
+     */
+    UFUNCTION(BlueprintPure, Category = "Asteroid Physics")
+    static UAsteroidPhysicsSubsystem* Get(const UObject* WorldContext);
+
+    /**
+     * RegisterAsteroid - Start Managing An Asteroid
+     *
+     * Called once the asteroid is simulating. A far asteroid is made dormant
+     * straight away. Registering an asteroid that is already managed wakes
+     * it with its stored momentum first.
+     *
+     * @param Asteroid - Simulating asteroid
+     */
+    void RegisterAsteroid(AAsteroidActor* Asteroid);
+
+    /**
+     * UnregisterAsteroid - Stop Managing An Asteroid
+     *
+     * The asteroid is left in whatever physics state it is in.
+     *
+     * @param Asteroid - Asteroid to forget
+     */
+    void UnregisterAsteroid(AAsteroidActor* Asteroid);
+
+    /**
+     * WakeAsteroid - Force An Asteroid Awake
+     *
+     * Resumes simulation with the stored momentum. The asteroid may go
+     * dormant again on the next proximity update if no ship is near.
+     *
+     * @param Asteroid - Managed asteroid
+     */
+    UFUNCTION(BlueprintCallable, Category = "Asteroid Physics")
+    void WakeAsteroid(AAsteroidActor* Asteroid);
+
+    /** @return True if the asteroid is managed and currently kinematic */
+    UFUNCTION(BlueprintPure, Category = "Asteroid Physics")
+    bool IsAsteroidDormant(const AAsteroidActor* Asteroid) const;
+
+    /**
+     * GetAsteroidVelocity - Velocity Regardless Of State
+     *
+     * @param Asteroid - Asteroid to query
+     * @param OutLinear - Linear velocity in cm/s
+     * @param OutAngular - Angular velocity in rad/s
+     * @return False if the asteroid is invalid
+     */
+    bool GetAsteroidVelocity(const AAsteroidActor* Asteroid, FVector& OutLinear, FVector& OutAngular) const;
+
+    /**
+     * GetAsteroidLocation - Location Regardless Of State
+     *
+     * A dormant asteroid's actor is only moved every so often; this is
+     * where its drift has actually taken it.
+     *
+     * @param Asteroid - Asteroid to query
+     * @return World location (zero if the asteroid is invalid)
+     */
+    FVector GetAsteroidLocation(const AAsteroidActor* Asteroid) const;
+
+    /**
+     * AddDormantVelocity - Accelerate A Dormant Asteroid
+     *
+     * Lets external forces (e.g. gravity) act on an asteroid that is not in
+     * the solver. The change is kept when the asteroid wakes.
+     *
+     * @param Asteroid - Managed asteroid
+     * @param DeltaVelocity - Linear velocity change in cm/s
+     * @return False if the asteroid is not managed or is awake
+     */
+    bool AddDormantVelocity(const AAsteroidActor* Asteroid, const FVector& DeltaVelocity);
+
+    /** @return Number of managed asteroids simulating in the solver */
+    UFUNCTION(BlueprintPure, Category = "Asteroid Physics")
+    int32 GetNumAwake() const { return NumAwake; }
+
+    /** @return Number of managed asteroids that are dormant */
+    UFUNCTION(BlueprintPure, Category = "Asteroid Physics")
+    int32 GetNumDormant() const { return Bodies.Num() - NumAwake; }
+
+    /**
+     * GetInitialCollisionLOD - Collision Tier For A New Mesh
+     *
+     * Lets an asteroid start at the tier its distance calls for, so one
+     * streamed in far away never cooks a hull.
+     *
+     * @param Asteroid - Asteroid about to request collision
+     * @return Tier for its current distance; Full if collision LOD is off or there is no ship
+     */
+    EAsteroidCollisionLOD GetInitialCollisionLOD(const AAsteroidActor* Asteroid);
+
+    /** @return Number of managed asteroids at the given collision tier as of the last proximity update */
+    int32 GetNumAtCollisionLOD(EAsteroidCollisionLOD LOD) const;
+
+    // ============================================================================
+    // SETTINGS
+    // ============================================================================
+
+    /** Disable to leave every asteroid simulating */
+    UPROPERTY(Config)
+    bool bEnabled = true;
+
+    /** Asteroids whose surface is within this distance of a ship wake (cm) */
+    UPROPERTY(Config)
+    float WakeRadius = 20000.0f;
+
+    /** Asteroids whose surface is farther than this from every ship sleep (cm); kept above WakeRadius */
+    UPROPERTY(Config)
+    float SleepRadius = 30000.0f;
+
+    /**
+     * WakeLookAheadSeconds - Early Wake
+     *
+     * A ship closing on an asteroid wakes it this many seconds before it
+     * would reach WakeRadius, so fast ships never meet a dormant asteroid.
+     */
+    UPROPERTY(Config)
+    float WakeLookAheadSeconds = 2.0f;
+
+    /** Seconds between proximity updates */
+    UPROPERTY(Config)
+    float UpdateInterval = 0.25f;
+
+    /** Maximum asteroids put to sleep per proximity update; waking is never limited */
+    UPROPERTY(Config)
+    int32 MaxSleepsPerUpdate = 32;
+
+    /**
+     * MaxDormantMovesPerTick - Dormant Actor Batch
+     *
+     * Managed asteroids visited per frame to move dormant actors to their
+     * drifted position. Each is moved at most once per UpdateInterval.
+     */
+    UPROPERTY(Config)
+    int32 MaxDormantMovesPerTick = 64;
+
+    /** Disable to keep every asteroid on its full collision hull */
+    UPROPERTY(Config)
+    bool bCollisionLOD = true;
+
+    /** Asteroids whose surface is within this distance of a ship use the full hull (cm) */
+    UPROPERTY(Config)
+    float FullCollisionRadius = 8000.0f;
+
+    /** Asteroids within this distance use the reduced hull, farther ones a sphere (cm); kept above FullCollisionRadius */
+    UPROPERTY(Config)
+    float ReducedCollisionRadius = 20000.0f;
+
+    /**
+     * CollisionLODHysteresis - Downgrade Padding
+     *
+     * An asteroid only drops a collision tier once it is this fraction
+     * beyond the tier's radius, so one drifting along a boundary does not
+     * swap bodies every update.
+     */
+    UPROPERTY(Config)
+    float CollisionLODHysteresis = 0.25f;
+
+    /** Maximum collision tier downgrades per proximity update; upgrades are never limited */
+    UPROPERTY(Config)
+    int32 MaxCollisionDowngradesPerUpdate = 32;
+
+protected:
+    virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+    /** Managed asteroids */
+    TArray<FAsteroidPhysicsBody> Bodies;
+
+    /** Index into Bodies per asteroid */
+    TMap<TObjectKey<AAsteroidActor>, int32> BodyIndices;
+
+    /** Number of awake entries of Bodies */
+    int32 NumAwake = 0;
+
+    /** Managed asteroids per collision tier, counted by the last proximity update */
+    int32 CollisionLODCounts[3] = { 0, 0, 0 };
+
+    /** Next entry of Bodies the dormant move batch visits */
+    int32 DormantMoveCursor = 0;
+
+    /** Time until the next proximity update */
+    float TimeUntilUpdate = 0.0f;
+
+    /** Ship location and velocity, refreshed per proximity update */
+    struct FShipSample
+    {
+        FVector Location;
+        FVector Velocity;
+    };
+    TArray<FShipSample> Ships;
+
+    /** Refreshes Ships; false if there is no ship */
+    bool GatherShips();
+
+    /** Wake and sleep pass over every managed asteroid */
+    void UpdateProximity();
+
+    /**
+     * Shortest predicted distance from the asteroid's surface to a ship,
+     * allowing for closing speed over Horizon seconds
+     */
+    float GetPredictedShipDistance(const FAsteroidPhysicsBody& Body, const FVector& Location, float Horizon) const;
+
+    /**
+     * Collision tier for a predicted ship distance. Upgrades happen at the
+     * tier radii, downgrades only past them plus CollisionLODHysteresis.
+     */
+    EAsteroidCollisionLOD GetCollisionLODForDistance(float Distance, EAsteroidCollisionLOD Current) const;
+
+    /** Stores the body's momentum and makes it kinematic */
+    void SleepBody(FAsteroidPhysicsBody& Body);
+
+    /** Makes the body simulate again with its stored momentum */
+    void WakeBody(FAsteroidPhysicsBody& Body);
+
+    /** Where a dormant body's drift has taken it by Now */
+    void GetDormantTransform(const FAsteroidPhysicsBody& Body, double Now, FVector& OutLocation, FQuat& OutRotation) const;
+
+    /** Restarts a dormant body's drift from where it is at Now, without moving the actor */
+    void ReanchorBody(FAsteroidPhysicsBody& Body, double Now);
+
+    /** Moves a dormant body's actor to where its drift has taken it */
+    void MoveDormantActor(FAsteroidPhysicsBody& Body, double Now);
+
+    /** @return Current world time */
+    double GetNow() const;
+
+    /** Swap-removes an entry of Bodies */
+    void RemoveBodyAt(int32 Index);
+};
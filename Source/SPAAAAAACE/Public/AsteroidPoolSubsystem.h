@@ -0,0 +1,187 @@
+/**
+ * AsteroidPoolSubsystem - Asteroid Actor Pooling
+ *
+ * This file defines a world subsystem that recycles AAsteroidActors
+ * instead of destroying and respawning them.
+ *
+ * Key Features:
+ * - Released asteroids are parked (hidden, no collision, no physics)
+ * - Acquired asteroids are reset to their class defaults, configured by
+ *   the caller and regenerated, reusing their mesh section and body instance
+ * - Warm-up at level start so the first wave of streaming does not spawn
+ * - Hit / miss / eviction counters
+ *
+ * Spawners (the streaming subsystem, asteroid fields) go through
+ * AcquireAsteroid / ReleaseAsteroid rather than SpawnActor / Destroy.
+ * Settings are read from the [/Script/SPAAAAAACE.AsteroidPoolSubsystem]
+ * section of DefaultGame.ini.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+#include "AsteroidPoolSubsystem.generated.h"
+
+class AAsteroidActor;
+
+/**
+ * FAsteroidPoolStats - Pool Counters
+ */
+USTRUCT(BlueprintType)
+struct FAsteroidPoolStats
+{
+    GENERATED_BODY()
+
+    /** Acquisitions served from the pool */
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+    int32 Hits = 0;
+
+    /** Acquisitions that had to spawn a new actor */
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+    int32 Misses = 0;
+
+    /** Releases that found the pool full and destroyed the actor */
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+    int32 Evictions = 0;
+
+    /** Actors currently parked */
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+    int32 Pooled = 0;
+
+    /** Actors acquired and not yet released */
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+    int32 Active = 0;
+};
+
+/**
+ * UAsteroidPoolSubsystem - Asteroid Actor Pool
+ *
+ * Keeps one list of parked actors per asteroid class. The total number of
+ * parked actors is capped by MaxPoolSize.
+ */
+UCLASS(Config = Game)
+class SPAAAAAACE_API UAsteroidPoolSubsystem : public UWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    // ============================================================================
+    // LIFECYCLE MANAGEMENT
+    // ============================================================================
+
+    /**
+     * OnWorldBeginPlay - Warm-Up
+     *
+     * Pre-spawns WarmUpCount parked asteroids of WarmUpClass.
+     *
+     * @param InWorld - World that began play
+     */
+    virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+
+    /**
+     * Deinitialize - Subsystem Cleanup
+     *
+     * Forgets parked actors; the world destroys them.
+     */
+    virtual void Deinitialize() override;
+
+    // ============================================================================
+    // ACCESS AND POOLING
+    // ============================================================================
+
+    /**
+     * Get - Get Pool Subsystem Instance
+     *
+     * @param WorldContext - Any object with world context
+     * @return Pointer to the pool subsystem, or nullptr if not found
+     */
+    UFUNCTION(BlueprintPure, Category = "Asteroid Pool")
+    static UAsteroidPoolSubsystem* Get(const UObject* WorldContext);
+
+    /**
+     * AcquireAsteroid - Get A Ready-To-Generate Asteroid
+     *
+     * Takes a parked actor of Class (or spawns one), resets its generation
+     * settings to the class defaults, lets Configure adjust them, then
+     * places it at Transform and starts generation.
+     *
+     * @param Class - Asteroid class (AAsteroidActor if null)
+     * @param Transform - World transform
+     * @param Configure - Called before generation to set seed, radius, etc.
+     * @param Owner - Optional owner of the asteroid
+     * @return The asteroid, or nullptr if spawning failed
+     */
+    AAsteroidActor* AcquireAsteroid(UClass* Class, const FTransform& Transform, TFunctionRef<void(AAsteroidActor&)> Configure, AActor* Owner = nullptr);
+
+    /**
+     * AcquireAsteroidWithSeed - Blueprint Acquire
+     *
+     * @param Class - Asteroid class (AAsteroidActor if null)
+     * @param Transform - World transform
+     * @param Seed - Global seed
+     * @param Radius - Radius in centimeters
+     * @return The asteroid, or nullptr if spawning failed
+     */
+    UFUNCTION(BlueprintCallable, Category = "Asteroid Pool")
+    AAsteroidActor* AcquireAsteroidWithSeed(TSubclassOf<AAsteroidActor> Class, const FTransform& Transform, int32 Seed, float Radius);
+
+    /**
+     * ReleaseAsteroid - Return An Asteroid
+     *
+     * Parks the asteroid if there is room, otherwise destroys it.
+     *
+     * @param Asteroid - Asteroid to release
+     */
+    UFUNCTION(BlueprintCallable, Category = "Asteroid Pool")
+    void ReleaseAsteroid(AAsteroidActor* Asteroid);
+
+    /**
+     * WarmUp - Pre-Spawn Parked Asteroids
+     *
+     * Spawns parked asteroids of Class until the pool holds Count of them
+     * (or MaxPoolSize is reached). Warm-up actors do not generate a mesh.
+     *
+     * @param Class - Asteroid class (AAsteroidActor if null)
+     * @param Count - Desired number of parked actors of that class
+     */
+    UFUNCTION(BlueprintCallable, Category = "Asteroid Pool")
+    void WarmUp(TSubclassOf<AAsteroidActor> Class, int32 Count);
+
+    /** @return Pool counters */
+    UFUNCTION(BlueprintPure, Category = "Asteroid Pool")
+    FAsteroidPoolStats GetPoolStats() const { return Stats; }
+
+    // ============================================================================
+    // SETTINGS
+    // ============================================================================
+
+    /** Maximum number of parked actors across all classes (0 disables pooling) */
+    UPROPERTY(Config)
+    int32 MaxPoolSize = 256;
+
+    /** Parked actors spawned at level start */
+    UPROPERTY(Config)
+    int32 WarmUpCount = 0;
+
+    /** Class spawned by the level-start warm-up (AAsteroidActor if unset) */
+    UPROPERTY(Config)
+    TSoftClassPtr<AAsteroidActor> WarmUpClass;
+
+protected:
+    virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+    /** Parked actors per class */
+    TMap<TObjectKey<UClass>, TArray<TWeakObjectPtr<AAsteroidActor>>> Pool;
+
+    /** Counters */
+    FAsteroidPoolStats Stats;
+
+    /** Spawns a parked actor without generating it */
+    AAsteroidActor* SpawnParked(UClass* Class);
+
+    /** Pops a still-valid parked actor of Class, if any */
+    AAsteroidActor* PopParked(UClass* Class);
+};
@@ -0,0 +1,133 @@
+/**
+ * AsteroidRandom - Counter-Based Random Numbers For Asteroid Generation
+ *
+ * This file defines the stateless random number source used by asteroid
+ * generation. Every value is a pure function of a key and a counter, so
+ * there is no stream to share, lock or advance in order.
+ *
+ * Key Features:
+ * - SplitMix64 mixing of (GlobalSeed, AsteroidId, Layer, Purpose, Counter)
+ * - Identical results on any thread, in any order, on any platform
+ * - Separate purposes keep unrelated draws (layer seeds, noise offsets,
+ *   radius) independent even when they share a seed
+ * - Thread-safe source of fresh global seeds for unseeded asteroids
+ *
+ * Changing the mixing below changes every generated asteroid; bump
+ * FAsteroidGenerator::AlgorithmVersion if you do.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * EAsteroidRandomPurpose - What A Random Value Is For
+ *
+ * Part of the key, so each use draws from its own sequence. Append new
+ * values at the end; reordering changes existing asteroids.
+ */
+enum class EAsteroidRandomPurpose : uint8
+{
+    GlobalSeed,
+    LayerSeed,
+    NoiseOffset,
+    Radius
+};
+
+/**
+ * FAsteroidRandomKey - Random Value Key
+ *
+ * Identifies one sequence of random values. Layer is the noise layer
+ * index for per-layer draws and 0 otherwise.
+ */
+struct FAsteroidRandomKey
+{
+    int32 GlobalSeed = 0;
+    int32 AsteroidId = 0;
+    int32 Layer = 0;
+    EAsteroidRandomPurpose Purpose = EAsteroidRandomPurpose::GlobalSeed;
+
+    constexpr FAsteroidRandomKey(int32 InGlobalSeed, int32 InAsteroidId, int32 InLayer, EAsteroidRandomPurpose InPurpose)
+        : GlobalSeed(InGlobalSeed), AsteroidId(InAsteroidId), Layer(InLayer), Purpose(InPurpose)
+    {
+    }
+};
+
+/**
+ * FAsteroidRandom - Stateless Random Source
+ *
+ * Counter-based generator in the style of SplitMix64: the key is hashed
+ * into a stream, and value N of the stream is the mix of the stream plus
+ * N golden-ratio steps. Thread-safe by construction.
+ */
+class SPAAAAAACE_API FAsteroidRandom
+{
+public:
+    /**
+     * Bits - Raw 64-bit Value
+     *
+     * @param Key - Sequence to draw from
+     * @param Counter - Index of the value within the sequence
+     * @return Uniformly distributed 64-bit value
+     */
+    static constexpr uint64 Bits(const FAsteroidRandomKey& Key, uint32 Counter = 0)
+    {
+        const uint64 SeedAndId = ((uint64)(uint32)Key.GlobalSeed << 32) | (uint32)Key.AsteroidId;
+        const uint64 LayerAndPurpose = ((uint64)(uint32)Key.Layer << 8) | (uint8)Key.Purpose;
+        const uint64 Stream = Mix(Mix(SeedAndId + Gamma) ^ (LayerAndPurpose * Gamma));
+        return Mix(Stream + ((uint64)Counter + 1) * Gamma);
+    }
+
+    /**
+     * Unit - Float In [0, 1)
+     *
+     * Uses the top 24 bits, so every value is exactly representable.
+     */
+    static constexpr float Unit(const FAsteroidRandomKey& Key, uint32 Counter = 0)
+    {
+        return (float)(Bits(Key, Counter) >> 40) * (1.0f / 16777216.0f);
+    }
+
+    /**
+     * Range - Float In [Min, Max)
+     *
+     * Same mapping as FMath::RandRange, so Min > Max is allowed.
+     */
+    static constexpr float Range(const FAsteroidRandomKey& Key, float Min, float Max, uint32 Counter = 0)
+    {
+        return Min + (Max - Min) * Unit(Key, Counter);
+    }
+
+    /**
+     * Seed - Non-Negative Seed
+     *
+     * @return Value in [0, MAX_int32], usable wherever a resolved seed is expected
+     */
+    static constexpr int32 Seed(const FAsteroidRandomKey& Key, uint32 Counter = 0)
+    {
+        return (int32)(Bits(Key, Counter) >> 33);
+    }
+
+    /**
+     * MakeGlobalSeed - Fresh Seed For An Unseeded Asteroid
+     *
+     * Replaces FMath::Rand for GlobalSeed = -1. Safe to call from any
+     * thread; successive calls return different seeds, and runs differ
+     * from one another.
+     *
+     * @return Value in [0, MAX_int32]
+     */
+    static int32 MakeGlobalSeed();
+
+private:
+    /** 2^64 / golden ratio */
+    static constexpr uint64 Gamma = 0x9E3779B97F4A7C15ull;
+
+    /** SplitMix64 finalizer */
+    static constexpr uint64 Mix(uint64 Z)
+    {
+        Z = (Z ^ (Z >> 30)) * 0xBF58476D1CE4E5B9ull;
+        Z = (Z ^ (Z >> 27)) * 0x94D049BB133111EBull;
+        return Z ^ (Z >> 31);
+    }
+};
@@ -0,0 +1,154 @@
+/**
+ * AsteroidScratch - Per-Thread Scratch Arena
+ *
+ * This file defines the linear arena the asteroid pipeline uses for memory
+ * that only lives for one call: noise workspaces, corner normals, fracture
+ * bucketing and similar temporaries.
+ *
+ * Key Features:
+ * - One arena per thread, so allocation takes no locks
+ * - Bump allocation, released in bulk by FAsteroidScratchMark
+ * - Memory is kept between calls; overflow blocks are merged into one
+ *   block once the arena is fully released, so in steady state generation
+ *   does not touch the general heap
+ * - Process-wide counters for scratch allocations and the heap blocks
+ *   behind them (Asteroid.ScratchStats)
+ *
+ * Only trivially destructible types belong in scratch: nothing is destroyed
+ * when a mark is released.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * FAsteroidScratchStats - Scratch Counters
+ *
+ * Totals across all threads since startup.
+ */
+struct FAsteroidScratchStats
+{
+    /** Allocations served from scratch */
+    int64 Allocations = 0;
+
+    /** Bytes served from scratch */
+    int64 AllocatedBytes = 0;
+
+    /** Heap blocks the arenas had to allocate to serve them */
+    int64 BlockAllocations = 0;
+
+    /** Bytes currently held by all arenas */
+    int64 ReservedBytes = 0;
+};
+
+/**
+ * FAsteroidScratch - Per-Thread Linear Arena
+ *
+ * Every allocation must happen inside an FAsteroidScratchMark on the same
+ * thread, and must not outlive it. Memory may be handed to ParallelFor
+ * workers while the owning thread waits on them.
+ */
+class SPAAAAAACE_API FAsteroidScratch
+{
+public:
+    FAsteroidScratch() = default;
+    ~FAsteroidScratch();
+
+    FAsteroidScratch(const FAsteroidScratch&) = delete;
+    FAsteroidScratch& operator=(const FAsteroidScratch&) = delete;
+
+    /** @return The calling thread's arena */
+    static FAsteroidScratch& Get();
+
+    /**
+     * Alloc - Allocate Raw Scratch
+     *
+     * @param Size - Bytes
+     * @param Alignment - Power-of-two alignment
+     * @return Uninitialized memory, valid until the enclosing mark is released
+     */
+    void* Alloc(SIZE_T Size, SIZE_T Alignment = 16);
+
+    /**
+     * AllocArray - Allocate An Uninitialized Array
+     *
+     * @param Count - Number of elements
+     * @return View over Count uninitialized elements
+     */
+    template <typename ElementType>
+    TArrayView<ElementType> AllocArray(int32 Count)
+    {
+        static_assert(TIsTriviallyDestructible<ElementType>::Value, "Scratch memory is never destructed");
+        return TArrayView<ElementType>((ElementType*)Alloc(sizeof(ElementType) * FMath::Max(Count, 0), FMath::Max<SIZE_T>(alignof(ElementType), 16)), FMath::Max(Count, 0));
+    }
+
+    /**
+     * AllocArray - Allocate A Filled Array
+     *
+     * @param Count - Number of elements
+     * @param Value - Value every element starts with
+     * @return View over Count elements set to Value
+     */
+    template <typename ElementType>
+    TArrayView<ElementType> AllocArray(int32 Count, const ElementType& Value)
+    {
+        TArrayView<ElementType> Result = AllocArray<ElementType>(Count);
+        for (ElementType& Element : Result)
+        {
+            Element = Value;
+        }
+        return Result;
+    }
+
+    /** @return Counters summed over all threads */
+    static FAsteroidScratchStats GetStats();
+
+    /** Largest block an arena keeps once released; anything bigger goes back to the heap */
+    static constexpr SIZE_T MaxRetainedBytes = 32 * 1024 * 1024;
+
+private:
+    friend class FAsteroidScratchMark;
+
+    struct FBlock
+    {
+        uint8* Data = nullptr;
+        SIZE_T Size = 0;
+    };
+
+    /** Blocks in allocation order; usually exactly one */
+    TArray<FBlock, TInlineAllocator<8>> Blocks;
+
+    /** Block currently being bumped, and the offset into it */
+    int32 BlockIndex = 0;
+    SIZE_T BlockOffset = 0;
+
+    /** Marks currently open */
+    int32 MarkDepth = 0;
+
+    /** Rolls back to a mark; merges or frees blocks when the last mark closes */
+    void Release(int32 InBlockIndex, SIZE_T InBlockOffset);
+
+    void FreeBlocks();
+};
+
+/**
+ * FAsteroidScratchMark - Scoped Scratch Release
+ *
+ * Everything allocated from the arena after the mark was taken is released
+ * when it goes out of scope. Marks nest.
+ */
+class SPAAAAAACE_API FAsteroidScratchMark
+{
+public:
+    explicit FAsteroidScratchMark(FAsteroidScratch& InScratch = FAsteroidScratch::Get());
+    ~FAsteroidScratchMark();
+
+    FAsteroidScratchMark(const FAsteroidScratchMark&) = delete;
+    FAsteroidScratchMark& operator=(const FAsteroidScratchMark&) = delete;
+
+private:
+    FAsteroidScratch& Scratch;
+    int32 BlockIndex;
+    SIZE_T BlockOffset;
+};
@@ -0,0 +1,293 @@
+/**
+ * AsteroidSpatialSubsystem - Asteroid Spatial Hash
+ *
+ * This file defines a world subsystem that indexes every live asteroid in
+ * a loose uniform grid, so gameplay code can ask "which asteroids are near
+ * here" without physics overlap queries.
+ *
+ * Key Features:
+ * - Loose hash: each asteroid is stored in the cell containing its centre,
+ *   and queries widen by the largest asteroid radius
+ * - Updated incrementally and only on demand; only asteroids that change
+ *   cell move between buckets, and nothing runs on frames without queries
+ * - Movement alone republishes at most once per SnapshotInterval
+ * - Radius, k-nearest and ray-candidate queries, plus a batched radius query
+ *   that spreads over worker threads
+ * - Queries run on immutable snapshots, so worker threads read without locks
+ *
+ * Threading model: the game thread owns the live hash. GetSnapshot()
+ * refreshes it and publishes a new FAsteroidSpatialSnapshot when the
+ * current one is stale, then hands out a shared pointer to it, which can be
+ * passed to any number of worker tasks and queried concurrently. A
+ * snapshot never changes after it is published; the actor pointers in it
+ * must only be resolved on the game thread. A snapshot nobody else holds
+ * any more is rebuilt in place, so steady publishing does not allocate.
+ *
+ * AAsteroidActor registers itself when its mesh is applied and unregisters
+ * when it is pooled or leaves play. Settings are read from the
+ * [/Script/SPAAAAAACE.AsteroidSpatialSubsystem] section of DefaultGame.ini.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+#include "AsteroidSpatialSubsystem.generated.h"
+
+class AAsteroidActor;
+
+/**
+ * FAsteroidSpatialHit - Query Result
+ */
+struct FAsteroidSpatialHit
+{
+    /** Entry index into the snapshot the query ran on */
+    int32 Entry = INDEX_NONE;
+
+    /**
+     * Sort distance: centre distance for radius and nearest queries,
+     * distance along the ray for ray queries
+     */
+    float Distance = 0.0f;
+};
+
+/**
+ * FAsteroidSpatialSnapshot - Immutable Spatial Index
+ *
+ * Entries are stored grouped by cell, so each cell is one contiguous range
+ * of the position / radius arrays.
+ */
+class SPAAAAAACE_API FAsteroidSpatialSnapshot
+{
+public:
+    /**
+     * QueryRadius - Asteroids Touching A Sphere
+     *
+     * @param Center - Sphere centre
+     * @param Radius - Sphere radius in cm
+     * @param OutHits - Asteroids whose bounding sphere overlaps, unsorted
+     */
+    void QueryRadius(const FVector& Center, float Radius, TArray<FAsteroidSpatialHit>& OutHits) const;
+
+    /**
+     * QueryRadiusBatch - Many Radius Queries At Once
+     *
+     * Runs the queries in parallel; every query has the same radius.
+     *
+     * @param Centers - Sphere centres
+     * @param Radius - Sphere radius in cm
+     * @param OutHits - One result list per centre
+     */
+    void QueryRadiusBatch(TConstArrayView<FVector> Centers, float Radius, TArray<TArray<FAsteroidSpatialHit>>& OutHits) const;
+
+    /**
+     * QueryNearest - K Nearest Asteroids
+     *
+     * @param Point - Query point
+     * @param Count - Number of asteroids wanted
+     * @param OutHits - Up to Count asteroids, nearest centre first
+     */
+    void QueryNearest(const FVector& Point, int32 Count, TArray<FAsteroidSpatialHit>& OutHits) const;
+
+    /**
+     * QueryRay - Ray Candidates
+     *
+     * Asteroids whose bounding sphere the swept segment touches. Meant as a
+     * broad phase before precise traces against the few candidates.
+     *
+     * @param Start - Segment start
+     * @param End - Segment end
+     * @param Thickness - Radius of the swept sphere (0 for a line)
+     * @param OutHits - Candidates ordered by distance along the segment
+     */
+    void QueryRay(const FVector& Start, const FVector& End, float Thickness, TArray<FAsteroidSpatialHit>& OutHits) const;
+
+    /** @return Number of indexed asteroids */
+    int32 Num() const { return Positions.Num(); }
+
+    const FVector& GetPosition(int32 Entry) const { return Positions[Entry]; }
+    float GetRadius(int32 Entry) const { return Radii[Entry]; }
+
+    /** @return The asteroid of an entry; game thread only */
+    AAsteroidActor* GetActor(int32 Entry) const { return Actors[Entry].Get(); }
+
+private:
+    friend class UAsteroidSpatialSubsystem;
+
+    struct FCellRange
+    {
+        int32 Start = 0;
+        int32 Num = 0;
+    };
+
+    float CellSize = 1.0f;
+    float MaxEntryRadius = 0.0f;
+    FBox Bounds = FBox(ForceInit);
+
+    TMap<FIntVector, FCellRange> Cells;
+    TArray<FVector> Positions;
+    TArray<float> Radii;
+    TArray<TWeakObjectPtr<AAsteroidActor>> Actors;
+
+    FIntVector GetCell(const FVector& Location) const;
+
+    /** Calls Visit(Range) for every occupied cell overlapping the box */
+    template <typename FunctionType>
+    void ForEachCellInBox(const FVector& Min, const FVector& Max, FunctionType&& Visit) const;
+};
+
+typedef TSharedPtr<const FAsteroidSpatialSnapshot, ESPMode::ThreadSafe> FAsteroidSpatialSnapshotPtr;
+
+/**
+ * UAsteroidSpatialSubsystem - Asteroid Spatial Index Subsystem
+ *
+ * Keeps the live hash in step with asteroid movement when a snapshot is
+ * requested, and publishes snapshots for queries.
+ */
+UCLASS(Config = Game)
+class SPAAAAAACE_API UAsteroidSpatialSubsystem : public UWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    // ============================================================================
+    // LIFECYCLE MANAGEMENT
+    // ============================================================================
+
+    /**
+     * Deinitialize - Subsystem Cleanup
+     *
+     * Forgets every asteroid. Snapshots already handed out stay valid.
+     */
+    virtual void Deinitialize() override;
+
+    // ============================================================================
+    // ACCESS AND REGISTRATION
+    // ============================================================================
+
+    /**
+     * Get - Get Spatial Subsystem Instance
+     *
+     * @param WorldContext - Any object with world context
+     * @return Pointer to the spatial subsystem, or nullptr if not found
+     */
+    UFUNCTION(BlueprintPure, Category = "Asteroid Spatial")
+    static UAsteroidSpatialSubsystem* Get(const UObject* WorldContext);
+
+    /**
+     * RegisterAsteroid - Index An Asteroid
+     *
+     * Registering an asteroid again refreshes its radius.
+     *
+     * @param Asteroid - Asteroid with generated stats
+     */
+    void RegisterAsteroid(AAsteroidActor* Asteroid);
+
+    /**
+     * UnregisterAsteroid - Remove An Asteroid
+     *
+     * @param Asteroid - Asteroid to forget
+     */
+    void UnregisterAsteroid(AAsteroidActor* Asteroid);
+
+    /**
+     * GetSnapshot - Current Immutable Index
+     *
+     * Call on the game thread. Registrations and removals are always
+     * included; positions are at most SnapshotInterval old. The returned
+     * snapshot may be queried from any thread for as long as it is held.
+     *
+     * @return Current snapshot
+     */
+    FAsteroidSpatialSnapshotPtr GetSnapshot();
+
+    /**
+     * FindAsteroidsInRadius - Blueprint Radius Query
+     *
+     * @param Center - Sphere centre
+     * @param Radius - Sphere radius in cm
+     * @return Asteroids whose bounding sphere overlaps
+     */
+    UFUNCTION(BlueprintCallable, Category = "Asteroid Spatial")
+    TArray<AAsteroidActor*> FindAsteroidsInRadius(const FVector& Center, float Radius);
+
+    /**
+     * FindNearestAsteroids - Blueprint K-Nearest Query
+     *
+     * @param Point - Query point
+     * @param Count - Number of asteroids wanted
+     * @return Up to Count asteroids, nearest first
+     */
+    UFUNCTION(BlueprintCallable, Category = "Asteroid Spatial")
+    TArray<AAsteroidActor*> FindNearestAsteroids(const FVector& Point, int32 Count);
+
+    /** @return Number of indexed asteroids */
+    UFUNCTION(BlueprintPure, Category = "Asteroid Spatial")
+    int32 GetNumAsteroids() const { return Entries.Num(); }
+
+    // ============================================================================
+    // SETTINGS
+    // ============================================================================
+
+    /** Edge length of a hash cell in cm; about the most common query radius */
+    UPROPERTY(Config)
+    float CellSize = 10000.0f;
+
+    /**
+     * SnapshotInterval - Position Staleness
+     *
+     * Seconds a snapshot is reused while asteroids merely move. Queries
+     * many times a frame, or every frame, then share one snapshot instead
+     * of each refreshing every asteroid. 0 refreshes on every request.
+     */
+    UPROPERTY(Config)
+    float SnapshotInterval = 0.1f;
+
+protected:
+    virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+    struct FEntry
+    {
+        TWeakObjectPtr<AAsteroidActor> Actor;
+        TObjectKey<AAsteroidActor> Key;
+        FVector Position = FVector::ZeroVector;
+        float Radius = 0.0f;
+        FIntVector Cell = FIntVector::ZeroValue;
+    };
+
+    /** Live entries */
+    TArray<FEntry> Entries;
+
+    /** Index into Entries per asteroid */
+    TMap<TObjectKey<AAsteroidActor>, int32> EntryIndices;
+
+    /** Live hash: entry indices per occupied cell */
+    TMap<FIntVector, TArray<int32>> Cells;
+
+    /** Last published snapshot; mutable only while nobody else holds it */
+    TSharedPtr<FAsteroidSpatialSnapshot, ESPMode::ThreadSafe> Snapshot;
+
+    /** World time asteroid positions were last read */
+    double RefreshTime = 0.0;
+
+    /** An asteroid was added, removed or resized since Snapshot was published */
+    bool bDirty = false;
+
+    FIntVector GetCell(const FVector& Location) const;
+
+    /** Swap-removes an entry, fixing the cell list of the entry moved into its slot */
+    void RemoveEntryAt(int32 Index);
+
+    /**
+     * Reads every asteroid's position, drops destroyed asteroids and moves
+     * the ones that changed cell
+     *
+     * @return True if anything moved
+     */
+    bool RefreshEntries();
+
+    /** Builds a new snapshot from the live hash */
+    void PublishSnapshot();
+};
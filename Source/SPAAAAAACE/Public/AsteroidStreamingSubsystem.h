@@ -0,0 +1,273 @@
+/**
+ * AsteroidStreamingSubsystem - Seed-Driven Asteroid Cell Streaming
+ *
+ * This file defines a world subsystem that populates space around the
+ * player ship with asteroids on demand instead of placing them by hand.
+ *
+ * Key Features:
+ * - Space divided into cubic cells addressed by integer coordinates
+ * - Each cell's asteroids derived purely from (WorldSeed, cell coordinates)
+ * - Cells load as the AShipPawn approaches and unload behind it
+ * - Separate load and unload radii (hysteresis) to avoid thrashing at borders
+ * - Per-frame spawn/release budget so streaming never causes a hitch
+ * - Actors recycled through UAsteroidPoolSubsystem
+ *
+ * Nothing about a cell is remembered after it unloads, so the number of
+ * resident cells (and memory) is bounded by the unload radius no matter
+ * how far the player flies. A cell that reloads produces the same
+ * asteroids it did before; changes made to them (mining, fracture) are
+ * not persisted.
+ *
+ * Settings are read from the [/Script/SPAAAAAACE.AsteroidStreamingSubsystem]
+ * section of DefaultGame.ini.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "AsteroidGenerator.h"
+#include "AsteroidStreamingSubsystem.generated.h"
+
+class AAsteroidActor;
+
+/**
+ * FAsteroidStreamSpawn - Deterministic Asteroid Placement
+ *
+ * Everything needed to spawn one streamed asteroid.
+ */
+struct FAsteroidStreamSpawn
+{
+    FTransform Transform;
+    float Radius = 0.0f;
+    int32 Seed = 0;
+};
+
+/**
+ * FAsteroidStreamCell - Resident Cell
+ *
+ * A loaded (or loading) cell. Spawns are computed when the cell is
+ * created; actors are spawned from them over several frames.
+ */
+struct FAsteroidStreamCell
+{
+    /** Deterministic placements for this cell */
+    TArray<FAsteroidStreamSpawn> Spawns;
+
+    /** Number of entries of Spawns that have been spawned */
+    int32 NumSpawned = 0;
+
+    /** Spawned actors */
+    TArray<TWeakObjectPtr<AAsteroidActor>> Actors;
+};
+
+/**
+ * UAsteroidStreamingSubsystem - Asteroid Cell Streaming Subsystem
+ *
+ * Ticks every frame while streaming is active. Each frame it finds the
+ * player ship's cell, queues cells entering LoadRadius and cells leaving
+ * UnloadRadius, and works through both queues within the frame budget.
+ */
+UCLASS(Config = Game)
+class SPAAAAAACE_API UAsteroidStreamingSubsystem : public UTickableWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    // ============================================================================
+    // LIFECYCLE MANAGEMENT
+    // ============================================================================
+
+    /**
+     * OnWorldBeginPlay - Auto Start
+     *
+     * Starts streaming with WorldSeed when bAutoStart is set.
+     *
+     * @param InWorld - World that began play
+     */
+    virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+
+    /**
+     * Deinitialize - Subsystem Cleanup
+     *
+     * Stops streaming and releases all cells.
+     */
+    virtual void Deinitialize() override;
+
+    /**
+     * Tick - Streaming Update
+     *
+     * Refreshes the queues when the ship changes cell, then releases and
+     * spawns asteroids within the frame budget.
+     *
+     * @param DeltaTime - Frame time
+     */
+    virtual void Tick(float DeltaTime) override;
+
+    virtual TStatId GetStatId() const override;
+    virtual bool IsTickable() const override { return bStreamingActive; }
+
+    // ============================================================================
+    // ACCESS AND CONTROL
+    // ============================================================================
+
+    /**
+     * Get - Get Streaming Subsystem Instance
+     *
+     * @param WorldContext - Any object with world context
+     * @return Pointer to the streaming subsystem, or nullptr if not found
+     */
+    UFUNCTION(BlueprintPure, Category = "Asteroid Streaming")
+    static UAsteroidStreamingSubsystem* Get(const UObject* WorldContext);
+
+    /**
+     * StartStreaming - Begin Populating Space
+     *
+     * Unloads anything already streamed and starts streaming with the
+     * given world seed.
+     *
+     * @param InWorldSeed - Seed all cell contents are derived from
+     */
+    UFUNCTION(BlueprintCallable, Category = "Asteroid Streaming")
+    void StartStreaming(int32 InWorldSeed);
+
+    /**
+     * StopStreaming - Stop And Unload
+     *
+     * Releases every streamed asteroid immediately and stops ticking.
+     */
+    UFUNCTION(BlueprintCallable, Category = "Asteroid Streaming")
+    void StopStreaming();
+
+    /** @return Number of resident cells */
+    UFUNCTION(BlueprintPure, Category = "Asteroid Streaming")
+    int32 GetNumLoadedCells() const { return Cells.Num(); }
+
+    /** @return Number of streamed asteroid actors currently alive */
+    UFUNCTION(BlueprintPure, Category = "Asteroid Streaming")
+    int32 GetNumStreamedAsteroids() const;
+
+    /**
+     * GetCellForLocation - World Location To Cell
+     *
+     * @param Location - World-space location
+     * @return Integer coordinates of the containing cell
+     */
+    FIntVector GetCellForLocation(const FVector& Location) const;
+
+    /**
+     * BuildCellSpawns - Derive A Cell's Asteroids
+     *
+     * Pure function of the world seed, the cell coordinates and the
+     * streaming settings.
+     *
+     * @param Cell - Cell coordinates
+     * @param OutSpawns - Placements for that cell
+     */
+    void BuildCellSpawns(const FIntVector& Cell, TArray<FAsteroidStreamSpawn>& OutSpawns) const;
+
+    // ============================================================================
+    // SETTINGS
+    // ============================================================================
+
+    /** Start streaming automatically at BeginPlay using WorldSeed */
+    UPROPERTY(Config)
+    bool bAutoStart = false;
+
+    /** Seed used by bAutoStart */
+    UPROPERTY(Config)
+    int32 WorldSeed = 1;
+
+    /** Edge length of a cell in centimeters */
+    UPROPERTY(Config)
+    float CellSize = 50000.0f;
+
+    /** Cells whose centre is within this many cells of the player's cell load */
+    UPROPERTY(Config)
+    int32 LoadRadius = 2;
+
+    /** Loaded cells farther than this many cells unload; kept above LoadRadius */
+    UPROPERTY(Config)
+    int32 UnloadRadius = 3;
+
+    /** Asteroids per cell (inclusive range) */
+    UPROPERTY(Config)
+    int32 MinAsteroidsPerCell = 2;
+
+    UPROPERTY(Config)
+    int32 MaxAsteroidsPerCell = 8;
+
+    /** Asteroid radius range in centimeters */
+    UPROPERTY(Config)
+    float MinRadius = 100.0f;
+
+    UPROPERTY(Config)
+    float MaxRadius = 1500.0f;
+
+    /**
+     * SeedPaletteSize - Shape Reuse
+     *
+     * When greater than zero, asteroid shapes are drawn from this many
+     * world-wide seeds so the mesh registry and disk cache can share them.
+     * Zero gives every asteroid its own shape.
+     */
+    UPROPERTY(Config)
+    int32 SeedPaletteSize = 0;
+
+    /** Class spawned for streamed asteroids (AAsteroidActor if unset) */
+    UPROPERTY(Config)
+    TSoftClassPtr<AAsteroidActor> AsteroidClass;
+
+    /** Maximum asteroid actors spawned per frame */
+    UPROPERTY(Config)
+    int32 MaxSpawnsPerFrame = 4;
+
+    /** Maximum asteroid actors released to the pool per frame */
+    UPROPERTY(Config)
+    int32 MaxReleasesPerFrame = 16;
+
+    /** Streaming work stops for the frame once this many milliseconds are spent */
+    UPROPERTY(Config)
+    float FrameBudgetMs = 1.0f;
+
+protected:
+    virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+    /** AsteroidClass, loaded when streaming starts */
+    UPROPERTY(Transient)
+    TSubclassOf<AAsteroidActor> ResolvedAsteroidClass;
+
+    /** Resident cells */
+    TMap<FIntVector, FAsteroidStreamCell> Cells;
+
+    /** Cells waiting to load, nearest first */
+    TArray<FIntVector> LoadQueue;
+
+    /** Actors of unloaded cells still waiting to be released */
+    TArray<TWeakObjectPtr<AAsteroidActor>> ReleaseQueue;
+
+    /** Player cell the queues were last built for */
+    FIntVector LastCenterCell = FIntVector(MAX_int32);
+
+    /** Seed in use while streaming */
+    int32 ActiveWorldSeed = 0;
+
+    /** True between StartStreaming and StopStreaming */
+    bool bStreamingActive = false;
+
+    /** Location streaming is centred on; false if there is no ship */
+    bool GetStreamingCenter(FVector& OutLocation) const;
+
+    /** Rebuilds the load queue and unloads far cells for a new centre cell */
+    void UpdateQueues(const FIntVector& CenterCell);
+
+    /** Moves a cell's actors to the release queue and forgets the cell */
+    void UnloadCell(const FIntVector& Cell);
+
+    /** Acquires one asteroid from the pool for a cell placement */
+    AAsteroidActor* SpawnAsteroid(const FAsteroidStreamSpawn& Spawn, UClass* Class);
+
+    /** Returns an asteroid to the pool */
+    void ReleaseAsteroid(AAsteroidActor* Actor);
+};
@@ -8,7 +8,8 @@ public class SPAAAAAACE : ModuleRules
         PCHUsage = PCHUsageMode.UseExplicitOrSharedPCHs;
 
         PublicDependencyModuleNames.AddRange(new string[] {
-            "Core", "CoreUObject", "Engine", "InputCore", "EnhancedInput", "ProceduralMeshComponent"
+            "Core", "CoreUObject", "Engine", "InputCore", "EnhancedInput", "ProceduralMeshComponent",
+            "MeshDescription", "StaticMeshDescription", "PhysicsCore", "Chaos"
         });
 
         PrivateDependencyModuleNames.AddRange(new string[] {